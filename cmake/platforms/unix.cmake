@@ -117,6 +117,12 @@ add_optional_system_lib(m pow)
 add_optional_system_lib(rt clock_gettime)
 add_optional_system_lib(xnet socket)
 
+# The background log file writer runs in a thread of its own. Only
+# the targets that contain logging.c link against this.
+set(THREADS_PREFER_PTHREAD_FLAG ON)
+find_package(Threads REQUIRED)
+set(logwriter_libraries Threads::Threads)
+
 set(extra_dirs charset)
 
 if(PUTTY_GSSAPI STREQUAL DYNAMIC)
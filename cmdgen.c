@@ -85,6 +85,9 @@ char *x_get_default(const char *key)
 void sk_cleanup(void)
 {
 }
+void log_free(LogContext *ctx)
+{
+}
 
 void showversion(void)
 {
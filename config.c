@@ -2002,6 +2002,17 @@ void setup_config_box(struct controlbox *b, bool midsession,
     ctrl_checkbox(s, "Include header", 'i',
                   HELPCTX(logging_header),
                   conf_checkbox_handler, I(CONF_logheader));
+    ctrl_checkbox(s, "Compress log file with gzip", 'z',
+                  HELPCTX(logging_compress),
+                  conf_checkbox_handler, I(CONF_logcompress));
+    ctrl_radiobuttons(s, "Write the log file:", 'w', 1,
+                      HELPCTX(logging_writer),
+                      conf_radiobutton_handler, I(CONF_logwriter),
+                      "Directly, as data arrives", I(LGWR_SYNC),
+                      "In the background, waiting if it falls behind",
+                      I(LGWR_BLOCK),
+                      "In the background, discarding data if it falls behind",
+                      I(LGWR_DROP));
 
     if ((midsession && protocol == PROT_SSH) ||
         (!midsession && backend_vt_from_proto(PROT_SSH))) {
@@ -2013,6 +2024,9 @@ void setup_config_box(struct controlbox *b, bool midsession,
         ctrl_checkbox(s, "Omit session data", 'd',
                       HELPCTX(logging_ssh_omit_data),
                       conf_checkbox_handler, I(CONF_logomitdata));
+        ctrl_checkbox(s, "Write a compact binary log", 'b',
+                      HELPCTX(logging_ssh_binary),
+                      conf_checkbox_handler, I(CONF_logbinary));
     }
 
     /*
@@ -2231,6 +2245,9 @@ void setup_config_box(struct controlbox *b, bool midsession,
     ctrl_editbox(s, "Lines of scrollback", 's', 50,
                  HELPCTX(window_scrollback),
                  conf_editbox_handler, I(CONF_savelines), ED_INT);
+    ctrl_checkbox(s, "Keep unlimited scrollback in a temporary file", 'u',
+                  HELPCTX(window_spill),
+                  conf_checkbox_handler, I(CONF_spill_scrollback));
     ctrl_checkbox(s, "Display scrollbar", 'd',
                   HELPCTX(window_scrollback),
                   conf_checkbox_handler, I(CONF_scrollbar));
@@ -2245,6 +2262,15 @@ void setup_config_box(struct controlbox *b, bool midsession,
                   conf_checkbox_handler,
                   I(CONF_erase_to_scrollback));
 
+    s = ctrl_getset(b, "Window", "pacing",
+                    "Control how often the window is redrawn");
+    ctrl_radiobuttons(s, "Redraw rate during heavy output:", 'w', 2,
+                      HELPCTX(window_pacing),
+                      conf_radiobutton_handler,
+                      I(CONF_update_pacing),
+                      "Adaptive", I(UPDATE_PACING_ADAPTIVE),
+                      "Fixed", I(UPDATE_PACING_FIXED));
+
     /*
      * The Window/Appearance panel.
      */
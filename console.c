@@ -36,6 +36,21 @@ const SeatDialogPromptDescriptions *console_prompt_descriptions(Seat *seat)
 
 bool console_batch_mode = false;
 
+/*
+ * The session log of a console tool, if it has one. cleanup_exit
+ * frees it, however the tool comes to exit, because a compressed log
+ * isn't finished until it's closed.
+ */
+LogContext *console_logctx = NULL;
+
+void console_free_log(void)
+{
+    if (console_logctx) {
+        log_free(console_logctx);
+        console_logctx = NULL;
+    }
+}
+
 /*
  * Error message and/or fatal exit functions, all based on
  * console_print_error_msg which the platform front end provides.
@@ -46,6 +46,41 @@ NI_CIPHER(192, d, dec, REP11)
 NI_CIPHER(256, e, enc, REP13)
 NI_CIPHER(256, d, dec, REP13)
 
+/*
+ * Versions of the encrypt functions that process four independent
+ * blocks at once. AESENC has a latency of several cycles but can be
+ * issued at least once per cycle, so a single chain of rounds leaves
+ * the pipeline mostly idle; interleaving four chains keeps it busy.
+ * This is only useful for the counter-based modes, where the cipher
+ * inputs don't depend on each other's outputs.
+ */
+
+#define NI_CIPHER_4WAY(len, repmacro)                                   \
+    static inline void aes_ni_##len##_e4(                               \
+        __m128i *v, const __m128i *keysched)                            \
+    {                                                                   \
+        __m128i v0 = v[0], v1 = v[1], v2 = v[2], v3 = v[3];             \
+        __m128i k = *keysched++;                                        \
+        v0 = _mm_xor_si128(v0, k);                                      \
+        v1 = _mm_xor_si128(v1, k);                                      \
+        v2 = _mm_xor_si128(v2, k);                                      \
+        v3 = _mm_xor_si128(v3, k);                                      \
+        repmacro(k = *keysched++;                                       \
+                 v0 = _mm_aesenc_si128(v0, k);                          \
+                 v1 = _mm_aesenc_si128(v1, k);                          \
+                 v2 = _mm_aesenc_si128(v2, k);                          \
+                 v3 = _mm_aesenc_si128(v3, k););                        \
+        k = *keysched;                                                  \
+        v[0] = _mm_aesenclast_si128(v0, k);                             \
+        v[1] = _mm_aesenclast_si128(v1, k);                             \
+        v[2] = _mm_aesenclast_si128(v2, k);                             \
+        v[3] = _mm_aesenclast_si128(v3, k);                             \
+    }
+
+NI_CIPHER_4WAY(128, REP9)
+NI_CIPHER_4WAY(192, REP11)
+NI_CIPHER_4WAY(256, REP13)
+
 /*
  * The main key expansion.
  */
@@ -244,6 +279,7 @@ static void aes_ni_next_message_gcm(ssh_cipher *ciph)
 }
 
 typedef __m128i (*aes_ni_fn)(__m128i v, const __m128i *keysched);
+typedef void (*aes_ni_4way_fn)(__m128i *v, const __m128i *keysched);
 
 static inline void aes_cbc_ni_encrypt(
     ssh_cipher *ciph, void *vblk, int blklen, aes_ni_fn encrypt)
@@ -276,12 +312,29 @@ static inline void aes_cbc_ni_decrypt(
 }
 
 static inline void aes_sdctr_ni(
-    ssh_cipher *ciph, void *vblk, int blklen, aes_ni_fn encrypt)
+    ssh_cipher *ciph, void *vblk, int blklen, aes_ni_fn encrypt,
+    aes_ni_4way_fn encrypt4)
 {
     aes_ni_context *ctx = container_of(ciph, aes_ni_context, ciph);
+    uint8_t *blk = (uint8_t *)vblk, *finish = blk + blklen;
+
+    /* Do as much as we can four blocks at a time */
+    for (; finish - blk >= 64; blk += 64) {
+        __m128i v[4];
+        for (size_t i = 0; i < 4; i++) {
+            v[i] = aes_ni_sdctr_reverse(ctx->iv);
+            ctx->iv = aes_ni_sdctr_increment(ctx->iv);
+        }
+        encrypt4(v, ctx->keysched_e);
+        for (size_t i = 0; i < 4; i++) {
+            __m128i input = _mm_loadu_si128((const __m128i *)blk + i);
+            __m128i output = _mm_xor_si128(input, v[i]);
+            _mm_storeu_si128((__m128i *)blk + i, output);
+        }
+    }
 
-    for (uint8_t *blk = (uint8_t *)vblk, *finish = blk + blklen;
-         blk < finish; blk += 16) {
+    /* And the remainder one block at a time */
+    for (; blk < finish; blk += 16) {
         __m128i counter = aes_ni_sdctr_reverse(ctx->iv);
         __m128i keystream = encrypt(counter, ctx->keysched_e);
         __m128i input = _mm_loadu_si128((const __m128i *)blk);
@@ -301,12 +354,29 @@ static inline void aes_encrypt_ecb_block_ni(
 }
 
 static inline void aes_gcm_ni(
-    ssh_cipher *ciph, void *vblk, int blklen, aes_ni_fn encrypt)
+    ssh_cipher *ciph, void *vblk, int blklen, aes_ni_fn encrypt,
+    aes_ni_4way_fn encrypt4)
 {
     aes_ni_context *ctx = container_of(ciph, aes_ni_context, ciph);
+    uint8_t *blk = (uint8_t *)vblk, *finish = blk + blklen;
+
+    /* Do as much as we can four blocks at a time */
+    for (; finish - blk >= 64; blk += 64) {
+        __m128i v[4];
+        for (size_t i = 0; i < 4; i++) {
+            v[i] = aes_ni_sdctr_reverse(ctx->iv);
+            ctx->iv = aes_ni_gcm_increment(ctx->iv);
+        }
+        encrypt4(v, ctx->keysched_e);
+        for (size_t i = 0; i < 4; i++) {
+            __m128i input = _mm_loadu_si128((const __m128i *)blk + i);
+            __m128i output = _mm_xor_si128(input, v[i]);
+            _mm_storeu_si128((__m128i *)blk + i, output);
+        }
+    }
 
-    for (uint8_t *blk = (uint8_t *)vblk, *finish = blk + blklen;
-         blk < finish; blk += 16) {
+    /* And the remainder one block at a time */
+    for (; blk < finish; blk += 16) {
         __m128i counter = aes_ni_sdctr_reverse(ctx->iv);
         __m128i keystream = encrypt(counter, ctx->keysched_e);
         __m128i input = _mm_loadu_si128((const __m128i *)blk);
@@ -325,10 +395,12 @@ static inline void aes_gcm_ni(
     { aes_cbc_ni_decrypt(ciph, vblk, blklen, aes_ni_##len##_d); }       \
     static void aes##len##_ni_sdctr(                                    \
         ssh_cipher *ciph, void *vblk, int blklen)                       \
-    { aes_sdctr_ni(ciph, vblk, blklen, aes_ni_##len##_e); }             \
+    { aes_sdctr_ni(ciph, vblk, blklen, aes_ni_##len##_e,                \
+                   aes_ni_##len##_e4); }                                \
     static void aes##len##_ni_gcm(                                      \
         ssh_cipher *ciph, void *vblk, int blklen)                       \
-    { aes_gcm_ni(ciph, vblk, blklen, aes_ni_##len##_e); }               \
+    { aes_gcm_ni(ciph, vblk, blklen, aes_ni_##len##_e,                  \
+                 aes_ni_##len##_e4); }                                  \
     static void aes##len##_ni_encrypt_ecb_block(                        \
         ssh_cipher *ciph, void *vblk)                                   \
     { aes_encrypt_ecb_block_ni(ciph, vblk, aes_ni_##len##_e); }
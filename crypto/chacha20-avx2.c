@@ -0,0 +1,367 @@
+/*
+ * Implementation of the ChaCha20 keystream generator using x86 AVX2,
+ * computing eight blocks in parallel.
+ *
+ * The eight blocks are laid out 'vertically': each of the 16 state
+ * words is held in its own 256-bit vector, with lane i of every
+ * vector belonging to block i. That way each quarter-round operation
+ * is a single vector instruction doing the same thing to all eight
+ * blocks, and nothing needs shuffling between lanes until the output
+ * is written out at the end.
+ */
+
+#include "ssh.h"
+#include "chacha20.h"
+
+#include <immintrin.h>
+
+#if defined(__clang__) || defined(__GNUC__)
+#include <cpuid.h>
+#define GET_CPU_ID_0(out)                               \
+    __cpuid(0, (out)[0], (out)[1], (out)[2], (out)[3])
+#define GET_CPU_ID_1(out)                               \
+    __cpuid(1, (out)[0], (out)[1], (out)[2], (out)[3])
+#define GET_CPU_ID_7(out)                                       \
+    __cpuid_count(7, 0, (out)[0], (out)[1], (out)[2], (out)[3])
+#else
+#define GET_CPU_ID_0(out) __cpuid(out, 0)
+#define GET_CPU_ID_1(out) __cpuid(out, 1)
+#define GET_CPU_ID_7(out) __cpuidex(out, 7, 0)
+#endif
+
+bool chacha20_avx2_available(void)
+{
+    unsigned int CPUInfo[4];
+    GET_CPU_ID_0(CPUInfo);
+    if (CPUInfo[0] < 7)
+        return false;
+
+    /*
+     * As well as the CPU supporting AVX2, the OS has to have enabled
+     * saving of the full YMM registers on context switch. That's
+     * indicated by the OSXSAVE bit in leaf 1, and then bits 1 and 2
+     * (SSE and AVX state) of XCR0.
+     */
+    GET_CPU_ID_1(CPUInfo);
+    if (!(CPUInfo[2] & (1 << 27)))     /* Check OSXSAVE */
+        return false;
+    if ((_xgetbv(0) & 6) != 6)
+        return false;
+
+    GET_CPU_ID_7(CPUInfo);
+    return CPUInfo[1] & (1 << 5);      /* Check AVX2 */
+}
+
+/*
+ * Rotations. The 16- and 8-bit ones can be done as a byte shuffle,
+ * which is cheaper than the general shift-and-or.
+ */
+static inline __m256i rotl_16(__m256i x)
+{
+    const __m256i shuf = _mm256_setr_epi8(
+        2,3,0,1, 6,7,4,5, 10,11,8,9, 14,15,12,13,
+        2,3,0,1, 6,7,4,5, 10,11,8,9, 14,15,12,13);
+    return _mm256_shuffle_epi8(x, shuf);
+}
+
+static inline __m256i rotl_8(__m256i x)
+{
+    const __m256i shuf = _mm256_setr_epi8(
+        3,0,1,2, 7,4,5,6, 11,8,9,10, 15,12,13,14,
+        3,0,1,2, 7,4,5,6, 11,8,9,10, 15,12,13,14);
+    return _mm256_shuffle_epi8(x, shuf);
+}
+
+#define rotl_n(x, n)                                                    \
+    _mm256_or_si256(_mm256_slli_epi32(x, n), _mm256_srli_epi32(x, 32-(n)))
+
+#define quarter(a, b, c, d) do {                                        \
+        x[a] = _mm256_add_epi32(x[a], x[b]);                            \
+        x[d] = rotl_16(_mm256_xor_si256(x[d], x[a]));                   \
+        x[c] = _mm256_add_epi32(x[c], x[d]);                            \
+        x[b] = rotl_n(_mm256_xor_si256(x[b], x[c]), 12);                \
+        x[a] = _mm256_add_epi32(x[a], x[b]);                            \
+        x[d] = rotl_8(_mm256_xor_si256(x[d], x[a]));                    \
+        x[c] = _mm256_add_epi32(x[c], x[d]);                            \
+        x[b] = rotl_n(_mm256_xor_si256(x[b], x[c]), 7);                 \
+    } while (0)
+
+/*
+ * Transpose eight vectors, each holding one state word from each of
+ * the eight blocks, into eight vectors each holding eight consecutive
+ * words of a single block, and store them at 'out' with a stride of
+ * one block.
+ */
+static inline void chacha20_avx2_transpose_store(
+    const __m256i *w, unsigned char *out)
+{
+    __m256i t0 = _mm256_unpacklo_epi32(w[0], w[1]);
+    __m256i t1 = _mm256_unpackhi_epi32(w[0], w[1]);
+    __m256i t2 = _mm256_unpacklo_epi32(w[2], w[3]);
+    __m256i t3 = _mm256_unpackhi_epi32(w[2], w[3]);
+    __m256i t4 = _mm256_unpacklo_epi32(w[4], w[5]);
+    __m256i t5 = _mm256_unpackhi_epi32(w[4], w[5]);
+    __m256i t6 = _mm256_unpacklo_epi32(w[6], w[7]);
+    __m256i t7 = _mm256_unpackhi_epi32(w[6], w[7]);
+
+    /* Now u_k holds words 0-3 of blocks k and k+4 in its two halves,
+     * and v_k holds words 4-7 of the same two blocks. */
+    __m256i u0 = _mm256_unpacklo_epi64(t0, t2);
+    __m256i u1 = _mm256_unpackhi_epi64(t0, t2);
+    __m256i u2 = _mm256_unpacklo_epi64(t1, t3);
+    __m256i u3 = _mm256_unpackhi_epi64(t1, t3);
+    __m256i v0 = _mm256_unpacklo_epi64(t4, t6);
+    __m256i v1 = _mm256_unpackhi_epi64(t4, t6);
+    __m256i v2 = _mm256_unpacklo_epi64(t5, t7);
+    __m256i v3 = _mm256_unpackhi_epi64(t5, t7);
+
+#define STORE_PAIR(k, u, v)                                             \
+    _mm256_storeu_si256((__m256i *)(out + 64 * (k)),                    \
+                        _mm256_permute2x128_si256(u, v, 0x20));         \
+    _mm256_storeu_si256((__m256i *)(out + 64 * ((k) + 4)),              \
+                        _mm256_permute2x128_si256(u, v, 0x31))
+
+    STORE_PAIR(0, u0, v0);
+    STORE_PAIR(1, u1, v1);
+    STORE_PAIR(2, u2, v2);
+    STORE_PAIR(3, u3, v3);
+
+#undef STORE_PAIR
+}
+
+static void chacha20_avx2_8blocks(const uint32_t *state, unsigned char *out)
+{
+    __m256i init[16], x[16];
+
+    for (size_t i = 0; i < 16; i++)
+        init[i] = _mm256_set1_epi32(state[i]);
+
+    /*
+     * Set up the 64-bit block counter in words 12 and 13 so that lane
+     * i gets the counter plus i, carrying into the high word if the
+     * low one wraps. There's no unsigned vector comparison, so flip
+     * the top bits and compare signed instead.
+     */
+    const __m256i bias = _mm256_set1_epi32(0x80000000);
+    __m256i lo = _mm256_add_epi32(
+        init[12], _mm256_setr_epi32(0, 1, 2, 3, 4, 5, 6, 7));
+    __m256i wrapped = _mm256_cmpgt_epi32(
+        _mm256_xor_si256(init[12], bias), _mm256_xor_si256(lo, bias));
+    init[12] = lo;
+    init[13] = _mm256_sub_epi32(init[13], wrapped);
+
+    for (size_t i = 0; i < 16; i++)
+        x[i] = init[i];
+
+    for (size_t i = 0; i < 20; i += 2) {
+        quarter(0, 4, 8, 12);
+        quarter(1, 5, 9, 13);
+        quarter(2, 6, 10, 14);
+        quarter(3, 7, 11, 15);
+        quarter(0, 5, 10, 15);
+        quarter(1, 6, 11, 12);
+        quarter(2, 7, 8, 13);
+        quarter(3, 4, 9, 14);
+    }
+
+    for (size_t i = 0; i < 16; i++)
+        x[i] = _mm256_add_epi32(x[i], init[i]);
+
+    chacha20_avx2_transpose_store(x, out);
+    chacha20_avx2_transpose_store(x + 8, out + 32);
+
+    smemclr(x, sizeof(x));
+    smemclr(init, sizeof(init));
+}
+
+void chacha20_avx2_blocks(uint32_t *state, unsigned char *out, size_t nblocks)
+{
+    assert(nblocks <= CHACHA20_MAX_BLOCKS);
+
+    /*
+     * The eight-way kernel costs about as much as three blocks done
+     * one at a time, so for very short requests (such as the packet
+     * length field) it's not worth it.
+     */
+    if (nblocks < 4) {
+        chacha20_sw_blocks(state, out, nblocks);
+        return;
+    }
+
+    if (nblocks == CHACHA20_MAX_BLOCKS) {
+        chacha20_avx2_8blocks(state, out);
+    } else {
+        /* Generate a full set and keep only as much as was asked for */
+        unsigned char tmp[64 * CHACHA20_MAX_BLOCKS];
+        chacha20_avx2_8blocks(state, tmp);
+        memcpy(out, tmp, 64 * nblocks);
+        smemclr(tmp, sizeof(tmp));
+    }
+
+    /* Advance the 64-bit block counter */
+    uint32_t old = state[12];
+    state[12] += nblocks;
+    state[13] += (state[12] < old);
+}
+
+/*
+ * Poly1305, absorbing four message blocks per step.
+ *
+ * The four 64-bit lanes of each vector hold four independent
+ * accumulators, in radix 2^26 with one limb per vector. Lane i
+ * absorbs message blocks i, i+4, i+8, ..., multiplying by r^4 in
+ * between; at the end, lane i is multiplied by r^(4-i) and the lanes
+ * are summed. That gives the same result as the serial Horner
+ * evaluation, since
+ *
+ *   (((h+m0)r + m1)r + m2)r + m3)r = (h+m0)r^4 + m1 r^3 + m2 r^2 + m3 r
+ *
+ * and likewise for longer runs.
+ *
+ * _mm256_mul_epu32 multiplies the low 32 bits of each 64-bit lane,
+ * so every limb must be kept below 2^32 going into a multiplication.
+ * After a carry pass limbs are at most a little over 2^26, and adding
+ * a message limb keeps them under 2^27, so products of those with
+ * 5*r (under 2^29) are below 2^56, and a sum of five of them can't
+ * overflow a 64-bit lane.
+ */
+
+#define POLY_MASK26 0x3ffffff
+
+/* Load limb j of four consecutive message blocks into the lanes */
+static inline void poly1305_avx2_load(__m256i *m, const unsigned char *msg)
+{
+    __m256i lo = _mm256_setr_epi64x(
+        GET_64BIT_LSB_FIRST(msg), GET_64BIT_LSB_FIRST(msg + 16),
+        GET_64BIT_LSB_FIRST(msg + 32), GET_64BIT_LSB_FIRST(msg + 48));
+    __m256i hi = _mm256_setr_epi64x(
+        GET_64BIT_LSB_FIRST(msg + 8), GET_64BIT_LSB_FIRST(msg + 24),
+        GET_64BIT_LSB_FIRST(msg + 40), GET_64BIT_LSB_FIRST(msg + 56));
+    const __m256i mask = _mm256_set1_epi64x(POLY_MASK26);
+
+    m[0] = _mm256_and_si256(lo, mask);
+    m[1] = _mm256_and_si256(_mm256_srli_epi64(lo, 26), mask);
+    m[2] = _mm256_and_si256(_mm256_or_si256(
+        _mm256_srli_epi64(lo, 52), _mm256_slli_epi64(hi, 12)), mask);
+    m[3] = _mm256_and_si256(_mm256_srli_epi64(hi, 14), mask);
+    /* Top limb, including the 2^128 bit appended to every block */
+    m[4] = _mm256_or_si256(_mm256_srli_epi64(hi, 40),
+                           _mm256_set1_epi64x(1 << 24));
+}
+
+/*
+ * Multiply the lanes of a by the lanes of r (with r5 = 5*r, used to
+ * fold the high half of the product back in, since 2^130 = 5 mod p),
+ * and do one carry pass.
+ */
+static inline void poly1305_avx2_mul(__m256i *a, const __m256i *r,
+                                     const __m256i *r5)
+{
+    __m256i d[5];
+
+#define MUL(x, y) _mm256_mul_epu32(x, y)
+#define ADD(x, y) _mm256_add_epi64(x, y)
+    d[0] = ADD(ADD(ADD(ADD(MUL(a[0], r[0]), MUL(a[1], r5[4])),
+                       MUL(a[2], r5[3])), MUL(a[3], r5[2])),
+               MUL(a[4], r5[1]));
+    d[1] = ADD(ADD(ADD(ADD(MUL(a[0], r[1]), MUL(a[1], r[0])),
+                       MUL(a[2], r5[4])), MUL(a[3], r5[3])),
+               MUL(a[4], r5[2]));
+    d[2] = ADD(ADD(ADD(ADD(MUL(a[0], r[2]), MUL(a[1], r[1])),
+                       MUL(a[2], r[0])), MUL(a[3], r5[4])),
+               MUL(a[4], r5[3]));
+    d[3] = ADD(ADD(ADD(ADD(MUL(a[0], r[3]), MUL(a[1], r[2])),
+                       MUL(a[2], r[1])), MUL(a[3], r[0])),
+               MUL(a[4], r5[4]));
+    d[4] = ADD(ADD(ADD(ADD(MUL(a[0], r[4]), MUL(a[1], r[3])),
+                       MUL(a[2], r[2])), MUL(a[3], r[1])),
+               MUL(a[4], r[0]));
+#undef MUL
+
+    const __m256i mask = _mm256_set1_epi64x(POLY_MASK26);
+    __m256i c;
+    c = _mm256_srli_epi64(d[0], 26); d[0] = _mm256_and_si256(d[0], mask);
+    d[1] = ADD(d[1], c);
+    c = _mm256_srli_epi64(d[1], 26); d[1] = _mm256_and_si256(d[1], mask);
+    d[2] = ADD(d[2], c);
+    c = _mm256_srli_epi64(d[2], 26); d[2] = _mm256_and_si256(d[2], mask);
+    d[3] = ADD(d[3], c);
+    c = _mm256_srli_epi64(d[3], 26); d[3] = _mm256_and_si256(d[3], mask);
+    d[4] = ADD(d[4], c);
+    c = _mm256_srli_epi64(d[4], 26); d[4] = _mm256_and_si256(d[4], mask);
+    d[0] = ADD(d[0], ADD(c, _mm256_slli_epi64(c, 2)));
+    c = _mm256_srli_epi64(d[0], 26); d[0] = _mm256_and_si256(d[0], mask);
+    d[1] = ADD(d[1], c);
+#undef ADD
+
+    for (size_t i = 0; i < 5; i++)
+        a[i] = d[i];
+    smemclr(d, sizeof(d));
+}
+
+static inline void poly1305_avx2_set_r(__m256i *r, __m256i *r5,
+                                       const uint32_t *l0, const uint32_t *l1,
+                                       const uint32_t *l2, const uint32_t *l3)
+{
+    for (size_t i = 0; i < 5; i++) {
+        r[i] = _mm256_setr_epi64x(l0[i], l1[i], l2[i], l3[i]);
+        r5[i] = _mm256_add_epi64(r[i], _mm256_slli_epi64(r[i], 2));
+    }
+}
+
+void poly1305_avx2_blocks(uint32_t *h, const uint32_t (*rpow)[5],
+                          const unsigned char *msg, size_t nblocks)
+{
+    __m256i a[5], m[5], r[5], r5[5];
+
+    assert(nblocks > 0 && nblocks % 4 == 0);
+
+    /* Start each lane off with one message block, and add the
+     * existing accumulator into lane 0 */
+    poly1305_avx2_load(a, msg);
+    for (size_t i = 0; i < 5; i++)
+        a[i] = _mm256_add_epi64(a[i], _mm256_setr_epi64x(h[i], 0, 0, 0));
+    msg += 64;
+    nblocks -= 4;
+
+    /* Main loop: multiply every lane by r^4 and add the next block */
+    poly1305_avx2_set_r(r, r5, rpow[3], rpow[3], rpow[3], rpow[3]);
+    for (; nblocks; nblocks -= 4, msg += 64) {
+        poly1305_avx2_mul(a, r, r5);
+        poly1305_avx2_load(m, msg);
+        for (size_t i = 0; i < 5; i++)
+            a[i] = _mm256_add_epi64(a[i], m[i]);
+    }
+
+    /* Final multiplication of lane i by r^(4-i) */
+    poly1305_avx2_set_r(r, r5, rpow[3], rpow[2], rpow[1], rpow[0]);
+    poly1305_avx2_mul(a, r, r5);
+
+    /* Sum the lanes, and carry the result all the way round */
+    uint64_t d[5];
+    for (size_t i = 0; i < 5; i++) {
+        __m128i s = _mm_add_epi64(_mm256_castsi256_si128(a[i]),
+                                  _mm256_extracti128_si256(a[i], 1));
+        s = _mm_add_epi64(s, _mm_unpackhi_epi64(s, s));
+        d[i] = _mm_cvtsi128_si64(s);
+    }
+    for (size_t pass = 0; pass < 2; pass++) {
+        uint64_t c = 0;
+        for (size_t i = 0; i < 5; i++) {
+            d[i] += c;
+            c = d[i] >> 26;
+            d[i] &= POLY_MASK26;
+        }
+        d[0] += c * 5;
+    }
+    /* After two passes the only possible leftover is a tiny carry out
+     * of limb 0, which can go into limb 1 without overflowing it */
+    d[1] += d[0] >> 26;
+    d[0] &= POLY_MASK26;
+    for (size_t i = 0; i < 5; i++)
+        h[i] = d[i];
+
+    smemclr(a, sizeof(a));
+    smemclr(m, sizeof(m));
+    smemclr(d, sizeof(d));
+}
@@ -31,6 +31,7 @@
 
 #include "ssh.h"
 #include "mpint_i.h"
+#include "chacha20.h"
 
 #ifndef INLINE
 #define INLINE
@@ -47,18 +48,21 @@ struct chacha20 {
      * 14-15 are the IV */
     uint32_t state[16];
     /* The output of the state above ready to xor */
-    unsigned char current[64];
-    /* The index of the above currently used to allow a true streaming cipher */
-    int currentIndex;
+    unsigned char current[64 * CHACHA20_MAX_BLOCKS];
+    /* The index of the above currently used to allow a true streaming
+     * cipher, and the amount of it that's valid */
+    size_t currentIndex, currentLen;
+    /* The keystream generator to refill the above with */
+    chacha20_blocks_fn blocks;
 };
 
-static INLINE void chacha20_round(struct chacha20 *ctx)
+static INLINE void chacha20_sw_block(uint32_t *state, unsigned char *out)
 {
     int i;
     uint32_t copy[16];
 
     /* Take a copy */
-    memcpy(copy, ctx->state, sizeof(copy));
+    memcpy(copy, state, sizeof(copy));
 
     /* A circular rotation for a 32bit number */
 #define rotl(x, shift) x = ((x << shift) | (x >> (32 - shift)))
@@ -97,28 +101,49 @@ static INLINE void chacha20_round(struct chacha20 *ctx)
 
     /* Add the initial state */
     for (i = 0; i < 16; ++i) {
-        copy[i] += ctx->state[i];
+        copy[i] += state[i];
     }
 
-    /* Update the content of the xor buffer */
-    for (i = 0; i < 16; ++i) {
-        ctx->current[i * 4 + 0] = copy[i] >> 0;
-        ctx->current[i * 4 + 1] = copy[i] >> 8;
-        ctx->current[i * 4 + 2] = copy[i] >> 16;
-        ctx->current[i * 4 + 3] = copy[i] >> 24;
-    }
-    /* State full, reset pointer to beginning */
-    ctx->currentIndex = 0;
+    /* Write out the keystream block */
+    for (i = 0; i < 16; ++i)
+        PUT_32BIT_LSB_FIRST(out + i * 4, copy[i]);
     smemclr(copy, sizeof(copy));
 
     /* Increment round counter */
-    ++ctx->state[12];
+    ++state[12];
     /* Check for overflow, not done in one line so the 32 bits are chopped by the type */
-    if (!(uint32_t)(ctx->state[12])) {
-        ++ctx->state[13];
+    if (!(uint32_t)(state[12])) {
+        ++state[13];
     }
 }
 
+void chacha20_sw_blocks(uint32_t *state, unsigned char *out, size_t nblocks)
+{
+    for (size_t i = 0; i < nblocks; i++)
+        chacha20_sw_block(state, out + 64 * i);
+}
+
+static bool chacha20_sw_available(void)
+{
+    return true;
+}
+
+/* Refill the keystream buffer with enough blocks to cover len bytes */
+static INLINE void chacha20_round(struct chacha20 *ctx, size_t len)
+{
+    size_t nblocks = (len + 63) / 64;
+    if (nblocks < 1)
+        nblocks = 1;
+    if (nblocks > CHACHA20_MAX_BLOCKS)
+        nblocks = CHACHA20_MAX_BLOCKS;
+
+    ctx->blocks(ctx->state, ctx->current, nblocks);
+
+    /* State full, reset pointer to beginning */
+    ctx->currentIndex = 0;
+    ctx->currentLen = 64 * nblocks;
+}
+
 /* Initialise context with 256bit key */
 static void chacha20_key(struct chacha20 *ctx, const unsigned char *key)
 {
@@ -141,7 +166,7 @@ static void chacha20_key(struct chacha20 *ctx, const unsigned char *key)
     ctx->state[11] = GET_32BIT_LSB_FIRST(key + 28);
 
     /* New key, dump context */
-    ctx->currentIndex = 64;
+    ctx->currentIndex = ctx->currentLen = 0;
 }
 
 static void chacha20_iv(struct chacha20 *ctx, const unsigned char *iv)
@@ -152,22 +177,27 @@ static void chacha20_iv(struct chacha20 *ctx, const unsigned char *iv)
     ctx->state[15] = GET_32BIT_MSB_FIRST(iv + 4);
 
     /* New IV, dump context */
-    ctx->currentIndex = 64;
+    ctx->currentIndex = ctx->currentLen = 0;
 }
 
 static void chacha20_encrypt(struct chacha20 *ctx, unsigned char *blk, int len)
 {
     while (len) {
         /* If we don't have any state left, then cycle to the next */
-        if (ctx->currentIndex >= 64) {
-            chacha20_round(ctx);
+        if (ctx->currentIndex >= ctx->currentLen) {
+            chacha20_round(ctx, len);
         }
 
         /* Do the xor while there's some state left and some plaintext left */
-        while (ctx->currentIndex < 64 && len) {
-            *blk++ ^= ctx->current[ctx->currentIndex++];
-            --len;
-        }
+        size_t n = ctx->currentLen - ctx->currentIndex;
+        if (n > len)
+            n = len;
+        const unsigned char *keystream = ctx->current + ctx->currentIndex;
+        for (size_t i = 0; i < n; i++)
+            blk[i] ^= keystream[i];
+        blk += n;
+        len -= n;
+        ctx->currentIndex += n;
     }
 }
 
@@ -763,8 +793,56 @@ struct poly1305 {
     /* Buffer in case we get less that a multiple of 16 bytes */
     unsigned char buffer[16];
     int bufferIndex;
+
+    /* Multi-block core, if this implementation has one, and the
+     * powers of r it needs, in its 26-bit limb representation */
+    poly1305_blocks_fn blocks;
+    uint32_t rpow[POLY1305_BLOCK_STRIDE][5];
+    bool rpow_ready;
 };
 
+/*
+ * Don't bother with the multi-block core for runs of input shorter
+ * than this. Setting it up costs a few field multiplications to
+ * compute the powers of r, which only pays for itself over a few
+ * strides' worth of data.
+ */
+#define POLY1305_MULTIBLOCK_MIN (4 * 16 * POLY1305_BLOCK_STRIDE)
+
+/*
+ * Conversions between bigval and the five 26-bit limbs used by the
+ * multi-block cores. Both go via a little-endian byte string, so as
+ * not to depend on BIGNUM_INT_BITS. 17 bytes is enough for anything
+ * up to 2^136, which covers every not-fully-reduced value we hold.
+ */
+static void bigval_to_limbs(const bigval *r, uint32_t *limbs)
+{
+    unsigned char bytes[17];
+    bigval_export_le(r, bytes, 17);
+    uint64_t lo = GET_64BIT_LSB_FIRST(bytes);
+    uint64_t hi = GET_64BIT_LSB_FIRST(bytes + 8);
+    limbs[0] = lo & 0x3ffffff;
+    limbs[1] = (lo >> 26) & 0x3ffffff;
+    limbs[2] = ((lo >> 52) | (hi << 12)) & 0x3ffffff;
+    limbs[3] = (hi >> 14) & 0x3ffffff;
+    limbs[4] = (hi >> 40) | ((uint32_t)bytes[16] << 24);
+    smemclr(bytes, sizeof(bytes));
+}
+
+static void bigval_from_limbs(bigval *r, const uint32_t *limbs)
+{
+    unsigned char bytes[17];
+    uint64_t lo = (uint64_t)limbs[0] | ((uint64_t)limbs[1] << 26) |
+        ((uint64_t)limbs[2] << 52);
+    uint64_t hi = ((uint64_t)limbs[2] >> 12) | ((uint64_t)limbs[3] << 14) |
+        ((uint64_t)limbs[4] << 40);
+    PUT_64BIT_LSB_FIRST(bytes, lo);
+    PUT_64BIT_LSB_FIRST(bytes + 8, hi);
+    bytes[16] = limbs[4] >> 24;
+    bigval_import_le(r, bytes, 17);
+    smemclr(bytes, sizeof(bytes));
+}
+
 static void poly1305_init(struct poly1305 *ctx)
 {
     memset(ctx->nonce, 0, 16);
@@ -792,6 +870,10 @@ static void poly1305_key(struct poly1305 *ctx, ptrlen key)
     bigval_import_le(&ctx->r, key_copy, 16);
     smemclr(key_copy, sizeof(key_copy));
 
+    /* The powers of r for the multi-block core are worked out on
+     * first use, since short packets never need them */
+    ctx->rpow_ready = false;
+
     /* Use second 128 bits as the nonce */
     memcpy(ctx->nonce, (const char *)key.ptr + 16, 16);
 }
@@ -808,6 +890,22 @@ static void poly1305_feed_chunk(struct poly1305 *ctx,
     bigval_mul_mod_p(&ctx->h, &c, &ctx->r);
 }
 
+/* Precompute r^1 .. r^4 for the multi-block core */
+static void poly1305_prepare_rpow(struct poly1305 *ctx)
+{
+    bigval rpow = ctx->r, tmp;
+    for (size_t i = 0; i < POLY1305_BLOCK_STRIDE; i++) {
+        if (i)
+            bigval_mul_mod_p(&rpow, &rpow, &ctx->r);
+        tmp = rpow;
+        bigval_final_reduce(&tmp);
+        bigval_to_limbs(&tmp, ctx->rpow[i]);
+    }
+    smemclr(&rpow, sizeof(rpow));
+    smemclr(&tmp, sizeof(tmp));
+    ctx->rpow_ready = true;
+}
+
 static void poly1305_feed(struct poly1305 *ctx,
                           const unsigned char *buf, int len)
 {
@@ -824,6 +922,21 @@ static void poly1305_feed(struct poly1305 *ctx,
         }
     }
 
+    /* Hand as many whole chunks as we can to the multi-block core */
+    if (ctx->blocks && len >= POLY1305_MULTIBLOCK_MIN) {
+        if (!ctx->rpow_ready)
+            poly1305_prepare_rpow(ctx);
+        size_t nblocks = len / (16 * POLY1305_BLOCK_STRIDE) *
+            POLY1305_BLOCK_STRIDE;
+        uint32_t h[5];
+        bigval_to_limbs(&ctx->h, h);
+        ctx->blocks(h, ctx->rpow, buf, nblocks);
+        bigval_from_limbs(&ctx->h, h);
+        smemclr(h, sizeof(h));
+        len -= 16 * nblocks;
+        buf += 16 * nblocks;
+    }
+
     /* Process 16 byte whole chunks */
     while (len >= 16) {
         poly1305_feed_chunk(ctx, buf, 16);
@@ -932,13 +1045,13 @@ static void poly_BinarySink_write(BinarySink *bs, const void *blkv, size_t len)
         ++ctx->mac_initialised;  /* Don't do it again */
 
         /* Do first rotation */
-        chacha20_round(&ctx->b_cipher);
+        chacha20_round(&ctx->b_cipher, 64);
 
         /* Set the poly key */
         poly1305_key(&ctx->mac, make_ptrlen(ctx->b_cipher.current, 32));
 
         /* Set the first round as used */
-        ctx->b_cipher.currentIndex = 64;
+        ctx->b_cipher.currentIndex = ctx->b_cipher.currentLen;
     }
 
     /* Update the MAC with anything left */
@@ -975,9 +1088,16 @@ const ssh2_macalg ssh2_poly1305 = {
 
 static ssh_cipher *ccp_new(const ssh_cipheralg *alg)
 {
+    const struct chacha20_extra *extra =
+        (const struct chacha20_extra *)alg->extra;
+    if (!check_availability(extra))
+        return NULL;
+
     struct ccp_context *ctx = snew(struct ccp_context);
     BinarySink_INIT(ctx, poly_BinarySink_write);
     poly1305_init(&ctx->mac);
+    ctx->a_cipher.blocks = ctx->b_cipher.blocks = extra->blocks;
+    ctx->mac.blocks = extra->poly1305_blocks;
     ctx->ciph.vt = alg;
     ctx->ciph_allocated = true;
     ctx->mac_allocated = false;
@@ -1053,22 +1173,75 @@ static void ccp_decrypt_length(ssh_cipher *cipher, void *blk, int len,
     chacha20_decrypt(&ctx->a_cipher, blk, len);
 }
 
+#define CCP_VTABLE(impl_c, impl_display, poly_blocks)                   \
+    static struct chacha20_extra_mutable chacha20_ ## impl_c ## _extra_mut; \
+    static const struct chacha20_extra chacha20_ ## impl_c ## _extra = { \
+        .check_available = chacha20_ ## impl_c ## _available,           \
+        .mut = &chacha20_ ## impl_c ## _extra_mut,                      \
+        .blocks = chacha20_ ## impl_c ## _blocks,                       \
+        .poly1305_blocks = poly_blocks,                                 \
+    };                                                                  \
+    const ssh_cipheralg ssh2_chacha20_poly1305_ ## impl_c = {           \
+        .new = ccp_new,                                                 \
+        .free = ccp_free,                                               \
+        .setiv = ccp_iv,                                                \
+        .setkey = ccp_key,                                              \
+        .encrypt = ccp_encrypt,                                         \
+        .decrypt = ccp_decrypt,                                         \
+        .encrypt_length = ccp_encrypt_length,                           \
+        .decrypt_length = ccp_decrypt_length,                           \
+        .next_message = nullcipher_next_message,                        \
+        .ssh2_id = "chacha20-poly1305@openssh.com",                     \
+        .blksize = 1,                                                   \
+        .real_keybits = 512,                                            \
+        .padded_keybytes = 64,                                          \
+        .flags = SSH_CIPHER_SEPARATE_LENGTH,                            \
+        .text_name = "ChaCha20 (" impl_display ")",                     \
+        .required_mac = &ssh2_poly1305,                                 \
+        .extra = &chacha20_ ## impl_c ## _extra,                        \
+    }
+
+CCP_VTABLE(sw, "unaccelerated", NULL);
+#if HAVE_CHACHA20_AVX2
+CCP_VTABLE(avx2, "AVX2 accelerated", poly1305_avx2_blocks);
+#endif
+
+/*
+ * Top-level vtable to select a ChaCha20 implementation.
+ */
+
+static ssh_cipher *ccp_select(const ssh_cipheralg *alg)
+{
+    static const ssh_cipheralg *const real_algs[] = {
+#if HAVE_CHACHA20_AVX2
+        &ssh2_chacha20_poly1305_avx2,
+#endif
+        &ssh2_chacha20_poly1305_sw,
+        NULL,
+    };
+
+    for (size_t i = 0; real_algs[i]; i++) {
+        const ssh_cipheralg *alg = real_algs[i];
+        const struct chacha20_extra *alg_extra =
+            (const struct chacha20_extra *)alg->extra;
+        if (check_availability(alg_extra))
+            return ssh_cipher_new(alg);
+    }
+
+    /* We should never reach the NULL at the end of the list, because
+     * the last non-NULL entry should be software-only ChaCha20, which
+     * is always available. */
+    unreachable("ccp_select ran off the end of its list");
+}
+
 const ssh_cipheralg ssh2_chacha20_poly1305 = {
-    .new = ccp_new,
-    .free = ccp_free,
-    .setiv = ccp_iv,
-    .setkey = ccp_key,
-    .encrypt = ccp_encrypt,
-    .decrypt = ccp_decrypt,
-    .encrypt_length = ccp_encrypt_length,
-    .decrypt_length = ccp_decrypt_length,
-    .next_message = nullcipher_next_message,
+    .new = ccp_select,
     .ssh2_id = "chacha20-poly1305@openssh.com",
     .blksize = 1,
     .real_keybits = 512,
     .padded_keybytes = 64,
     .flags = SSH_CIPHER_SEPARATE_LENGTH,
-    .text_name = "ChaCha20",
+    .text_name = "ChaCha20 (dummy selector vtable)",
     .required_mac = &ssh2_poly1305,
 };
 
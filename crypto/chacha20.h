@@ -0,0 +1,92 @@
+/*
+ * Definitions likely to be helpful to multiple ChaCha20-Poly1305
+ * implementations.
+ */
+
+/*
+ * The largest number of 64-byte keystream blocks that any
+ * implementation is asked to generate in one go. This is the width
+ * of the widest SIMD implementation, so that it can fill its whole
+ * vector in a single pass.
+ */
+#define CHACHA20_MAX_BLOCKS 8
+
+/*
+ * Function type for the core keystream generator. It's given the 16
+ * words of ChaCha20 state, and writes 'nblocks' consecutive blocks of
+ * keystream (1 <= nblocks <= CHACHA20_MAX_BLOCKS) to 'out', starting
+ * from the block counter in state[12] and state[13]. On return, the
+ * counter in the state has been advanced by 'nblocks'.
+ */
+typedef void (*chacha20_blocks_fn)(
+    uint32_t *state, unsigned char *out, size_t nblocks);
+
+/*
+ * Function type for a multi-block Poly1305 core. Numbers mod 2^130-5
+ * are passed to it as five 26-bit limbs, least significant first.
+ *
+ * 'h' is the running accumulator, updated in place. 'rpow' holds the
+ * powers r^1, r^2, r^3, r^4 of the key, each fully reduced. 'msg'
+ * points to 'nblocks' complete 16-byte message blocks, where nblocks
+ * is a nonzero multiple of POLY1305_BLOCK_STRIDE; each block gets the
+ * usual 2^128 bit added before being absorbed.
+ *
+ * On return, h holds the same value (mod p) as if the blocks had been
+ * absorbed one at a time, with every limb less than 2^26.
+ */
+#define POLY1305_BLOCK_STRIDE 4
+typedef void (*poly1305_blocks_fn)(
+    uint32_t *h, const uint32_t (*rpow)[5],
+    const unsigned char *msg, size_t nblocks);
+
+/*
+ * The 'extra' structure used by ChaCha20 implementations is used to
+ * include information about how to check if a given implementation is
+ * available at run time, and whether we've already checked.
+ */
+struct chacha20_extra_mutable;
+struct chacha20_extra {
+    /* Function to check availability. Might be expensive, so we don't
+     * want to call it more than once. */
+    bool (*check_available)(void);
+
+    /* Point to a writable substructure. */
+    struct chacha20_extra_mutable *mut;
+
+    /* The keystream generator for this implementation. */
+    chacha20_blocks_fn blocks;
+
+    /* The multi-block Poly1305 core to go with it, or NULL to absorb
+     * every block with the portable code. */
+    poly1305_blocks_fn poly1305_blocks;
+};
+struct chacha20_extra_mutable {
+    bool checked_availability;
+    bool is_available;
+};
+static inline bool check_availability(const struct chacha20_extra *extra)
+{
+    if (!extra->mut->checked_availability) {
+        extra->mut->is_available = extra->check_available();
+        extra->mut->checked_availability = true;
+    }
+
+    return extra->mut->is_available;
+}
+
+/*
+ * The portable keystream generator, which the accelerated versions
+ * can fall back to when asked for too few blocks to be worth setting
+ * up a full-width SIMD pass.
+ */
+void chacha20_sw_blocks(uint32_t *state, unsigned char *out, size_t nblocks);
+
+/*
+ * Entry points to the hardware-accelerated implementations, which
+ * live in separate source files so they can be compiled with the
+ * right instruction-set options.
+ */
+bool chacha20_avx2_available(void);
+void chacha20_avx2_blocks(uint32_t *state, unsigned char *out, size_t nblocks);
+void poly1305_avx2_blocks(uint32_t *h, const uint32_t (*rpow)[5],
+                          const unsigned char *msg, size_t nblocks);
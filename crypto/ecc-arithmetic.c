@@ -8,6 +8,37 @@
 #include "mpint.h"
 #include "ecc.h"
 
+/* ----------------------------------------------------------------------
+ * Helpers shared between the fixed-base tables for the various curve
+ * types below.
+ *
+ * A fixed-base table for a point B stores j * 16^i * B for every
+ * 4-bit digit position i in the scalars it supports and every digit
+ * value 0 <= j < 16. Then n*B is just the sum over i of one table
+ * entry per digit of n, which takes one point addition per 4 bits of
+ * n instead of the ladder's one addition and one doubling per bit.
+ *
+ * To keep this time-safe, every entry for a digit position is read,
+ * and the right one selected using mp_select_into.
+ */
+
+#define BASE_TABLE_DIGIT_BITS 4
+#define BASE_TABLE_ENTRIES (1 << BASE_TABLE_DIGIT_BITS)
+
+static inline unsigned base_table_digit(mp_int *n, size_t pos)
+{
+    unsigned digit = 0;
+    for (unsigned i = 0; i < BASE_TABLE_DIGIT_BITS; i++)
+        digit |= mp_get_bit(n, pos * BASE_TABLE_DIGIT_BITS + i) << i;
+    return digit;
+}
+
+/* Returns 1 if x == y, or 0 otherwise, for x,y < BASE_TABLE_ENTRIES */
+static inline unsigned base_table_digit_eq(unsigned x, unsigned y)
+{
+    return 1 & (((x ^ y) - 1) >> BASE_TABLE_DIGIT_BITS);
+}
+
 /* ----------------------------------------------------------------------
  * Weierstrass curves.
  */
@@ -394,9 +425,13 @@ WeierstrassPoint *ecc_weierstrass_add_general(
     ecc_weierstrass_add_prologue(
         P, Q, &Px, &Py, &Qx, &denom, &lambda_n, &lambda_d);
 
-    /* Slope if P == Q */
+    /* Slope if P == Q. This has to be the slope for P as represented
+     * over the common denominator, because that's the representation
+     * the epilogue will combine it with. */
+    WeierstrassPoint P_common = { .X = Px, .Y = Py, .Z = denom, .wc = wc };
     mp_int *lambda_n_tangent, *lambda_d_tangent;
-    ecc_weierstrass_tangent_slope(P, &lambda_n_tangent, &lambda_d_tangent);
+    ecc_weierstrass_tangent_slope(
+        &P_common, &lambda_n_tangent, &lambda_d_tangent);
 
     /* Select between those slopes depending on whether P == Q */
     unsigned same_x_coord = mp_eq_integer(lambda_d, 0);
@@ -472,6 +507,80 @@ WeierstrassPoint *ecc_weierstrass_multiply(WeierstrassPoint *B, mp_int *n)
     return k_B;
 }
 
+struct WeierstrassBaseTable {
+    /* The base point itself, for scalars too big for the table */
+    WeierstrassPoint *B;
+
+    size_t nbits, ndigits;
+    WeierstrassPoint **entries;
+};
+
+WeierstrassBaseTable *ecc_weierstrass_base_table_new(
+    WeierstrassPoint *B, size_t nbits)
+{
+    WeierstrassBaseTable *bt = snew(WeierstrassBaseTable);
+    bt->B = ecc_weierstrass_point_copy(B);
+    bt->ndigits = (nbits + BASE_TABLE_DIGIT_BITS - 1) / BASE_TABLE_DIGIT_BITS;
+    bt->nbits = bt->ndigits * BASE_TABLE_DIGIT_BITS;
+    bt->entries = snewn(bt->ndigits * BASE_TABLE_ENTRIES, WeierstrassPoint *);
+
+    /* Nothing here is secret, so add_general's generality is all we
+     * need to worry about, not its speed */
+    WeierstrassPoint *base = ecc_weierstrass_point_copy(B);
+    for (size_t i = 0; i < bt->ndigits; i++) {
+        WeierstrassPoint **row = bt->entries + i * BASE_TABLE_ENTRIES;
+        row[0] = ecc_weierstrass_point_new_identity(B->wc);
+        for (size_t j = 1; j < BASE_TABLE_ENTRIES; j++)
+            row[j] = ecc_weierstrass_add_general(row[j-1], base);
+        WeierstrassPoint *next = ecc_weierstrass_add_general(
+            row[BASE_TABLE_ENTRIES - 1], base);
+        ecc_weierstrass_point_free(base);
+        base = next;
+    }
+    ecc_weierstrass_point_free(base);
+
+    return bt;
+}
+
+void ecc_weierstrass_base_table_free(WeierstrassBaseTable *bt)
+{
+    ecc_weierstrass_point_free(bt->B);
+    for (size_t i = 0; i < bt->ndigits * BASE_TABLE_ENTRIES; i++)
+        ecc_weierstrass_point_free(bt->entries[i]);
+    sfree(bt->entries);
+    sfree(bt);
+}
+
+WeierstrassPoint *ecc_weierstrass_multiply_base(
+    WeierstrassBaseTable *bt, mp_int *n)
+{
+    /* The size of n is public, even if its value isn't */
+    if (mp_max_bits(n) > bt->nbits)
+        return ecc_weierstrass_multiply(bt->B, n);
+
+    WeierstrassPoint *acc = ecc_weierstrass_point_new_identity(bt->B->wc);
+    WeierstrassPoint *sel = ecc_weierstrass_point_new_identity(bt->B->wc);
+
+    for (size_t i = 0; i < bt->ndigits; i++) {
+        WeierstrassPoint **row = bt->entries + i * BASE_TABLE_ENTRIES;
+        unsigned digit = base_table_digit(n, i);
+
+        ecc_weierstrass_point_copy_into(sel, row[0]);
+        for (unsigned j = 1; j < BASE_TABLE_ENTRIES; j++)
+            ecc_weierstrass_cond_overwrite(
+                sel, row[j], base_table_digit_eq(digit, j));
+
+        /* add_general, because acc starts off as the identity, and
+         * any digit might be zero */
+        WeierstrassPoint *sum = ecc_weierstrass_add_general(acc, sel);
+        ecc_weierstrass_point_free(acc);
+        acc = sum;
+    }
+
+    ecc_weierstrass_point_free(sel);
+    return acc;
+}
+
 unsigned ecc_weierstrass_is_identity(WeierstrassPoint *wp)
 {
     return mp_eq_integer(wp->Z, 0);
@@ -1133,6 +1242,79 @@ EdwardsPoint *ecc_edwards_multiply(EdwardsPoint *B, mp_int *n)
     return k_B;
 }
 
+struct EdwardsBaseTable {
+    /* The base point itself, for scalars too big for the table */
+    EdwardsPoint *B;
+
+    size_t nbits, ndigits;
+    EdwardsPoint **entries;
+};
+
+EdwardsBaseTable *ecc_edwards_base_table_new(EdwardsPoint *B, size_t nbits)
+{
+    EdwardsBaseTable *bt = snew(EdwardsBaseTable);
+    bt->B = ecc_edwards_point_copy(B);
+    bt->ndigits = (nbits + BASE_TABLE_DIGIT_BITS - 1) / BASE_TABLE_DIGIT_BITS;
+    bt->nbits = bt->ndigits * BASE_TABLE_DIGIT_BITS;
+    bt->entries = snewn(bt->ndigits * BASE_TABLE_ENTRIES, EdwardsPoint *);
+
+    mp_int *zero = mp_from_integer(0), *one = mp_from_integer(1);
+    EdwardsPoint *base = ecc_edwards_point_copy(B);
+    for (size_t i = 0; i < bt->ndigits; i++) {
+        EdwardsPoint **row = bt->entries + i * BASE_TABLE_ENTRIES;
+        row[0] = ecc_edwards_point_new(B->ec, zero, one); /* identity */
+        for (size_t j = 1; j < BASE_TABLE_ENTRIES; j++)
+            row[j] = ecc_edwards_add(row[j-1], base);
+        EdwardsPoint *next = ecc_edwards_add(row[BASE_TABLE_ENTRIES - 1], base);
+        ecc_edwards_point_free(base);
+        base = next;
+    }
+    ecc_edwards_point_free(base);
+    mp_free(zero);
+    mp_free(one);
+
+    return bt;
+}
+
+void ecc_edwards_base_table_free(EdwardsBaseTable *bt)
+{
+    ecc_edwards_point_free(bt->B);
+    for (size_t i = 0; i < bt->ndigits * BASE_TABLE_ENTRIES; i++)
+        ecc_edwards_point_free(bt->entries[i]);
+    sfree(bt->entries);
+    sfree(bt);
+}
+
+EdwardsPoint *ecc_edwards_multiply_base(EdwardsBaseTable *bt, mp_int *n)
+{
+    /* The size of n is public, even if its value isn't */
+    if (mp_max_bits(n) > bt->nbits)
+        return ecc_edwards_multiply(bt->B, n);
+
+    /* Edwards addition is unified, so unlike the Weierstrass case, we
+     * can use the ordinary add function even when the accumulator or
+     * the selected entry is the identity */
+    EdwardsPoint *acc = ecc_edwards_point_copy(bt->entries[0]);
+    EdwardsPoint *sel = ecc_edwards_point_copy(bt->entries[0]);
+
+    for (size_t i = 0; i < bt->ndigits; i++) {
+        EdwardsPoint **row = bt->entries + i * BASE_TABLE_ENTRIES;
+        unsigned digit = base_table_digit(n, i);
+
+        ecc_edwards_point_copy_into(sel, row[0]);
+        for (unsigned j = 1; j < BASE_TABLE_ENTRIES; j++)
+            ecc_edwards_cond_overwrite(
+                sel, row[j], base_table_digit_eq(digit, j));
+
+        EdwardsPoint *sum = ecc_edwards_add(acc, sel);
+        ecc_edwards_point_free(acc);
+        acc = sum;
+    }
+
+    ecc_edwards_point_free(sel);
+    return acc;
+}
+
 /*
  * Helper routine to determine whether two values each given as a pair
  * of projective coordinates represent the same affine value.
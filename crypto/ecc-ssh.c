@@ -333,6 +333,29 @@ struct ecsign_extra {
     ptrlen hash_prefix;
 };
 
+/*
+ * Multiply a curve's generator by an integer, using a table of
+ * precomputed multiples which is built the first time it's needed and
+ * kept for the life of the process. Used for signing and ECDH key
+ * generation, which multiply the same generator over and over by
+ * integers less than its order.
+ */
+static WeierstrassPoint *ecdsa_multiply_G(struct ec_curve *curve, mp_int *n)
+{
+    if (!curve->w.G_table)
+        curve->w.G_table = ecc_weierstrass_base_table_new(
+            curve->w.G, mp_max_bits(curve->w.G_order));
+    return ecc_weierstrass_multiply_base(curve->w.G_table, n);
+}
+
+static EdwardsPoint *eddsa_multiply_G(struct ec_curve *curve, mp_int *n)
+{
+    if (!curve->e.G_table)
+        curve->e.G_table = ecc_edwards_base_table_new(
+            curve->e.G, mp_max_bits(curve->e.G_order));
+    return ecc_edwards_multiply_base(curve->e.G_table, n);
+}
+
 WeierstrassPoint *ecdsa_public(mp_int *private_key, const ssh_keyalg *alg)
 {
     const struct ecsign_extra *extra =
@@ -1137,7 +1160,7 @@ static void ecdsa_sign(ssh_key *key, ptrlen data,
             ek->privateKey, digest, sizeof(digest));
     }
 
-    WeierstrassPoint *kG = ecc_weierstrass_multiply(ek->curve->w.G, k);
+    WeierstrassPoint *kG = ecdsa_multiply_G(extra->curve(), k);
     mp_int *x;
     ecc_weierstrass_get_affine(kG, &x, NULL);
     ecc_weierstrass_point_free(kG);
@@ -1219,7 +1242,7 @@ static void eddsa_sign(ssh_key *key, ptrlen data,
         make_ptrlen(hash, extra->hash->hlen));
     mp_int *log_r = mp_mod(log_r_unreduced, ek->curve->e.G_order);
     mp_free(log_r_unreduced);
-    EdwardsPoint *r = ecc_edwards_multiply(ek->curve->e.G, log_r);
+    EdwardsPoint *r = eddsa_multiply_G(extra->curve(), log_r);
 
     /*
      * Encode r now, because we'll need its encoding for the next
@@ -1424,6 +1447,12 @@ const ssh_keyalg ssh_ecdsa_nistp521 = {
 
 struct eckex_extra {
     struct ec_curve *(*curve)(void);
+
+    /* Optional specialised implementation of Montgomery multiplication
+     * for this curve, taking and returning fieldBytes-long
+     * little-endian strings, or NULL to use the general code */
+    void (*m_multiply)(unsigned char *out, const unsigned char *scalar,
+                       const unsigned char *point);
 };
 
 typedef struct ecdh_key_w {
@@ -1441,6 +1470,9 @@ typedef struct ecdh_key_m {
     mp_int *private;
     MontgomeryPoint *m_public;
 
+    /* Used instead of m_public if extra->m_multiply is available */
+    unsigned char *m_public_bytes;
+
     ecdh_key ek;
 } ecdh_key_m;
 
@@ -1458,7 +1490,7 @@ static ecdh_key *ssh_ecdhkex_w_new(const ssh_kex *kex, bool is_server)
     dhw->private = mp_random_in_range(one, dhw->curve->w.G_order);
     mp_free(one);
 
-    dhw->w_public = ecc_weierstrass_multiply(dhw->curve->w.G, dhw->private);
+    dhw->w_public = ecdsa_multiply_G(extra->curve(), dhw->private);
 
     return &dhw->ek;
 }
@@ -1490,7 +1522,31 @@ static ecdh_key *ssh_ecdhkex_m_new(const ssh_kex *kex, bool is_server)
 
     strbuf_free(bytes);
 
-    dhm->m_public = ecc_montgomery_multiply(dhm->curve->m.G, dhm->private);
+    if (extra->m_multiply) {
+        size_t len = dhm->curve->fieldBytes;
+        unsigned char *scalar = snewn(len, unsigned char);
+        unsigned char *base = snewn(len, unsigned char);
+        mp_int *G_x;
+
+        ecc_montgomery_get_affine(dhm->curve->m.G, &G_x);
+        for (size_t i = 0; i < len; i++) {
+            scalar[i] = mp_get_byte(dhm->private, i);
+            base[i] = mp_get_byte(G_x, i);
+        }
+        mp_free(G_x);
+
+        dhm->m_public = NULL;
+        dhm->m_public_bytes = snewn(len, unsigned char);
+        extra->m_multiply(dhm->m_public_bytes, scalar, base);
+
+        smemclr(scalar, len);
+        sfree(scalar);
+        sfree(base);
+    } else {
+        dhm->m_public = ecc_montgomery_multiply(
+            dhm->curve->m.G, dhm->private);
+        dhm->m_public_bytes = NULL;
+    }
 
     return &dhm->ek;
 }
@@ -1504,6 +1560,10 @@ static void ssh_ecdhkex_w_getpublic(ecdh_key *dh, BinarySink *bs)
 static void ssh_ecdhkex_m_getpublic(ecdh_key *dh, BinarySink *bs)
 {
     ecdh_key_m *dhm = container_of(dh, ecdh_key_m, ek);
+    if (dhm->m_public_bytes) {
+        put_data(bs, dhm->m_public_bytes, dhm->curve->fieldBytes);
+        return;
+    }
     mp_int *x;
     ecc_montgomery_get_affine(dhm->m_public, &x);
     for (size_t i = 0; i < dhm->curve->fieldBytes; ++i)
@@ -1539,11 +1599,76 @@ static bool ssh_ecdhkex_w_getkey(ecdh_key *dh, ptrlen remoteKey,
     return true;
 }
 
+/*
+ * Finish off a Montgomery kex, given the shared secret x-coordinate as
+ * a little-endian byte string.
+ */
+static void ssh_ecdhkex_m_put_secret(const unsigned char *xbytes,
+                                     size_t len, BinarySink *bs)
+{
+    /*
+     * Endianness-swap. The Curve25519 algorithm definition assumes
+     * you were doing your computation in arrays of 32 little-endian
+     * bytes, and now specifies that you take your final one of those
+     * and convert it into a bignum in _network_ byte order, i.e.
+     * big-endian.
+     *
+     * In particular, the spec says, you convert the _whole_ 32 bytes
+     * into a bignum. That is, on the rare occasions that x has come
+     * out with the most significant 8 bits zero, we have to imagine
+     * that being represented by a 32-byte string with the last byte
+     * being zero, so that has to be converted into an SSH-2 bignum
+     * with the _low_ byte zero, i.e. a multiple of 256.
+     */
+    mp_int *x = mp_from_bytes_be(make_ptrlen(xbytes, len));
+    put_mp_ssh2(bs, x);
+    mp_free(x);
+}
+
+static bool ssh_ecdhkex_m_getkey_fast(ecdh_key_m *dhm, ptrlen remoteKey,
+                                      BinarySink *bs)
+{
+    size_t len = dhm->curve->fieldBytes;
+    unsigned char *scalar = snewn(len, unsigned char);
+    unsigned char *point = snewn(len, unsigned char);
+    unsigned char *result = snewn(len, unsigned char);
+
+    for (size_t i = 0; i < len; i++) {
+        scalar[i] = mp_get_byte(dhm->private, i);
+        point[i] = i < remoteKey.len ?
+            ((const unsigned char *)remoteKey.ptr)[i] : 0;
+    }
+
+    /* As in the general case below, input bits beyond fieldBits are
+     * discarded: we drop any excess bytes here, and the multiplication
+     * function ignores the top bit of the last one. */
+    dhm->extra->m_multiply(result, scalar, point);
+
+    /* An all-zero output means we've hit the identity */
+    unsigned char nonzero = 0;
+    for (size_t i = 0; i < len; i++)
+        nonzero |= result[i];
+
+    bool ok = nonzero != 0;
+    if (ok)
+        ssh_ecdhkex_m_put_secret(result, len, bs);
+
+    smemclr(scalar, len);
+    smemclr(result, len);
+    sfree(scalar);
+    sfree(point);
+    sfree(result);
+    return ok;
+}
+
 static bool ssh_ecdhkex_m_getkey(ecdh_key *dh, ptrlen remoteKey,
                                  BinarySink *bs)
 {
     ecdh_key_m *dhm = container_of(dh, ecdh_key_m, ek);
 
+    if (dhm->extra->m_multiply)
+        return ssh_ecdhkex_m_getkey_fast(dhm, remoteKey, bs);
+
     mp_int *remote_x = mp_from_bytes_le(remoteKey);
 
     /* Per RFC 7748 section 5, discard any set bits of the other
@@ -1571,28 +1696,12 @@ static bool ssh_ecdhkex_m_getkey(ecdh_key *dh, ptrlen remoteKey,
     ecc_montgomery_point_free(remote_p);
     ecc_montgomery_point_free(p);
 
-    /*
-     * Endianness-swap. The Curve25519 algorithm definition assumes
-     * you were doing your computation in arrays of 32 little-endian
-     * bytes, and now specifies that you take your final one of those
-     * and convert it into a bignum in _network_ byte order, i.e.
-     * big-endian.
-     *
-     * In particular, the spec says, you convert the _whole_ 32 bytes
-     * into a bignum. That is, on the rare occasions that x has come
-     * out with the most significant 8 bits zero, we have to imagine
-     * that being represented by a 32-byte string with the last byte
-     * being zero, so that has to be converted into an SSH-2 bignum
-     * with the _low_ byte zero, i.e. a multiple of 256.
-     */
-    strbuf *sb = strbuf_new();
+    strbuf *sb = strbuf_new_nm();
     for (size_t i = 0; i < dhm->curve->fieldBytes; ++i)
         put_byte(sb, mp_get_byte(x, i));
     mp_free(x);
-    x = mp_from_bytes_be(ptrlen_from_strbuf(sb));
+    ssh_ecdhkex_m_put_secret(sb->u, sb->len, bs);
     strbuf_free(sb);
-    put_mp_ssh2(bs, x);
-    mp_free(x);
 
     return true;
 }
@@ -1609,7 +1718,9 @@ static void ssh_ecdhkex_m_free(ecdh_key *dh)
 {
     ecdh_key_m *dhm = container_of(dh, ecdh_key_m, ek);
     mp_free(dhm->private);
-    ecc_montgomery_point_free(dhm->m_public);
+    if (dhm->m_public)
+        ecc_montgomery_point_free(dhm->m_public);
+    sfree(dhm->m_public_bytes);
     sfree(dhm);
 }
 
@@ -1620,7 +1731,9 @@ static char *ssh_ecdhkex_description(const ssh_kex *kex)
     return dupprintf("ECDH key exchange with curve %s", curve->textname);
 }
 
-static const struct eckex_extra kex_extra_curve25519 = { ec_curve25519 };
+static const struct eckex_extra kex_extra_curve25519 = {
+    ec_curve25519, x25519_scalarmult,
+};
 
 static const ecdh_keyalg ssh_ecdhkex_m_alg = {
     .new = ssh_ecdhkex_m_new,
@@ -96,6 +96,18 @@ WeierstrassPoint *ecc_weierstrass_double(WeierstrassPoint *);
  */
 WeierstrassPoint *ecc_weierstrass_multiply(WeierstrassPoint *, mp_int *);
 
+/*
+ * Precompute a table of multiples of a fixed point B, to make later
+ * multiplications of B by integers of up to 'nbits' bits faster.
+ * Multiplying by a larger integer still works, but falls back to
+ * ecc_weierstrass_multiply.
+ */
+WeierstrassBaseTable *ecc_weierstrass_base_table_new(
+    WeierstrassPoint *B, size_t nbits);
+void ecc_weierstrass_base_table_free(WeierstrassBaseTable *bt);
+WeierstrassPoint *ecc_weierstrass_multiply_base(
+    WeierstrassBaseTable *bt, mp_int *n);
+
 /*
  * Query functions to get the value of a point back out. is_identity
  * tells you whether the point is the identity; if it isn't, then
@@ -175,6 +187,19 @@ void ecc_montgomery_get_affine(MontgomeryPoint *mp, mp_int **x);
  */
 unsigned ecc_montgomery_is_identity(MontgomeryPoint *mp);
 
+/*
+ * The X25519 function from RFC 7748, i.e. Montgomery multiplication
+ * on Curve25519 in particular, implemented separately in x25519.c
+ * with arithmetic specialised to that curve's field.
+ *
+ * All three arguments are 32-byte little-endian strings. The scalar
+ * is clamped as the RFC specifies, and the top bit of the input
+ * x-coordinate is ignored. The output is fully reduced mod p, and is
+ * zero if the result is the curve identity.
+ */
+void x25519_scalarmult(unsigned char *out, const unsigned char *scalar,
+                       const unsigned char *point);
+
 /* ----------------------------------------------------------------------
  * Twisted Edwards curves.
  *
@@ -233,6 +258,14 @@ void ecc_edwards_point_free(EdwardsPoint *point);
 EdwardsPoint *ecc_edwards_add(EdwardsPoint *, EdwardsPoint *);
 EdwardsPoint *ecc_edwards_multiply(EdwardsPoint *, mp_int *);
 
+/*
+ * Fixed-base multiplication using a precomputed table, exactly as for
+ * Weierstrass curves.
+ */
+EdwardsBaseTable *ecc_edwards_base_table_new(EdwardsPoint *B, size_t nbits);
+void ecc_edwards_base_table_free(EdwardsBaseTable *bt);
+EdwardsPoint *ecc_edwards_multiply_base(EdwardsBaseTable *bt, mp_int *n);
+
 /*
  * Query functions: compare two points for equality, and return the
  * affine coordinates of a point.
@@ -183,6 +183,102 @@ static unsigned iszero(uint16_t x)
  * algorithm.
  */
 
+/*
+ * Reduce a value mod q which may be too large to pass to reduce()
+ * directly, by splitting it into 16-bit halves. This works for any x
+ * up to 2^32 q, which is far more than we need.
+ */
+static uint16_t reduce_wide(uint64_t x, uint16_t q, uint64_t qrecip)
+{
+    uint16_t hi = reduce(x >> 16, q, qrecip);
+    uint16_t radix = reduce(0x10000, q, qrecip);
+    return reduce((uint32_t)hi * radix + (x & 0xFFFF), q, qrecip);
+}
+
+/*
+ * Below this many coefficients, polynomial_multiply just does
+ * schoolbook multiplication, because the extra additions in
+ * Karatsuba cost more than the multiplications they save.
+ */
+#define KARATSUBA_THRESHOLD 32
+
+/*
+ * Amount of scratch space polynomial_multiply needs for inputs of
+ * length n: each level of recursion needs 4*ceil(n/2) words for the
+ * sums of the two halves and their product, plus whatever the level
+ * below it needs.
+ */
+static size_t polynomial_multiply_scratch(unsigned n)
+{
+    size_t total = 0;
+    while (n > KARATSUBA_THRESHOLD) {
+        n = (n + 1) / 2;
+        total += 4 * n;
+    }
+    return total;
+}
+
+/*
+ * Compute the ordinary product of two polynomials with n coefficients
+ * each, writing its 2n-1 coefficients to out[0], ..., out[2n-2], and
+ * setting out[2n-1] to zero.
+ *
+ * Everything here is plain integer arithmetic, with no reduction mod
+ * q at all. The coefficients of the sums of halves formed at each
+ * level of recursion can get bigger than the inputs, and the
+ * subtraction in the middle of Karatsuba can go negative in the
+ * uint64_t sense. But the true integer value of every output
+ * coefficient is a sum of at most n products of input coefficients,
+ * which for the sizes we use is nowhere near 2^64, so arithmetic mod
+ * 2^64 still gets the exact answer.
+ *
+ * The sequence of operations depends only on n, so this is as
+ * time-safe as the schoolbook loop it replaced.
+ */
+static void polynomial_multiply(uint64_t *out, const uint64_t *a,
+                                const uint64_t *b, unsigned n,
+                                uint64_t *scratch)
+{
+    if (n <= KARATSUBA_THRESHOLD) {
+        for (unsigned i = 0; i < 2*n; i++)
+            out[i] = 0;
+        for (unsigned i = 0; i < n; i++)
+            for (unsigned j = 0; j < n; j++)
+                out[i+j] += a[i] * b[j];
+        return;
+    }
+
+    /*
+     * Split each input into a low half of length h and a high half of
+     * length l <= h. Writing X = x^h, we have
+     *
+     *   (a0 + a1 X)(b0 + b1 X) = z0 + (z1 - z0 - z2) X + z2 X^2
+     *
+     * where z0 = a0 b0, z2 = a1 b1, and z1 = (a0+a1)(b0+b1).
+     */
+    unsigned h = (n + 1) / 2, l = n - h;
+    uint64_t *asum = scratch, *bsum = asum + h, *z1 = bsum + h;
+    uint64_t *next = z1 + 2*h;
+
+    for (unsigned i = 0; i < h; i++) {
+        asum[i] = a[i] + (i < l ? a[h+i] : 0);
+        bsum[i] = b[i] + (i < l ? b[h+i] : 0);
+    }
+
+    /* z0 and z2 go straight into the low and high parts of the output */
+    polynomial_multiply(out, a, b, h, next);
+    polynomial_multiply(out + 2*h, a + h, b + h, l, next);
+    polynomial_multiply(z1, asum, bsum, h, next);
+
+    for (unsigned i = 0; i < 2*h; i++) {
+        z1[i] -= out[i];
+        if (i < 2*l)
+            z1[i] -= out[2*h + i];
+    }
+    for (unsigned i = 0; i < 2*h; i++)
+        out[h + i] += z1[i];
+}
+
 /*
  * Multiply two elements of a quotient ring.
  *
@@ -196,20 +292,28 @@ void ntru_ring_multiply(uint16_t *out, const uint16_t *a, const uint16_t *b,
     SETUP;
 
     /*
-     * Strategy: just compute the full product with 2p coefficients,
-     * and then reduce it mod x^p-x-1 by working downwards from the
-     * top coefficient replacing x^{p+k} with (x+1)x^k for k = ...,1,0.
+     * Strategy: compute the full product with 2p coefficients, using
+     * Karatsuba multiplication over the integers, and then reduce it
+     * mod x^p-x-1 by working downwards from the top coefficient
+     * replacing x^{p+k} with (x+1)x^k for k = ...,1,0. Only after that
+     * do we reduce the coefficients mod q.
      *
-     * Possibly some speed could be gained here by doing the recursive
-     * Karatsuba optimisation for the initial multiplication? But I
-     * haven't tried it.
+     * Each coefficient of the full product is at most p(q-1)^2, and
+     * the folding step only makes that a few times bigger, so for the
+     * parameters we use everything stays well inside the range of
+     * reduce_wide.
      */
-    uint32_t *unreduced = snewn(2*p, uint32_t);
-    for (unsigned i = 0; i < 2*p; i++)
-        unreduced[i] = 0;
-    for (unsigned i = 0; i < p; i++)
-        for (unsigned j = 0; j < p; j++)
-            unreduced[i+j] = REDUCE(unreduced[i+j] + a[i] * b[j]);
+    size_t scratchlen = polynomial_multiply_scratch(p);
+    size_t alloclen = 2*p + 2*p + scratchlen;
+    uint64_t *space = snewn(alloclen, uint64_t);
+    uint64_t *a64 = space, *b64 = a64 + p, *unreduced = b64 + p;
+    uint64_t *scratch = unreduced + 2*p;
+
+    for (unsigned i = 0; i < p; i++) {
+        a64[i] = a[i];
+        b64[i] = b[i];
+    }
+    polynomial_multiply(unreduced, a64, b64, p, scratch);
 
     for (unsigned i = 2*p - 1; i >= p; i--) {
         unreduced[i-p] += unreduced[i];
@@ -218,10 +322,10 @@ void ntru_ring_multiply(uint16_t *out, const uint16_t *a, const uint16_t *b,
     }
 
     for (unsigned i = 0; i < p; i++)
-        out[i] = REDUCE(unreduced[i]);
+        out[i] = reduce_wide(unreduced[i], q, qrecip);
 
-    smemclr(unreduced, 2*p * sizeof(*unreduced));
-    sfree(unreduced);
+    smemclr(space, alloclen * sizeof(*space));
+    sfree(space);
 }
 
 /*
@@ -0,0 +1,396 @@
+/*
+ * Implementation of the X25519 function from RFC 7748, with field
+ * arithmetic specialised to the prime 2^255-19.
+ *
+ * The general-purpose Montgomery curve code in ecc-arithmetic.c does
+ * the same job via mp_int and Montgomery multiplication, which is
+ * flexible but spends most of its time on bookkeeping that a fixed
+ * modulus doesn't need. Here, a field element is five limbs of 51
+ * bits each, so that the product of two limbs fits in 128 bits with
+ * room to accumulate several of them, and reduction mod p is just a
+ * matter of multiplying the overflow by 19 (since 2^255 = 19 mod p)
+ * and adding it back in at the bottom.
+ *
+ * Like the general code, everything here is time-safe: the sequence
+ * of operations and memory accesses doesn't depend on the scalar or
+ * the input point.
+ */
+
+#include "ssh.h"
+#include "ecc.h"
+
+/* ----------------------------------------------------------------------
+ * 64x64 -> 128 bit multiplication and accumulation.
+ *
+ * On compilers with a native 128-bit type these are all trivial. On
+ * others, we make do with a pair of 64-bit words and build the
+ * multiplication out of 32-bit pieces.
+ */
+
+#if defined __SIZEOF_INT128__
+
+typedef __uint128_t dbl;
+
+static inline dbl dbl_mul(uint64_t a, uint64_t b)
+{
+    return (dbl)a * b;
+}
+static inline dbl dbl_add(dbl a, dbl b)
+{
+    return a + b;
+}
+static inline dbl dbl_add_small(dbl a, uint64_t b)
+{
+    return a + b;
+}
+static inline uint64_t dbl_lo(dbl a)
+{
+    return (uint64_t)a;
+}
+static inline uint64_t dbl_shr(dbl a, unsigned bits)
+{
+    return (uint64_t)(a >> bits);
+}
+
+#else
+
+typedef struct dbl { uint64_t lo, hi; } dbl;
+
+static inline dbl dbl_mul(uint64_t a, uint64_t b)
+{
+    uint64_t al = a & 0xFFFFFFFF, ah = a >> 32;
+    uint64_t bl = b & 0xFFFFFFFF, bh = b >> 32;
+    uint64_t ll = al * bl, lh = al * bh, hl = ah * bl, hh = ah * bh;
+    uint64_t mid = (ll >> 32) + (lh & 0xFFFFFFFF) + (hl & 0xFFFFFFFF);
+    dbl r;
+    r.lo = (ll & 0xFFFFFFFF) | (mid << 32);
+    r.hi = hh + (lh >> 32) + (hl >> 32) + (mid >> 32);
+    return r;
+}
+static inline dbl dbl_add(dbl a, dbl b)
+{
+    dbl r;
+    r.lo = a.lo + b.lo;
+    r.hi = a.hi + b.hi + (r.lo < a.lo);
+    return r;
+}
+static inline dbl dbl_add_small(dbl a, uint64_t b)
+{
+    dbl r;
+    r.lo = a.lo + b;
+    r.hi = a.hi + (r.lo < a.lo);
+    return r;
+}
+static inline uint64_t dbl_lo(dbl a)
+{
+    return a.lo;
+}
+/* Only ever used with 0 < bits < 64 */
+static inline uint64_t dbl_shr(dbl a, unsigned bits)
+{
+    return (a.lo >> bits) | (a.hi << (64 - bits));
+}
+
+#endif
+
+/* ----------------------------------------------------------------------
+ * Field arithmetic.
+ *
+ * A field element is represented as h[0] + h[1] 2^51 + ... + h[4]
+ * 2^204, not necessarily reduced mod p, and with limbs allowed to
+ * stray a little above 2^51.
+ *
+ * fe_mul, fe_sq and fe_mul_small accept inputs with limbs up to a
+ * bit over 2^53 (which covers the output of fe_add or fe_sub applied
+ * to two of their outputs), and return limbs less than 2^52.
+ */
+
+#define MASK51 (((uint64_t)1 << 51) - 1)
+
+typedef uint64_t fe[5];
+
+static void fe_frombytes(fe h, const unsigned char *s)
+{
+    uint64_t w0 = GET_64BIT_LSB_FIRST(s);
+    uint64_t w1 = GET_64BIT_LSB_FIRST(s + 8);
+    uint64_t w2 = GET_64BIT_LSB_FIRST(s + 16);
+    uint64_t w3 = GET_64BIT_LSB_FIRST(s + 24);
+
+    /* The top bit of the encoding is ignored, per RFC 7748 */
+    h[0] = w0 & MASK51;
+    h[1] = ((w0 >> 51) | (w1 << 13)) & MASK51;
+    h[2] = ((w1 >> 38) | (w2 << 26)) & MASK51;
+    h[3] = ((w2 >> 25) | (w3 << 39)) & MASK51;
+    h[4] = (w3 >> 12) & MASK51;
+}
+
+static void fe_tobytes(unsigned char *s, const fe f)
+{
+    uint64_t h[5], c;
+
+    /* Carry until every limb is below 2^51, so h < 2^255 */
+    for (size_t i = 0; i < 5; i++)
+        h[i] = f[i];
+    for (size_t pass = 0; pass < 2; pass++) {
+        c = h[0] >> 51; h[0] &= MASK51; h[1] += c;
+        c = h[1] >> 51; h[1] &= MASK51; h[2] += c;
+        c = h[2] >> 51; h[2] &= MASK51; h[3] += c;
+        c = h[3] >> 51; h[3] &= MASK51; h[4] += c;
+        c = h[4] >> 51; h[4] &= MASK51; h[0] += 19 * c;
+    }
+
+    /* Now h < 2^255 < 2p, so subtracting p at most once will fully
+     * reduce it. Work out whether to, by finding out whether h+19
+     * reaches 2^255. */
+    c = (h[0] + 19) >> 51;
+    c = (h[1] + c) >> 51;
+    c = (h[2] + c) >> 51;
+    c = (h[3] + c) >> 51;
+    c = (h[4] + c) >> 51;
+
+    /* If so, add 19 and discard the 2^255 bit */
+    h[0] += 19 * c;
+    c = h[0] >> 51; h[0] &= MASK51; h[1] += c;
+    c = h[1] >> 51; h[1] &= MASK51; h[2] += c;
+    c = h[2] >> 51; h[2] &= MASK51; h[3] += c;
+    c = h[3] >> 51; h[3] &= MASK51; h[4] += c;
+    h[4] &= MASK51;
+
+    PUT_64BIT_LSB_FIRST(s, h[0] | (h[1] << 51));
+    PUT_64BIT_LSB_FIRST(s + 8, (h[1] >> 13) | (h[2] << 38));
+    PUT_64BIT_LSB_FIRST(s + 16, (h[2] >> 26) | (h[3] << 25));
+    PUT_64BIT_LSB_FIRST(s + 24, (h[3] >> 39) | (h[4] << 12));
+
+    smemclr(h, sizeof(h));
+}
+
+static inline void fe_copy(fe h, const fe f)
+{
+    for (size_t i = 0; i < 5; i++)
+        h[i] = f[i];
+}
+
+static inline void fe_add(fe h, const fe f, const fe g)
+{
+    for (size_t i = 0; i < 5; i++)
+        h[i] = f[i] + g[i];
+}
+
+/* Subtract by adding 2p - g, so that nothing goes negative as long
+ * as every limb of g is below 2^52 */
+static inline void fe_sub(fe h, const fe f, const fe g)
+{
+    h[0] = f[0] + 0xFFFFFFFFFFFDA - g[0];
+    for (size_t i = 1; i < 5; i++)
+        h[i] = f[i] + 0xFFFFFFFFFFFFE - g[i];
+}
+
+/* Carry a five-limb double-width result down to an fe */
+static inline void fe_carry(fe h, dbl r0, dbl r1, dbl r2, dbl r3, dbl r4)
+{
+    uint64_t c;
+
+    r1 = dbl_add_small(r1, dbl_shr(r0, 51));
+    r2 = dbl_add_small(r2, dbl_shr(r1, 51));
+    r3 = dbl_add_small(r3, dbl_shr(r2, 51));
+    r4 = dbl_add_small(r4, dbl_shr(r3, 51));
+    c = dbl_shr(r4, 51);
+
+    /* c is less than 2^64/19 given our input bounds, so the wraparound
+     * from the top limb to the bottom one can't overflow */
+    h[0] = (dbl_lo(r0) & MASK51) + 19 * c;
+    h[1] = (dbl_lo(r1) & MASK51) + (h[0] >> 51);
+    h[0] &= MASK51;
+    h[2] = dbl_lo(r2) & MASK51;
+    h[3] = dbl_lo(r3) & MASK51;
+    h[4] = dbl_lo(r4) & MASK51;
+}
+
+#define MUL(a, b) dbl_mul(a, b)
+#define ADD(a, b) dbl_add(a, b)
+
+static void fe_mul(fe h, const fe f, const fe g)
+{
+    uint64_t g1_19 = 19 * g[1], g2_19 = 19 * g[2];
+    uint64_t g3_19 = 19 * g[3], g4_19 = 19 * g[4];
+
+    dbl r0 = ADD(ADD(ADD(ADD(MUL(f[0], g[0]), MUL(f[1], g4_19)),
+                         MUL(f[2], g3_19)), MUL(f[3], g2_19)),
+                 MUL(f[4], g1_19));
+    dbl r1 = ADD(ADD(ADD(ADD(MUL(f[0], g[1]), MUL(f[1], g[0])),
+                         MUL(f[2], g4_19)), MUL(f[3], g3_19)),
+                 MUL(f[4], g2_19));
+    dbl r2 = ADD(ADD(ADD(ADD(MUL(f[0], g[2]), MUL(f[1], g[1])),
+                         MUL(f[2], g[0])), MUL(f[3], g4_19)),
+                 MUL(f[4], g3_19));
+    dbl r3 = ADD(ADD(ADD(ADD(MUL(f[0], g[3]), MUL(f[1], g[2])),
+                         MUL(f[2], g[1])), MUL(f[3], g[0])),
+                 MUL(f[4], g4_19));
+    dbl r4 = ADD(ADD(ADD(ADD(MUL(f[0], g[4]), MUL(f[1], g[3])),
+                         MUL(f[2], g[2])), MUL(f[3], g[1])),
+                 MUL(f[4], g[0]));
+
+    fe_carry(h, r0, r1, r2, r3, r4);
+}
+
+static void fe_sq(fe h, const fe f)
+{
+    uint64_t f0_2 = 2 * f[0], f1_2 = 2 * f[1];
+    uint64_t f3_19 = 19 * f[3], f4_19 = 19 * f[4];
+    uint64_t f3_38 = 2 * f3_19, f4_38 = 2 * f4_19;
+
+    dbl r0 = ADD(ADD(MUL(f[0], f[0]), MUL(f[1], f4_38)), MUL(f[2], f3_38));
+    dbl r1 = ADD(ADD(MUL(f0_2, f[1]), MUL(f[2], f4_38)), MUL(f[3], f3_19));
+    dbl r2 = ADD(ADD(MUL(f0_2, f[2]), MUL(f[1], f[1])), MUL(f[3], f4_38));
+    dbl r3 = ADD(ADD(MUL(f0_2, f[3]), MUL(f1_2, f[2])), MUL(f[4], f4_19));
+    dbl r4 = ADD(ADD(MUL(f0_2, f[4]), MUL(f1_2, f[3])), MUL(f[2], f[2]));
+
+    fe_carry(h, r0, r1, r2, r3, r4);
+}
+
+static void fe_mul_small(fe h, const fe f, uint64_t k)
+{
+    fe_carry(h, MUL(f[0], k), MUL(f[1], k), MUL(f[2], k),
+             MUL(f[3], k), MUL(f[4], k));
+}
+
+#undef MUL
+#undef ADD
+
+/* Square n times in succession */
+static void fe_sq_n(fe h, const fe f, unsigned n)
+{
+    fe_sq(h, f);
+    while (--n)
+        fe_sq(h, h);
+}
+
+/*
+ * Invert by raising to the power p-2 = 2^255-21, using the usual
+ * addition chain for this prime (254 squarings and 11
+ * multiplications).
+ */
+static void fe_invert(fe out, const fe z)
+{
+    fe z2, z9, z11, t, z_5_0, z_10_0, z_20_0, z_50_0, z_100_0;
+
+    fe_sq(z2, z);                       /* 2 */
+    fe_sq_n(t, z2, 2);                  /* 8 */
+    fe_mul(z9, t, z);                   /* 9 */
+    fe_mul(z11, z9, z2);                /* 11 */
+    fe_sq(t, z11);                      /* 22 */
+    fe_mul(z_5_0, t, z9);               /* 2^5 - 1 */
+    fe_sq_n(t, z_5_0, 5);
+    fe_mul(z_10_0, t, z_5_0);           /* 2^10 - 1 */
+    fe_sq_n(t, z_10_0, 10);
+    fe_mul(z_20_0, t, z_10_0);          /* 2^20 - 1 */
+    fe_sq_n(t, z_20_0, 20);
+    fe_mul(t, t, z_20_0);               /* 2^40 - 1 */
+    fe_sq_n(t, t, 10);
+    fe_mul(z_50_0, t, z_10_0);          /* 2^50 - 1 */
+    fe_sq_n(t, z_50_0, 50);
+    fe_mul(z_100_0, t, z_50_0);         /* 2^100 - 1 */
+    fe_sq_n(t, z_100_0, 100);
+    fe_mul(t, t, z_100_0);              /* 2^200 - 1 */
+    fe_sq_n(t, t, 50);
+    fe_mul(t, t, z_50_0);               /* 2^250 - 1 */
+    fe_sq_n(t, t, 5);
+    fe_mul(out, t, z11);                /* 2^255 - 21 */
+
+    smemclr(z2, sizeof(z2));
+    smemclr(z9, sizeof(z9));
+    smemclr(z11, sizeof(z11));
+    smemclr(t, sizeof(t));
+    smemclr(z_5_0, sizeof(z_5_0));
+    smemclr(z_10_0, sizeof(z_10_0));
+    smemclr(z_20_0, sizeof(z_20_0));
+    smemclr(z_50_0, sizeof(z_50_0));
+    smemclr(z_100_0, sizeof(z_100_0));
+}
+
+/* Swap f and g if swap == 1, or leave them alone if swap == 0 */
+static inline void fe_cond_swap(fe f, fe g, uint64_t swap)
+{
+    uint64_t mask = -swap;
+    for (size_t i = 0; i < 5; i++) {
+        uint64_t diff = mask & (f[i] ^ g[i]);
+        f[i] ^= diff;
+        g[i] ^= diff;
+    }
+}
+
+/* ----------------------------------------------------------------------
+ * The Montgomery ladder itself, exactly as written out in RFC 7748
+ * section 5.
+ */
+
+void x25519_scalarmult(unsigned char *out, const unsigned char *scalar,
+                       const unsigned char *point)
+{
+    unsigned char k[32];
+    fe x1, x2, z2, x3, z3, a, aa, b, bb, e, c, d, da, cb, t;
+
+    /* Clamp the scalar */
+    memcpy(k, scalar, 32);
+    k[0] &= 0xF8;
+    k[31] &= 0x7F;
+    k[31] |= 0x40;
+
+    fe_frombytes(x1, point);
+    fe_copy(x3, x1);
+    for (size_t i = 0; i < 5; i++)
+        x2[i] = z2[i] = z3[i] = 0;
+    x2[0] = z3[0] = 1;
+
+    uint64_t swap = 0;
+    for (unsigned bit = 255; bit-- > 0;) {
+        uint64_t kbit = 1 & (k[bit / 8] >> (bit % 8));
+        swap ^= kbit;
+        fe_cond_swap(x2, x3, swap);
+        fe_cond_swap(z2, z3, swap);
+        swap = kbit;
+
+        fe_add(a, x2, z2);
+        fe_sq(aa, a);
+        fe_sub(b, x2, z2);
+        fe_sq(bb, b);
+        fe_sub(e, aa, bb);
+        fe_add(c, x3, z3);
+        fe_sub(d, x3, z3);
+        fe_mul(da, d, a);
+        fe_mul(cb, c, b);
+
+        fe_add(t, da, cb);
+        fe_sq(x3, t);
+        fe_sub(t, da, cb);
+        fe_sq(t, t);
+        fe_mul(z3, x1, t);
+        fe_mul(x2, aa, bb);
+        fe_mul_small(t, e, 121665);
+        fe_add(t, aa, t);
+        fe_mul(z2, e, t);
+    }
+    fe_cond_swap(x2, x3, swap);
+    fe_cond_swap(z2, z3, swap);
+
+    fe_invert(t, z2);
+    fe_mul(x2, x2, t);
+    fe_tobytes(out, x2);
+
+    smemclr(k, sizeof(k));
+    smemclr(x1, sizeof(x1));
+    smemclr(x2, sizeof(x2));
+    smemclr(z2, sizeof(z2));
+    smemclr(x3, sizeof(x3));
+    smemclr(z3, sizeof(z3));
+    smemclr(a, sizeof(a));
+    smemclr(aa, sizeof(aa));
+    smemclr(b, sizeof(b));
+    smemclr(bb, sizeof(bb));
+    smemclr(e, sizeof(e));
+    smemclr(c, sizeof(c));
+    smemclr(d, sizeof(d));
+    smemclr(da, sizeof(da));
+    smemclr(cb, sizeof(cb));
+    smemclr(t, sizeof(t));
+}
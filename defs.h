@@ -112,6 +112,9 @@ typedef struct InteractionReadySeat InteractionReadySeat;
 typedef struct Ldisc_tag Ldisc;
 typedef struct LogContext LogContext;
 typedef struct LogPolicy LogPolicy;
+typedef struct LogWriter LogWriter;
+typedef struct GzipEncoder GzipEncoder;
+typedef struct SpillFile SpillFile;
 typedef struct LogPolicyVtable LogPolicyVtable;
 
 typedef struct Seat Seat;
@@ -137,6 +140,8 @@ typedef struct MontgomeryCurve MontgomeryCurve;
 typedef struct MontgomeryPoint MontgomeryPoint;
 typedef struct EdwardsCurve EdwardsCurve;
 typedef struct EdwardsPoint EdwardsPoint;
+typedef struct WeierstrassBaseTable WeierstrassBaseTable;
+typedef struct EdwardsBaseTable EdwardsBaseTable;
 
 typedef struct SshServerConfig SshServerConfig;
 typedef struct SftpServer SftpServer;
@@ -20,11 +20,176 @@ struct LogContext {
     LogPolicy *lp;
     Conf *conf;
     int logtype;                       /* cached out of conf */
+    bool binary;                       /* writing a binary packet log */
+    LogWriter *writer;                 /* NULL if writing synchronously */
+    uint64_t dropped;                  /* bytes discarded by the writer */
+    GzipEncoder *gz;                   /* NULL unless compressing */
+    strbuf *gzbuf;                     /* data waiting to be compressed */
+    unsigned long gzflush_time;        /* when the timer will compress it */
 };
 
+/*
+ * Amount of data we let the background writer fall behind by, before
+ * applying the CONF_logwriter policy for a full queue.
+ */
+#define LOGWRITER_QUEUE_LIMIT 1048576
+
+/*
+ * When compressing a log file, data is collected until there's this
+ * much of it, or until it's been waiting for this long, and then
+ * compressed and written out together. That bounds how much can be
+ * lost if we crash, without making the compressor restart every time
+ * someone types a character.
+ */
+#define LOGGZIP_FLUSH_SIZE 65536
+#define LOGGZIP_FLUSH_INTERVAL (5 * TICKSPERSEC)
+
 static Filename *xlatlognam(Filename *s, char *hostname, int port,
                             struct tm *tm);
 
+/*
+ * Start a background writer for a newly opened log file, if the
+ * configuration asks for one.
+ */
+static void logwriter_start(LogContext *ctx)
+{
+    int policy = conf_get_int(ctx->conf, CONF_logwriter);
+    if (policy != LGWR_SYNC)
+        ctx->writer = logwriter_new(ctx->lgfp, LOGWRITER_QUEUE_LIMIT,
+                                    policy == LGWR_DROP);
+}
+
+/*
+ * Record in the Event Log how much data the background writer
+ * discarded, once it has caught up again (or the log is closed).
+ */
+static void logwriter_report_dropped(LogContext *ctx)
+{
+    char *event = dupprintf("Session log writer caught up after "
+                            "discarding %"PRIu64" bytes of log data",
+                            ctx->dropped);
+    lp_eventlog(ctx->lp, event);
+    sfree(event);
+    ctx->dropped = 0;
+}
+
+/*
+ * Wait for the background writer (if any) to finish writing
+ * everything it's been given, and shut it down.
+ */
+static void logwriter_stop(LogContext *ctx)
+{
+    if (ctx->writer) {
+        logwriter_free(ctx->writer);
+        ctx->writer = NULL;
+        if (ctx->dropped)
+            logwriter_report_dropped(ctx);
+    }
+}
+
+static void loggzip_stop(LogContext *ctx, bool finish);
+
+/*
+ * Write data to the open log file (or hand it to the background
+ * writer), after any compression.
+ */
+static void logfile_write(LogContext *ctx, ptrlen data)
+{
+    bool ok;
+    assert(ctx->lgfp);
+    if (ctx->writer) {
+        LogWriterStatus status = logwriter_write(ctx->writer, data);
+        if (status == LW_DROPPED) {
+            if (!ctx->dropped)
+                lp_eventlog(ctx->lp, "Session log writer has fallen "
+                            "behind; discarding log data");
+            ctx->dropped += data.len;
+        } else if (status == LW_QUEUED && ctx->dropped) {
+            logwriter_report_dropped(ctx);
+        }
+        ok = (status != LW_FAILED);
+    } else {
+        ok = (fwrite(data.ptr, 1, data.len, ctx->lgfp) == data.len);
+    }
+    if (!ok) {
+        /* No point trying to finish off a gzip stream in a bad file */
+        loggzip_stop(ctx, false);
+        logfclose(ctx);
+        ctx->state = L_ERROR;
+        lp_eventlog(ctx->lp, "Disabled writing session log "
+                    "due to error while writing");
+    }
+}
+
+static void logfile_flush(LogContext *ctx)
+{
+    if (ctx->writer)
+        logwriter_flush(ctx->writer);
+    else
+        fflush(ctx->lgfp);
+}
+
+/*
+ * Compress whatever is waiting in a gzipped log, and write it out.
+ */
+static void loggzip_flush(LogContext *ctx)
+{
+    if (!ctx->gz || !ctx->gzbuf->len)
+        return;
+
+    strbuf *sb = strbuf_new_nm();
+    gzip_encode(ctx->gz, ptrlen_from_strbuf(ctx->gzbuf),
+                BinarySink_UPCAST(sb));
+    strbuf_clear(ctx->gzbuf);
+    logfile_write(ctx, ptrlen_from_strbuf(sb));
+    strbuf_free(sb);
+    if (ctx->state == L_OPEN)
+        logfile_flush(ctx);
+}
+
+static void loggzip_timer(void *vctx, unsigned long now)
+{
+    LogContext *ctx = (LogContext *)vctx;
+    if (now == ctx->gzflush_time)
+        loggzip_flush(ctx);
+}
+
+static void loggzip_start(LogContext *ctx)
+{
+    if (conf_get_bool(ctx->conf, CONF_logcompress)) {
+        ctx->gz = gzip_encoder_new();
+        ctx->gzbuf = strbuf_new_nm();
+    }
+}
+
+/*
+ * Stop compressing a log file, either writing out the rest of the
+ * data and the gzip trailer, or (if the file has already gone wrong)
+ * just throwing it away.
+ */
+static void loggzip_stop(LogContext *ctx, bool finish)
+{
+    if (!ctx->gz)
+        return;
+
+    GzipEncoder *gz = ctx->gz;
+    strbuf *gzbuf = ctx->gzbuf;
+    ctx->gz = NULL;
+    ctx->gzbuf = NULL;
+    expire_timer_context(ctx);
+
+    if (finish && ctx->state == L_OPEN) {
+        strbuf *sb = strbuf_new_nm();
+        gzip_encode(gz, ptrlen_from_strbuf(gzbuf), BinarySink_UPCAST(sb));
+        gzip_encoder_finish(gz, BinarySink_UPCAST(sb));
+        logfile_write(ctx, ptrlen_from_strbuf(sb));
+        strbuf_free(sb);
+    } else {
+        gzip_encoder_free(gz);
+    }
+    strbuf_free(gzbuf);
+}
+
 /*
  * Internal wrapper function which must be called for _all_ output
  * to the log file. It takes care of opening the log file if it
@@ -44,12 +209,15 @@ static void logwrite(LogContext *ctx, ptrlen data)
     if (ctx->state == L_OPENING) {
         bufchain_add(&ctx->queue, data.ptr, data.len);
     } else if (ctx->state == L_OPEN) {
-        assert(ctx->lgfp);
-        if (fwrite(data.ptr, 1, data.len, ctx->lgfp) < data.len) {
-            logfclose(ctx);
-            ctx->state = L_ERROR;
-            lp_eventlog(ctx->lp, "Disabled writing session log "
-                        "due to error while writing");
+        if (ctx->gz) {
+            if (!ctx->gzbuf->len)
+                ctx->gzflush_time = schedule_timer(
+                    LOGGZIP_FLUSH_INTERVAL, loggzip_timer, ctx);
+            put_datapl(ctx->gzbuf, data);
+            if (ctx->gzbuf->len >= LOGGZIP_FLUSH_SIZE)
+                loggzip_flush(ctx);
+        } else {
+            logfile_write(ctx, data);
         }
     }                                  /* else L_ERROR, so ignore the write */
 }
@@ -67,18 +235,29 @@ static PRINTF_LIKE(2, 3) void logprintf(LogContext *ctx, const char *fmt, ...)
     data = dupvprintf(fmt, ap);
     va_end(ap);
 
-    logwrite(ctx, ptrlen_from_asciz(data));
+    if (ctx->binary) {
+        /* In a binary packet log, text has to go in a record of its own */
+        strbuf *sb = strbuf_new();
+        pktlog_binary_text(BinarySink_UPCAST(sb), ptrlen_from_asciz(data),
+                           time(NULL));
+        logwrite(ctx, ptrlen_from_strbuf(sb));
+        strbuf_free(sb);
+    } else {
+        logwrite(ctx, ptrlen_from_asciz(data));
+    }
     sfree(data);
 }
 
 /*
- * Flush any open log file.
+ * Flush any open log file. A compressed log is left to be flushed by
+ * its own timer, since compressing and writing out every little
+ * piece separately would make it much less compressed.
  */
 void logflush(LogContext *ctx)
 {
     if (ctx->logtype > 0)
-        if (ctx->state == L_OPEN)
-            fflush(ctx->lgfp);
+        if (ctx->state == L_OPEN && !ctx->gz)
+            logfile_flush(ctx);
 }
 
 LogPolicy *log_get_policy(LogContext *ctx)
@@ -100,6 +279,8 @@ static void logfopen_callback(void *vctx, int mode)
         fmode = (mode == 1 ? "ab" : "wb");
         ctx->lgfp = f_open(ctx->currlogfilename, fmode, false);
         if (ctx->lgfp) {
+            logwriter_start(ctx);
+            loggzip_start(ctx);
             ctx->state = L_OPEN;
         } else {
             ctx->state = L_ERROR;
@@ -107,6 +288,14 @@ static void logfopen_callback(void *vctx, int mode)
         }
     }
 
+    if (ctx->state == L_OPEN && ctx->binary) {
+        /* Identify the file format before anything else goes in it. */
+        strbuf *sb = strbuf_new();
+        pktlog_binary_start(BinarySink_UPCAST(sb), time(NULL));
+        logwrite(ctx, ptrlen_from_strbuf(sb));
+        strbuf_free(sb);
+    }
+
     if (ctx->state == L_OPEN && conf_get_bool(ctx->conf, CONF_logheader)) {
         /* Write header line into log file. */
         tm = ltime();
@@ -121,8 +310,10 @@ static void logfopen_callback(void *vctx, int mode)
                       (mode == 1 ? "Appending" : "Writing new"),
                       (ctx->logtype == LGTYP_ASCII ? "ASCII" :
                        ctx->logtype == LGTYP_DEBUG ? "raw" :
-                       ctx->logtype == LGTYP_PACKETS ? "SSH packets" :
-                       ctx->logtype == LGTYP_SSHRAW ? "SSH raw data" :
+                       ctx->logtype == LGTYP_PACKETS ?
+                       (ctx->binary ? "binary SSH packets" : "SSH packets") :
+                       ctx->logtype == LGTYP_SSHRAW ?
+                       (ctx->binary ? "binary SSH raw data" : "SSH raw data") :
                        "unknown"),
                       filename_to_str(ctx->currlogfilename));
     lp_eventlog(ctx->lp, event);
@@ -194,6 +385,8 @@ void logfopen(LogContext *ctx)
 
 void logfclose(LogContext *ctx)
 {
+    loggzip_stop(ctx, true);
+    logwriter_stop(ctx);
     if (ctx->lgfp) {
         fclose(ctx->lgfp);
         ctx->lgfp = NULL;
@@ -205,10 +398,19 @@ void logfclose(LogContext *ctx)
  * Log session traffic.
  */
 void logtraffic(LogContext *ctx, unsigned char c, int logmode)
+{
+    logtraffic_span(ctx, make_ptrlen(&c, 1), logmode);
+}
+
+/*
+ * Log a whole run of session traffic at once. The output is exactly
+ * as if each byte of 'data' had been passed to logtraffic in turn.
+ */
+void logtraffic_span(LogContext *ctx, ptrlen data, int logmode)
 {
     if (ctx->logtype > 0) {
-        if (ctx->logtype == logmode)
-            logwrite(ctx, make_ptrlen(&c, 1));
+        if (ctx->logtype == logmode && data.len)
+            logwrite(ctx, data);
     }
 }
 
@@ -284,120 +486,45 @@ void log_packet(LogContext *ctx, int direction, int type,
                 const unsigned long *seq,
                 unsigned downstream_id, const char *additional_log_text)
 {
-    char dumpdata[128], smalldata[5];
-    size_t p = 0, b = 0, omitted = 0;
-    int output_pos = 0; /* NZ if pending output in dumpdata */
-
     if (!(ctx->logtype == LGTYP_SSHRAW ||
           (ctx->logtype == LGTYP_PACKETS && texttype)))
         return;
 
-    /* Packet header. */
-    if (texttype) {
-        logprintf(ctx, "%s packet ",
-                  direction == PKT_INCOMING ? "Incoming" : "Outgoing");
-
-        if (seq)
-            logprintf(ctx, "#0x%lx, ", *seq);
-
-        logprintf(ctx, "type %d / 0x%02x (%s)", type, type, texttype);
-
-        if (downstream_id) {
-            logprintf(ctx, " on behalf of downstream #%u", downstream_id);
-            if (additional_log_text)
-                logprintf(ctx, " (%s)", additional_log_text);
-        }
-
-        logprintf(ctx, "\r\n");
+    PacketLogEntry pe = {
+        .direction = direction,
+        .type = type,
+        .texttype = texttype,
+        .data = make_ptrlen(data, len),
+        .n_blanks = n_blanks,
+        .blanks = blanks,
+        .seq = seq,
+        .downstream_id = downstream_id,
+        .additional_log_text = additional_log_text,
+    };
+
+    strbuf *sb = strbuf_new();
+    if (ctx->binary) {
+        pktlog_binary_packet(BinarySink_UPCAST(sb), &pe, time(NULL));
     } else {
-        /*
-         * Raw data is logged with a timestamp, so that it's possible
-         * to determine whether a mysterious delay occurred at the
-         * client or server end. (Timestamping the raw data avoids
-         * cluttering the normal case of only logging decrypted SSH
-         * messages, and also adds conceptual rigour in the case where
-         * an SSH message arrives in several pieces.)
-         */
-        char buf[256];
-        struct tm tm;
-        tm = ltime();
-        strftime(buf, 24, "%Y-%m-%d %H:%M:%S", &tm);
-        logprintf(ctx, "%s raw data at %s\r\n",
-                  direction == PKT_INCOMING ? "Incoming" : "Outgoing",
-                  buf);
+        struct tm tm = ltime();
+        pktlog_format_text(BinarySink_UPCAST(sb), &pe, &tm);
     }
-
-    /*
-     * Output a hex/ASCII dump of the packet body, blanking/omitting
-     * parts as specified.
-     */
-    while (p < len) {
-        int blktype;
-
-        /* Move to a current entry in the blanking array. */
-        while ((b < n_blanks) &&
-               (p >= blanks[b].offset + blanks[b].len))
-            b++;
-        /* Work out what type of blanking to apply to
-         * this byte. */
-        blktype = PKTLOG_EMIT; /* default */
-        if ((b < n_blanks) &&
-            (p >= blanks[b].offset) &&
-            (p < blanks[b].offset + blanks[b].len))
-            blktype = blanks[b].type;
-
-        /* If we're about to stop omitting, it's time to say how
-         * much we omitted. */
-        if ((blktype != PKTLOG_OMIT) && omitted) {
-            logprintf(ctx, "  (%"SIZEu" byte%s omitted)\r\n",
-                      omitted, (omitted==1?"":"s"));
-            omitted = 0;
-        }
-
-        /* (Re-)initialise dumpdata as necessary
-         * (start of row, or if we've just stopped omitting) */
-        if (!output_pos && !omitted)
-            sprintf(dumpdata, "  %08"SIZEx"%*s\r\n",
-                    p-(p%16), 1+3*16+2+16, "");
-
-        /* Deal with the current byte. */
-        if (blktype == PKTLOG_OMIT) {
-            omitted++;
-        } else {
-            int c;
-            if (blktype == PKTLOG_BLANK) {
-                c = 'X';
-                sprintf(smalldata, "XX");
-            } else {  /* PKTLOG_EMIT */
-                c = ((const unsigned char *)data)[p];
-                sprintf(smalldata, "%02x", c);
-            }
-            dumpdata[10+2+3*(p%16)] = smalldata[0];
-            dumpdata[10+2+3*(p%16)+1] = smalldata[1];
-            dumpdata[10+1+3*16+2+(p%16)] = (c >= 0x20 && c < 0x7F ? c : '.');
-            output_pos = (p%16) + 1;
-        }
-
-        p++;
-
-        /* Flush row if necessary */
-        if (((p % 16) == 0) || (p == len) || omitted) {
-            if (output_pos) {
-                strcpy(dumpdata + 10+1+3*16+2+output_pos, "\r\n");
-                logwrite(ctx, ptrlen_from_asciz(dumpdata));
-                output_pos = 0;
-            }
-        }
-
-    }
-
-    /* Tidy up */
-    if (omitted)
-        logprintf(ctx, "  (%"SIZEu" byte%s omitted)\r\n",
-                  omitted, (omitted==1?"":"s"));
+    logwrite(ctx, ptrlen_from_strbuf(sb));
+    strbuf_free(sb);
     logflush(ctx);
 }
 
+/*
+ * The binary format only exists for the SSH packet log types. In the
+ * others, CONF_logbinary is ignored.
+ */
+static bool log_is_binary(Conf *conf)
+{
+    int logtype = conf_get_int(conf, CONF_logtype);
+    return conf_get_bool(conf, CONF_logbinary) &&
+        (logtype == LGTYP_PACKETS || logtype == LGTYP_SSHRAW);
+}
+
 LogContext *log_init(LogPolicy *lp, Conf *conf)
 {
     LogContext *ctx = snew(LogContext);
@@ -406,7 +533,12 @@ LogContext *log_init(LogPolicy *lp, Conf *conf)
     ctx->lp = lp;
     ctx->conf = conf_copy(conf);
     ctx->logtype = conf_get_int(ctx->conf, CONF_logtype);
+    ctx->binary = log_is_binary(ctx->conf);
     ctx->currlogfilename = NULL;
+    ctx->writer = NULL;
+    ctx->dropped = 0;
+    ctx->gz = NULL;
+    ctx->gzbuf = NULL;
     bufchain_init(&ctx->queue);
     return ctx;
 }
@@ -428,7 +560,10 @@ void log_reconfig(LogContext *ctx, Conf *conf)
     if (!filename_equal(conf_get_filename(ctx->conf, CONF_logfilename),
                         conf_get_filename(conf, CONF_logfilename)) ||
         conf_get_int(ctx->conf, CONF_logtype) !=
-        conf_get_int(conf, CONF_logtype))
+        conf_get_int(conf, CONF_logtype) ||
+        log_is_binary(ctx->conf) != log_is_binary(conf) ||
+        conf_get_bool(ctx->conf, CONF_logcompress) !=
+        conf_get_bool(conf, CONF_logcompress))
         reset_logging = true;
     else
         reset_logging = false;
@@ -436,10 +571,24 @@ void log_reconfig(LogContext *ctx, Conf *conf)
     if (reset_logging)
         logfclose(ctx);
 
+    /*
+     * A change of writer policy doesn't need the file reopening: just
+     * let the old writer drain, and start a new one if needed.
+     */
+    bool restart_writer = !reset_logging && ctx->state == L_OPEN &&
+        conf_get_int(ctx->conf, CONF_logwriter) !=
+        conf_get_int(conf, CONF_logwriter);
+    if (restart_writer)
+        logwriter_stop(ctx);
+
     conf_free(ctx->conf);
     ctx->conf = conf_copy(conf);
 
     ctx->logtype = conf_get_int(ctx->conf, CONF_logtype);
+    ctx->binary = log_is_binary(ctx->conf);
+
+    if (restart_writer)
+        logwriter_start(ctx);
 
     if (reset_logging)
         logfopen(ctx);
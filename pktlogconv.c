@@ -0,0 +1,97 @@
+/*
+ * pktlogconv: convert an SSH packet log written in PuTTY's compact
+ * binary format back into the usual text hex dump.
+ */
+
+#include <errno.h>
+#include <stdio.h>
+#include <string.h>
+
+#include "putty.h"
+
+void out_of_memory(void)
+{
+    fprintf(stderr, "pktlogconv: out of memory\n");
+    exit(1);
+}
+
+static void usage(FILE *fp)
+{
+    fprintf(fp, "usage: pktlogconv BINARY-LOG [TEXT-LOG]\n"
+            "Converts a binary SSH packet log into the text format. If\n"
+            "TEXT-LOG is omitted, the text is written to standard output.\n");
+}
+
+int main(int argc, char **argv)
+{
+    const char *infile = NULL, *outfile = NULL;
+
+    for (int i = 1; i < argc; i++) {
+        if (!strcmp(argv[i], "--help")) {
+            usage(stdout);
+            return 0;
+        } else if (!infile) {
+            infile = argv[i];
+        } else if (!outfile) {
+            outfile = argv[i];
+        } else {
+            usage(stderr);
+            return 1;
+        }
+    }
+    if (!infile) {
+        usage(stderr);
+        return 1;
+    }
+
+    FILE *fp = fopen(infile, "rb");
+    if (!fp) {
+        fprintf(stderr, "pktlogconv: %s: %s\n", infile, strerror(errno));
+        return 1;
+    }
+    strbuf *in = strbuf_new_nm();
+    bool ok = read_file_into(BinarySink_UPCAST(in), fp);
+    fclose(fp);
+    if (!ok) {
+        fprintf(stderr, "pktlogconv: %s: error reading file\n", infile);
+        strbuf_free(in);
+        return 1;
+    }
+
+    strbuf *out = strbuf_new_nm();
+    BinarySource src[1];
+    BinarySource_BARE_INIT_PL(src, ptrlen_from_strbuf(in));
+    const char *err = pktlog_binary_to_text(src, BinarySink_UPCAST(out));
+
+    /*
+     * Write out whatever we managed to convert even if the log turned
+     * out to be damaged, since a log cut short by a crash is exactly
+     * the case where the earlier part is most wanted.
+     */
+    FILE *outfp = outfile ? fopen(outfile, "wb") : stdout;
+    if (!outfp) {
+        fprintf(stderr, "pktlogconv: %s: %s\n", outfile, strerror(errno));
+        strbuf_free(in);
+        strbuf_free(out);
+        return 1;
+    }
+    bool write_ok = (fwrite(out->u, 1, out->len, outfp) == out->len);
+    if (outfile)
+        write_ok = (fclose(outfp) == 0) && write_ok;
+    else
+        write_ok = (fflush(outfp) == 0) && write_ok;
+
+    strbuf_free(in);
+    strbuf_free(out);
+
+    if (!write_ok) {
+        fprintf(stderr, "pktlogconv: %s: error writing file\n",
+                outfile ? outfile : "standard output");
+        return 1;
+    }
+    if (err) {
+        fprintf(stderr, "pktlogconv: %s: %s\n", infile, err);
+        return 1;
+    }
+    return 0;
+}
@@ -296,7 +296,6 @@ static void do_cmd(char *host, char *user, char *cmd)
 {
     const char *err;
     char *realhost;
-    LogContext *logctx;
 
     if (host == NULL || host[0] == '\0')
         bump("Empty host name");
@@ -467,13 +466,13 @@ static void do_cmd(char *host, char *user, char *cmd)
     }
     conf_set_bool(conf, CONF_nopty, true);
 
-    logctx = log_init(console_cli_logpolicy, conf);
+    console_logctx = log_init(console_cli_logpolicy, conf);
 
     platform_psftp_pre_conn_setup(console_cli_logpolicy);
 
     err = backend_init(backend_vt_from_proto(
                            conf_get_int(conf, CONF_protocol)),
-                       pscp_seat, &backend, logctx, conf,
+                       pscp_seat, &backend, console_logctx, conf,
                        conf_get_str(conf, CONF_host),
                        conf_get_int(conf, CONF_port),
                        &realhost, 0,
@@ -2375,6 +2374,7 @@ int psftp_main(int argc, char *argv[])
         backend = NULL;
     }
     sk_cleanup();
+    console_free_log();
     return (errs == 0 ? 0 : 1);
 }
 
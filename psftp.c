@@ -31,7 +31,6 @@ static void do_sftp_cleanup(void);
  */
 
 static char *pwd, *homedir;
-static LogContext *psftp_logctx = NULL;
 static Backend *backend;
 static Conf *conf;
 static bool sent_eof = false;
@@ -2738,13 +2737,13 @@ static int psftp_connect(char *userhost, char *user, int portnumber)
                  "exec sftp-server");
     conf_set_bool(conf, CONF_ssh_subsys2, false);
 
-    psftp_logctx = log_init(console_cli_logpolicy, conf);
+    console_logctx = log_init(console_cli_logpolicy, conf);
 
     platform_psftp_pre_conn_setup(console_cli_logpolicy);
 
     err = backend_init(backend_vt_from_proto(
                            conf_get_int(conf, CONF_protocol)),
-                       psftp_seat, &backend, psftp_logctx, conf,
+                       psftp_seat, &backend, console_logctx, conf,
                        conf_get_str(conf, CONF_host),
                        conf_get_int(conf, CONF_port),
                        &realhost, 0,
@@ -2917,8 +2916,7 @@ int psftp_main(int argc, char *argv[])
     stripctrl_free(string_scc);
     stripctrl_free(stderr_scc);
 
-    if (psftp_logctx)
-        log_free(psftp_logctx);
+    console_free_log();
 
     return toret;
 }
@@ -350,6 +350,9 @@ struct unicode_data {
 #define LGTYP_DEBUG 2                  /* logmode: all chars of traffic */
 #define LGTYP_PACKETS 3                /* logmode: SSH data packets */
 #define LGTYP_SSHRAW 4                 /* logmode: SSH raw data */
+#define LGWR_SYNC  0                   /* log writes done on main thread */
+#define LGWR_BLOCK 1                   /* writer thread; wait if it's full */
+#define LGWR_DROP  2                   /* writer thread; drop if it's full */
 
 /*
  * Enumeration of 'special commands' that can be sent during a
@@ -594,6 +597,11 @@ enum {
     RESIZE_TERM, RESIZE_DISABLED, RESIZE_FONT, RESIZE_EITHER
 };
 
+enum {
+    /* Window update rate policies (CONF_update_pacing) */
+    UPDATE_PACING_ADAPTIVE, UPDATE_PACING_FIXED
+};
+
 enum {
     /* Function key types (CONF_funky_type) */
     FUNKY_TILDE,
@@ -1717,6 +1725,12 @@ struct TermWinVtable {
      * PuTTY itself rather than the far end (defence against end-of-
      * authentication spoofing) */
     void (*draw_trust_sigil)(TermWin *, int x, int y);
+    /* Move the existing contents of rows topline..botline (inclusive)
+     * up by 'lines' rows, or down if it's negative. The rows this
+     * uncovers can be left containing anything, because the terminal
+     * will redraw them. Returns false if the front end can't do this,
+     * in which case the terminal just repaints everything that moved. */
+    bool (*scroll)(TermWin *, int topline, int botline, int lines);
     int (*char_width)(TermWin *, int uc);
     void (*free_draw_ctx)(TermWin *);
 
@@ -1801,6 +1815,8 @@ static inline void win_draw_cursor(
 { win->vt->draw_cursor(win, x, y, text, len, attrs, line_attrs, tc); }
 static inline void win_draw_trust_sigil(TermWin *win, int x, int y)
 { win->vt->draw_trust_sigil(win, x, y); }
+static inline bool win_scroll(TermWin *win, int top, int bot, int lines)
+{ return win->vt->scroll(win, top, bot, lines); }
 static inline int win_char_width(TermWin *win, int uc)
 { return win->vt->char_width(win, uc); }
 static inline void win_free_draw_ctx(TermWin *win)
@@ -1980,6 +1996,7 @@ NORETURN void cleanup_exit(int);
     X(BOOL, NONE, fullscreenonaltenter) \
     X(BOOL, NONE, scroll_on_key) \
     X(BOOL, NONE, scroll_on_disp) \
+    X(INT, NONE, update_pacing) /* UPDATE_PACING_ADAPTIVE, ... */ \
     X(BOOL, NONE, erase_to_scrollback) \
     X(BOOL, NONE, compose_key) \
     X(BOOL, NONE, ctrlaltkeys) \
@@ -1988,6 +2005,7 @@ NORETURN void cleanup_exit(int);
     X(STR, NONE, wintitle) /* initial window title */ \
     /* Terminal options */ \
     X(INT, NONE, savelines) \
+    X(BOOL, NONE, spill_scrollback) \
     X(BOOL, NONE, dec_om) \
     X(BOOL, NONE, wrap_mode) \
     X(BOOL, NONE, lfhascr) \
@@ -2015,8 +2033,11 @@ NORETURN void cleanup_exit(int);
     X(INT, NONE, logxfovr) /* LGXF_OVR, LGXF_APN, LGXF_ASK */ \
     X(BOOL, NONE, logflush) \
     X(BOOL, NONE, logheader) \
+    X(INT, NONE, logwriter) /* LGWR_SYNC, LGWR_BLOCK, LGWR_DROP */ \
+    X(BOOL, NONE, logcompress) \
     X(BOOL, NONE, logomitpass) \
     X(BOOL, NONE, logomitdata) \
+    X(BOOL, NONE, logbinary) \
     X(BOOL, NONE, hide_mouseptr) \
     X(BOOL, NONE, sunken_edge) \
     X(INT, NONE, window_border) /* in pixels */ \
@@ -2272,6 +2293,8 @@ void term_resize_request_completed(Terminal *);
 void term_paint(Terminal *, int, int, int, int, bool);
 void term_scroll(Terminal *, int, int);
 void term_scroll_to_selection(Terminal *, int);
+bool term_find(Terminal *, const wchar_t *text, bool backwards,
+               bool match_case, bool skip_current);
 void term_pwron(Terminal *, bool);
 void term_clrsb(Terminal *);
 void term_mouse(Terminal *, Mouse_Button, Mouse_Button, Mouse_Action,
@@ -2286,6 +2309,9 @@ void term_blink(Terminal *, bool set_cursor);
 void term_do_paste(Terminal *, const wchar_t *, int);
 void term_nopaste(Terminal *);
 void term_copyall(Terminal *, const int *, int);
+/* Receives the text streamed out by term_export_all, a chunk at a time */
+typedef void (*term_export_fn_t)(void *ctx, const wchar_t *text, size_t len);
+void term_export_all(Terminal *, term_export_fn_t fn, void *ctx);
 void term_pre_reconfig(Terminal *, Conf *);
 void term_reconfig(Terminal *, Conf *);
 void term_request_copy(Terminal *, const int *clipboards, int n_clipboards);
@@ -2397,6 +2423,7 @@ void log_reconfig(LogContext *logctx, Conf *conf);
 void logfopen(LogContext *logctx);
 void logfclose(LogContext *logctx);
 void logtraffic(LogContext *logctx, unsigned char c, int logmode);
+void logtraffic_span(LogContext *logctx, ptrlen data, int logmode);
 void logflush(LogContext *logctx);
 LogPolicy *log_get_policy(LogContext *logctx);
 void logevent(LogContext *logctx, const char *event);
@@ -2409,6 +2436,63 @@ void logeventvf(LogContext *logctx, const char *fmt, va_list ap);
  * value of dupprintf straight to this.
  */
 void logevent_and_free(LogContext *logctx, char *event);
+
+/*
+ * Background writer for log files, so that a slow filesystem can't
+ * hold up the event loop. Implemented per platform, in a thread of
+ * its own which owns all the stdio calls on 'fp' until
+ * logwriter_free returns. A platform that can't do it returns NULL
+ * from logwriter_new, and the caller should go on writing to the
+ * file itself.
+ *
+ * logwriter_write queues data to be written. If the queue already
+ * holds 'queue_limit' bytes, it either waits for the writer thread to
+ * catch up, or (if 'drop_when_full' was set) discards the data and
+ * returns LW_DROPPED, and goes on doing so until the queue has drained
+ * to half the limit. LW_FAILED means a previous write has failed,
+ * after which everything is discarded.
+ *
+ * logwriter_flush asks for an fflush once the queued data is written,
+ * without waiting for it. logwriter_free writes out whatever is still
+ * queued, then stops the thread; it doesn't close 'fp'.
+ */
+typedef enum { LW_QUEUED, LW_DROPPED, LW_FAILED } LogWriterStatus;
+LogWriter *logwriter_new(FILE *fp, size_t queue_limit, bool drop_when_full);
+LogWriterStatus logwriter_write(LogWriter *lw, ptrlen data);
+void logwriter_flush(LogWriter *lw);
+void logwriter_free(LogWriter *lw);
+
+/*
+ * Streaming gzip encoder, in utils/gzip.c, for compressed log files.
+ * Each call to gzip_encode appends compressed data to 'bs' which can
+ * be decoded in full without waiting for any later call, so a file
+ * cut short after it is still readable up to that point.
+ * gzip_encoder_finish writes the end of the gzip stream and frees
+ * the encoder; gzip_encoder_free abandons it without doing so.
+ */
+GzipEncoder *gzip_encoder_new(void);
+void gzip_encode(GzipEncoder *gz, ptrlen data, BinarySink *bs);
+void gzip_encoder_finish(GzipEncoder *gz, BinarySink *bs);
+void gzip_encoder_free(GzipEncoder *gz);
+
+/*
+ * Temporary file for the terminal to spill old scrollback into.
+ * Implemented per platform, as a file that nobody else can see and
+ * that goes away when it's freed, read back through a memory mapping.
+ * spillfile_new returns NULL if no such file can be made.
+ *
+ * spillfile_append writes data at the end of the file and returns
+ * the offset it was written at, or SPILLFILE_FAILED.
+ * spillfile_read returns data previously written, valid until the
+ * next call to any of these functions; if the file can't be mapped,
+ * the returned ptrlen is empty.
+ */
+#define SPILLFILE_FAILED ((uint64_t)-1)
+SpillFile *spillfile_new(void);
+uint64_t spillfile_append(SpillFile *sf, ptrlen data);
+ptrlen spillfile_read(SpillFile *sf, uint64_t offset, size_t len);
+void spillfile_free(SpillFile *sf);
+
 enum { PKT_INCOMING, PKT_OUTGOING };
 enum { PKTLOG_EMIT, PKTLOG_BLANK, PKTLOG_OMIT };
 struct logblank_t {
@@ -2422,6 +2506,38 @@ void log_packet(LogContext *logctx, int direction, int type,
                 const unsigned long *sequence,
                 unsigned downstream_id, const char *additional_log_text);
 
+/*
+ * Formatting of SSH packet log entries, in utils/pktlog.c, shared
+ * between log_packet and the offline converter pktlogconv. A
+ * PacketLogEntry holds the arguments of one log_packet call; texttype
+ * is NULL for raw data, and 'tm' is only used to timestamp raw data.
+ *
+ * The binary format consists of self-delimiting records, starting
+ * with one written by pktlog_binary_start. Blanked and omitted parts
+ * of a packet are described but never written to it.
+ * pktlog_binary_to_text converts a whole binary log back into the
+ * text format, returning NULL on success or an error message if the
+ * log was damaged (in which case the text up to that point has still
+ * been written out).
+ */
+typedef struct PacketLogEntry {
+    int direction, type;
+    const char *texttype;
+    ptrlen data;
+    int n_blanks;
+    const struct logblank_t *blanks;
+    const unsigned long *seq;
+    unsigned downstream_id;
+    const char *additional_log_text;
+} PacketLogEntry;
+void pktlog_format_text(BinarySink *bs, const PacketLogEntry *pe,
+                        const struct tm *tm);
+void pktlog_binary_start(BinarySink *bs, time_t when);
+void pktlog_binary_text(BinarySink *bs, ptrlen text, time_t when);
+void pktlog_binary_packet(BinarySink *bs, const PacketLogEntry *pe,
+                          time_t when);
+const char *pktlog_binary_to_text(BinarySource *src, BinarySink *bs);
+
 /*
  * Exports from testback.c
  */
@@ -2635,6 +2751,8 @@ bool have_ssh_host_key(const char *host, int port, const char *keytype);
  * that aren't equivalents to things in windlg.c et al.
  */
 extern bool console_batch_mode, console_antispoof_prompt;
+extern LogContext *console_logctx;
+void console_free_log(void);
 SeatPromptResult console_get_userpass_input(prompts_t *p);
 bool is_interactive(void);
 void console_print_error_msg(const char *prefix, const char *msg);
@@ -563,8 +563,11 @@ void save_open_settings(settings_w *sesskey, Conf *conf)
     write_setting_i(sesskey, "LogFileClash", conf_get_int(conf, CONF_logxfovr));
     write_setting_b(sesskey, "LogFlush", conf_get_bool(conf, CONF_logflush));
     write_setting_b(sesskey, "LogHeader", conf_get_bool(conf, CONF_logheader));
+    write_setting_i(sesskey, "LogWriter", conf_get_int(conf, CONF_logwriter));
+    write_setting_b(sesskey, "LogCompress", conf_get_bool(conf, CONF_logcompress));
     write_setting_b(sesskey, "SSHLogOmitPasswords", conf_get_bool(conf, CONF_logomitpass));
     write_setting_b(sesskey, "SSHLogOmitData", conf_get_bool(conf, CONF_logomitdata));
+    write_setting_b(sesskey, "SSHLogBinary", conf_get_bool(conf, CONF_logbinary));
     p = "raw";
     {
         const struct BackendVtable *vt =
@@ -696,6 +699,7 @@ void save_open_settings(settings_w *sesskey, Conf *conf)
 #endif
                     );
     write_setting_i(sesskey, "ScrollbackLines", conf_get_int(conf, CONF_savelines));
+    write_setting_b(sesskey, "SpillScrollback", conf_get_bool(conf, CONF_spill_scrollback));
     write_setting_b(sesskey, "DECOriginMode", conf_get_bool(conf, CONF_dec_om));
     write_setting_b(sesskey, "AutoWrapMode", conf_get_bool(conf, CONF_wrap_mode));
     write_setting_b(sesskey, "LFImpliesCR", conf_get_bool(conf, CONF_lfhascr));
@@ -761,6 +765,7 @@ void save_open_settings(settings_w *sesskey, Conf *conf)
     write_setting_b(sesskey, "ScrollBarFullScreen", conf_get_bool(conf, CONF_scrollbar_in_fullscreen));
     write_setting_b(sesskey, "ScrollOnKey", conf_get_bool(conf, CONF_scroll_on_key));
     write_setting_b(sesskey, "ScrollOnDisp", conf_get_bool(conf, CONF_scroll_on_disp));
+    write_setting_i(sesskey, "UpdatePacing", conf_get_int(conf, CONF_update_pacing));
     write_setting_b(sesskey, "EraseToScrollback", conf_get_bool(conf, CONF_erase_to_scrollback));
     write_setting_i(sesskey, "LockSize", conf_get_int(conf, CONF_resize_action));
     write_setting_b(sesskey, "BCE", conf_get_bool(conf, CONF_bce));
@@ -866,8 +871,11 @@ void load_open_settings(settings_r *sesskey, Conf *conf)
     gppi(sesskey, "LogFileClash", LGXF_ASK, conf, CONF_logxfovr);
     gppb(sesskey, "LogFlush", true, conf, CONF_logflush);
     gppb(sesskey, "LogHeader", true, conf, CONF_logheader);
+    gppi(sesskey, "LogWriter", LGWR_SYNC, conf, CONF_logwriter);
+    gppb(sesskey, "LogCompress", false, conf, CONF_logcompress);
     gppb(sesskey, "SSHLogOmitPasswords", true, conf, CONF_logomitpass);
     gppb(sesskey, "SSHLogOmitData", false, conf, CONF_logomitdata);
+    gppb(sesskey, "SSHLogBinary", false, conf, CONF_logbinary);
 
     prot = gpps_raw(sesskey, "Protocol", "default");
     conf_set_int(conf, CONF_protocol, default_protocol);
@@ -1158,6 +1166,7 @@ void load_open_settings(settings_r *sesskey, Conf *conf)
 #endif
                  );
     gppi(sesskey, "ScrollbackLines", 2000, conf, CONF_savelines);
+    gppb(sesskey, "SpillScrollback", false, conf, CONF_spill_scrollback);
     gppb(sesskey, "DECOriginMode", false, conf, CONF_dec_om);
     gppb(sesskey, "AutoWrapMode", true, conf, CONF_wrap_mode);
     gppb(sesskey, "LFImpliesCR", false, conf, CONF_lfhascr);
@@ -1258,6 +1267,8 @@ void load_open_settings(settings_r *sesskey, Conf *conf)
          conf, CONF_scrollbar_in_fullscreen);
     gppb(sesskey, "ScrollOnKey", false, conf, CONF_scroll_on_key);
     gppb(sesskey, "ScrollOnDisp", true, conf, CONF_scroll_on_disp);
+    gppi(sesskey, "UpdatePacing", UPDATE_PACING_ADAPTIVE, conf,
+         CONF_update_pacing);
     gppb(sesskey, "EraseToScrollback", true, conf, CONF_erase_to_scrollback);
     gppi(sesskey, "LockSize", 0, conf, CONF_resize_action);
     gppb(sesskey, "BCE", true, conf, CONF_bce);
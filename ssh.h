@@ -472,6 +472,9 @@ struct ec_wcurve
     WeierstrassCurve *wc;
     WeierstrassPoint *G;
     mp_int *G_order;
+
+    /* Precomputed multiples of G, built on first use */
+    WeierstrassBaseTable *G_table;
 };
 
 /* Montgomery form curve */
@@ -489,6 +492,9 @@ struct ec_ecurve
     EdwardsPoint *G;
     mp_int *G_order;
     unsigned log2_cofactor;
+
+    /* Precomputed multiples of G, built on first use */
+    EdwardsBaseTable *G_table;
 };
 
 typedef enum EllipticCurveType {
@@ -1129,6 +1135,8 @@ extern const ssh_cipheralg ssh_blowfish_ssh2;
 extern const ssh_cipheralg ssh_arcfour256_ssh2;
 extern const ssh_cipheralg ssh_arcfour128_ssh2;
 extern const ssh_cipheralg ssh2_chacha20_poly1305;
+extern const ssh_cipheralg ssh2_chacha20_poly1305_avx2;
+extern const ssh_cipheralg ssh2_chacha20_poly1305_sw;
 extern const ssh2_ciphers ssh2_3des;
 extern const ssh2_ciphers ssh2_des;
 extern const ssh2_ciphers ssh2_aes;
@@ -1213,6 +1221,11 @@ extern const ssh2_macalg ssh2_aesgcm_mac_clmul;
 extern const ssh2_macalg ssh2_aesgcm_mac_neon;
 extern const ssh_compression_alg ssh_zlib;
 
+/* Bare Deflate compression, using the same compressor as ssh_zlib */
+ssh_compressor *deflate_compressor_new(void);
+void deflate_compress_finish(
+    ssh_compressor *sc, unsigned char **outblock, int *outlen);
+
 /* Special constructor: BLAKE2b can be instantiated with any hash
  * length up to 128 bytes */
 ssh_hash *blake2b_new_general(unsigned hashlen);
@@ -346,6 +346,7 @@ struct Outbuf {
     unsigned long outbits;
     int noutbits;
     bool firstblock;
+    bool zlib_header;                  /* false for a bare Deflate stream */
 };
 
 static void outbits(struct Outbuf *out, unsigned long bits, int nbits)
@@ -587,6 +588,7 @@ static ssh_compressor *zlib_compress_init(void)
     out->outbuf = NULL;
     out->outbits = out->noutbits = 0;
     out->firstblock = true;
+    out->zlib_header = true;
     comp->ectx.userdata = out;
 
     return &comp->sc;
@@ -622,7 +624,8 @@ static void zlib_compress_block(
      * algorithm.)
      */
     if (out->firstblock) {
-        outbits(out, 0x9C78, 16);
+        if (out->zlib_header)
+            outbits(out, 0x9C78, 16);
         out->firstblock = false;
 
         in_block = false;
@@ -686,6 +689,52 @@ static void zlib_compress_block(
     out->outbuf = NULL;
 }
 
+/*
+ * The same compressor can also write a bare Deflate stream, for
+ * wrapping in some other container format such as gzip. Data is
+ * passed in via ssh_compressor_compress exactly as for SSH, and
+ * everything so far is decodable after each call; but this kind of
+ * stream also has to be properly terminated when it's finished with.
+ */
+ssh_compressor *deflate_compressor_new(void)
+{
+    ssh_compressor *sc = zlib_compress_init();
+    struct ssh_zlib_compressor *comp =
+        container_of(sc, struct ssh_zlib_compressor, sc);
+    struct Outbuf *out = (struct Outbuf *) comp->ectx.userdata;
+    out->zlib_header = false;
+    return sc;
+}
+
+void deflate_compress_finish(
+    ssh_compressor *sc, unsigned char **outblock, int *outlen)
+{
+    struct ssh_zlib_compressor *comp =
+        container_of(sc, struct ssh_zlib_compressor, sc);
+    struct Outbuf *out = (struct Outbuf *) comp->ectx.userdata;
+
+    assert(!out->zlib_header);
+    assert(!out->outbuf);
+    out->outbuf = strbuf_new_nm();
+
+    /*
+     * After each compressed block we've left a new static block open,
+     * so close that first. Then send an empty static block with
+     * BFINAL set (1 then 01, transmitted in the order 10 1), and pad
+     * to a byte boundary.
+     */
+    if (!out->firstblock)
+        outbits(out, 0, 7);            /* close block */
+    outbits(out, 3, 3);                /* open final static block */
+    outbits(out, 0, 7);                /* and close it again */
+    if (out->noutbits)
+        outbits(out, 0, 8 - out->noutbits);
+
+    *outlen = out->outbuf->len;
+    *outblock = (unsigned char *)strbuf_to_str(out->outbuf);
+    out->outbuf = NULL;
+}
+
 /* ----------------------------------------------------------------------
  * Zlib decompression. Of course, even though our compressor always
  * uses static trees, our _decompressor_ has to be capable of
@@ -318,8 +318,15 @@ static const shape_node shapetypes[] = {
     /* 6D2 */ {SR, 0xFBAE},
 };
 
+#ifdef TEST
+
 /*
- * Returns the bidi character type of ch.
+ * Reference version of bidi_getType(), which returns the bidi
+ * character type of ch by binary search of an interval table. This
+ * is no longer used at run time: the interval table is the input
+ * from which the two-stage table used by the real bidi_getType() is
+ * generated, and the test program at the bottom of this file checks
+ * that the two still agree for every code point.
  *
  * The data table in this function is constructed from the Unicode
  * Character Database version 14.0.0, downloadable from unicode.org at
@@ -340,7 +347,7 @@ perl -ne '@_=split ";"; $num = hex $_[0]; $type = $_[4];' \
     UnicodeData.txt
 
  */
-unsigned char bidi_getType(int ch)
+static unsigned char bisearch_bidi_getType(int ch)
 {
     static const struct {
         int first, last, type;
@@ -1669,6 +1676,2803 @@ unsigned char bidi_getType(int ch)
     return ON;
 }
 
+#endif /* TEST */
+
+/*
+ * Returns the bidi character type of ch.
+ *
+ * This is a two-stage table lookup: ch >> 8 indexes bidi_type_pages[]
+ * to select one of the 256-entry blocks in bidi_type_blocks[], and
+ * ch & 0xFF indexes that block. Blocks with identical contents are
+ * only stored once, so the whole thing takes about 39Kb, and every
+ * character classified on the display path costs two array loads
+ * instead of a binary search over a thousand-odd intervals.
+ *
+ * The tables are generated from the interval table in
+ * bisearch_bidi_getType() above, by feeding this source file to the
+ * following Perl. So when updating to a new version of Unicode,
+ * regenerate the interval table as described there, and then rerun
+ * this.
+
+use strict;
+my (%pageno, @pages, @index);
+my @type = ("ON") x 0x110000;
+while (<>) {
+    if (/^\s*\{0x([0-9a-f]+), 0x([0-9a-f]+), (\w+)\},/) {
+        $type[$_] = $3 for hex $1 .. hex $2;
+    }
+}
+for my $p (0 .. 0x10FF) {
+    my $page = join "", map { sprintf "%-4s%s", "$type[$p*256+$_],",
+                              ($_ % 16 == 15 ? "\n        " : "") } 0..255;
+    $pageno{$page} //= push(@pages, $page) - 1;
+    push @index, $pageno{$page};
+}
+die "too many distinct pages\n" if @pages > 256;
+print "static const unsigned char bidi_type_pages[0x1100] = {\n";
+printf "    %s,\n", join ",", @index[$_*16 .. $_*16+15] for 0 .. 0x10F;
+printf "};\nstatic const unsigned char bidi_type_blocks[%d][256] = {\n",
+    scalar @pages;
+for (0 .. $#pages) {
+    (my $page = $pages[$_]) =~ s/ *\n\s+/\n        /g;
+    $page =~ s/\s+$//;
+    printf "    {\n        %s\n    },\n", $page;
+}
+print "};\n";
+
+ */
+static const unsigned char bidi_type_pages[0x1100] = {
+    0,1,2,3,4,5,6,7,8,9,10,11,12,13,14,15,
+    16,1,17,18,19,1,20,21,22,23,24,25,26,27,1,28,
+    29,30,31,32,33,34,35,34,1,34,34,34,36,37,34,34,
+    38,39,40,41,1,1,1,1,1,1,1,1,1,1,1,1,
+    1,1,1,1,1,1,1,1,1,1,1,1,1,42,1,1,
+    1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+    1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+    1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+    1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+    1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+    1,1,1,1,43,1,44,45,46,47,48,49,1,1,1,1,
+    1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+    1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+    1,1,1,1,1,1,1,50,1,1,1,1,1,1,1,1,
+    1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+    1,1,1,1,1,1,1,1,1,1,51,52,53,54,55,56,
+    57,58,59,60,61,62,1,63,64,65,66,67,68,69,70,71,
+    72,73,74,75,76,77,78,79,80,81,82,34,83,84,85,86,
+    1,1,1,87,88,89,34,34,34,34,34,34,34,34,34,90,
+    1,1,1,1,91,34,34,34,34,34,34,34,34,34,34,34,
+    34,34,34,34,1,1,92,34,34,34,34,34,34,34,34,34,
+    34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,
+    34,34,34,34,34,34,34,34,1,1,93,94,34,34,95,96,
+    1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+    1,1,1,1,1,1,1,97,1,1,1,1,98,99,34,34,
+    34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,
+    34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,100,
+    1,101,102,34,34,34,34,34,34,34,34,34,103,34,34,34,
+    34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,104,
+    105,106,107,108,109,110,111,112,1,1,113,34,34,34,34,114,
+    115,116,117,34,34,34,34,118,119,120,34,34,121,122,123,34,
+    34,124,125,34,34,34,34,34,34,34,34,126,34,34,34,34,
+    1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+    1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+    1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+    1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+    1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+    1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+    1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+    1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+    1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+    1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+    1,1,1,1,1,1,127,1,1,1,1,1,1,1,1,1,
+    1,1,1,1,1,1,1,128,129,1,1,1,1,1,1,1,
+    1,1,1,1,1,1,1,1,1,1,1,1,1,1,130,1,
+    1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+    1,1,1,1,1,1,1,1,1,1,1,131,34,34,34,34,
+    34,34,34,34,34,34,34,34,1,1,132,34,34,34,34,34,
+    1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+    1,1,1,133,34,34,34,34,34,34,34,34,34,34,34,34,
+    34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,
+    34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,
+    34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,
+    34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,
+    34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,
+    34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,
+    34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,
+    34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,
+    34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,
+    34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,
+    34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,
+    34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,
+    34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,
+    34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,
+    34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,
+    34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,
+    34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,
+    34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,
+    34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,
+    34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,
+    34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,
+    34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,
+    34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,
+    34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,
+    34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,
+    34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,
+    34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,
+    34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,
+    34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,
+    34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,
+    34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,
+    34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,
+    34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,
+    34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,
+    34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,
+    34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,
+    34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,
+    34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,
+    34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,
+    34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,
+    34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,
+    34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,
+    34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,
+    34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,
+    34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,
+    34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,
+    34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,
+    34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,
+    34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,
+    34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,
+    34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,
+    34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,
+    34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,
+    34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,
+    34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,
+    34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,
+    34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,
+    34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,
+    34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,
+    34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,
+    34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,
+    34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,
+    34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,
+    34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,
+    34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,
+    34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,
+    34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,
+    34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,
+    34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,
+    34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,
+    34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,
+    34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,
+    34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,
+    34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,
+    34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,
+    34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,
+    34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,
+    34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,
+    34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,
+    34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,
+    34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,
+    34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,
+    34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,
+    34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,
+    34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,
+    34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,
+    34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,
+    34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,
+    34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,
+    34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,
+    34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,
+    34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,
+    34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,
+    34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,
+    34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,
+    34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,
+    34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,
+    34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,
+    34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,
+    34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,
+    34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,
+    34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,
+    34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,
+    34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,
+    34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,
+    34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,
+    34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,
+    34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,
+    34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,
+    34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,
+    34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,
+    34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,
+    34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,
+    34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,
+    34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,
+    34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,
+    34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,
+    34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,
+    34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,
+    34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,
+    34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,
+    34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,
+    34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,
+    34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,
+    34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,
+    34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,
+    34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,
+    34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,
+    34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,
+    34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,
+    34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,
+    34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,
+    34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,
+    34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,
+    34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,
+    34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,
+    34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,
+    34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,
+    34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,
+    34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,
+    34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,
+    34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,
+    34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,
+    34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,
+    34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,
+    34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,
+    34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,
+    34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,
+    34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,
+    34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,
+    34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,
+    34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,
+    34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,
+    34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,
+    34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,
+    34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,
+    34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,
+    34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,
+    34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,
+    34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,
+    34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,
+    34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,
+    34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,
+    34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,
+    34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,
+    34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,
+    34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,
+    34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,
+    34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,
+    34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,
+    34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,
+    34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,
+    34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,
+    34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,
+    134,135,34,34,34,34,34,34,34,34,34,34,34,34,34,34,
+    34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,
+    34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,
+    34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,
+    34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,
+    34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,
+    34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,
+    34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,
+    34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,
+    34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,
+    34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,
+    34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,
+    34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,
+    34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,
+    34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,
+    34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,
+    1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+    1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+    1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+    1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+    1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+    1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+    1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+    1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+    1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+    1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+    1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+    1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+    1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+    1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+    1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+    1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,136,
+    1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+    1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+    1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+    1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+    1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+    1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+    1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+    1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+    1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+    1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+    1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+    1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+    1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+    1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+    1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+    1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,136,
+};
+static const unsigned char bidi_type_blocks[137][256] = {
+    {
+        BN, BN, BN, BN, BN, BN, BN, BN, BN, S,  B,  S,  WS, B,  BN, BN,
+        BN, BN, BN, BN, BN, BN, BN, BN, BN, BN, BN, BN, B,  B,  B,  S,
+        WS, ON, ON, ET, ET, ET, ON, ON, ON, ON, ON, ES, CS, ES, CS, CS,
+        EN, EN, EN, EN, EN, EN, EN, EN, EN, EN, CS, ON, ON, ON, ON, ON,
+        ON, L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,
+        L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  ON, ON, ON, ON, ON,
+        ON, L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,
+        L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  ON, ON, ON, ON, BN,
+        BN, BN, BN, BN, BN, B,  BN, BN, BN, BN, BN, BN, BN, BN, BN, BN,
+        BN, BN, BN, BN, BN, BN, BN, BN, BN, BN, BN, BN, BN, BN, BN, BN,
+        CS, ON, ET, ET, ET, ET, ON, ON, ON, ON, L,  ON, ON, BN, ON, ON,
+        ET, ET, EN, EN, ON, L,  ON, ON, ON, EN, L,  ON, ON, ON, ON, ON,
+        L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,
+        L,  L,  L,  L,  L,  L,  L,  ON, L,  L,  L,  L,  L,  L,  L,  L,
+        L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,
+        L,  L,  L,  L,  L,  L,  L,  ON, L,  L,  L,  L,  L,  L,  L,  L,
+    },
+    {
+        L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,
+        L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,
+        L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,
+        L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,
+        L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,
+        L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,
+        L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,
+        L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,
+        L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,
+        L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,
+        L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,
+        L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,
+        L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,
+        L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,
+        L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,
+        L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,
+    },
+    {
+        L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,
+        L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,
+        L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,
+        L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,
+        L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,
+        L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,
+        L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,
+        L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,
+        L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,
+        L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,
+        L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,
+        L,  L,  L,  L,  L,  L,  L,  L,  L,  ON, ON, L,  L,  L,  L,  L,
+        L,  L,  ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON,
+        L,  L,  ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON,
+        L,  L,  L,  L,  L,  ON, ON, ON, ON, ON, ON, ON, ON, ON, L,  ON,
+        ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON,
+    },
+    {
+        NSM,NSM,NSM,NSM,NSM,NSM,NSM,NSM,NSM,NSM,NSM,NSM,NSM,NSM,NSM,NSM,
+        NSM,NSM,NSM,NSM,NSM,NSM,NSM,NSM,NSM,NSM,NSM,NSM,NSM,NSM,NSM,NSM,
+        NSM,NSM,NSM,NSM,NSM,NSM,NSM,NSM,NSM,NSM,NSM,NSM,NSM,NSM,NSM,NSM,
+        NSM,NSM,NSM,NSM,NSM,NSM,NSM,NSM,NSM,NSM,NSM,NSM,NSM,NSM,NSM,NSM,
+        NSM,NSM,NSM,NSM,NSM,NSM,NSM,NSM,NSM,NSM,NSM,NSM,NSM,NSM,NSM,NSM,
+        NSM,NSM,NSM,NSM,NSM,NSM,NSM,NSM,NSM,NSM,NSM,NSM,NSM,NSM,NSM,NSM,
+        NSM,NSM,NSM,NSM,NSM,NSM,NSM,NSM,NSM,NSM,NSM,NSM,NSM,NSM,NSM,NSM,
+        L,  L,  L,  L,  ON, ON, L,  L,  ON, ON, L,  L,  L,  L,  ON, L,
+        ON, ON, ON, ON, ON, ON, L,  ON, L,  L,  L,  ON, L,  ON, L,  L,
+        L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,
+        L,  L,  ON, L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,
+        L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,
+        L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,
+        L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,
+        L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,
+        L,  L,  L,  L,  L,  L,  ON, L,  L,  L,  L,  L,  L,  L,  L,  L,
+    },
+    {
+        L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,
+        L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,
+        L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,
+        L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,
+        L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,
+        L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,
+        L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,
+        L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,
+        L,  L,  L,  NSM,NSM,NSM,NSM,NSM,NSM,NSM,L,  L,  L,  L,  L,  L,
+        L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,
+        L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,
+        L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,
+        L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,
+        L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,
+        L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,
+        L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,
+    },
+    {
+        L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,
+        L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,
+        L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,
+        ON, L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,
+        L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,
+        L,  L,  L,  L,  L,  L,  L,  ON, ON, L,  L,  L,  L,  L,  L,  L,
+        L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,
+        L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,
+        L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  ON, ON, ON, ON, ON, ET,
+        ON, NSM,NSM,NSM,NSM,NSM,NSM,NSM,NSM,NSM,NSM,NSM,NSM,NSM,NSM,NSM,
+        NSM,NSM,NSM,NSM,NSM,NSM,NSM,NSM,NSM,NSM,NSM,NSM,NSM,NSM,NSM,NSM,
+        NSM,NSM,NSM,NSM,NSM,NSM,NSM,NSM,NSM,NSM,NSM,NSM,NSM,NSM,R,  NSM,
+        R,  NSM,NSM,R,  NSM,NSM,R,  NSM,ON, ON, ON, ON, ON, ON, ON, ON,
+        R,  R,  R,  R,  R,  R,  R,  R,  R,  R,  R,  R,  R,  R,  R,  R,
+        R,  R,  R,  R,  R,  R,  R,  R,  R,  R,  R,  ON, ON, ON, ON, R,
+        R,  R,  R,  R,  R,  ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON,
+    },
+    {
+        AN, AN, AN, AN, AN, AN, ON, ON, AL, ET, ET, AL, CS, AL, ON, ON,
+        NSM,NSM,NSM,NSM,NSM,NSM,NSM,NSM,NSM,NSM,NSM,AL, AL, AL, AL, AL,
+        AL, AL, AL, AL, AL, AL, AL, AL, AL, AL, AL, AL, AL, AL, AL, AL,
+        AL, AL, AL, AL, AL, AL, AL, AL, AL, AL, AL, AL, AL, AL, AL, AL,
+        AL, AL, AL, AL, AL, AL, AL, AL, AL, AL, AL, NSM,NSM,NSM,NSM,NSM,
+        NSM,NSM,NSM,NSM,NSM,NSM,NSM,NSM,NSM,NSM,NSM,NSM,NSM,NSM,NSM,NSM,
+        AN, AN, AN, AN, AN, AN, AN, AN, AN, AN, ET, AN, AN, AL, AL, AL,
+        NSM,AL, AL, AL, AL, AL, AL, AL, AL, AL, AL, AL, AL, AL, AL, AL,
+        AL, AL, AL, AL, AL, AL, AL, AL, AL, AL, AL, AL, AL, AL, AL, AL,
+        AL, AL, AL, AL, AL, AL, AL, AL, AL, AL, AL, AL, AL, AL, AL, AL,
+        AL, AL, AL, AL, AL, AL, AL, AL, AL, AL, AL, AL, AL, AL, AL, AL,
+        AL, AL, AL, AL, AL, AL, AL, AL, AL, AL, AL, AL, AL, AL, AL, AL,
+        AL, AL, AL, AL, AL, AL, AL, AL, AL, AL, AL, AL, AL, AL, AL, AL,
+        AL, AL, AL, AL, AL, AL, NSM,NSM,NSM,NSM,NSM,NSM,NSM,AN, ON, NSM,
+        NSM,NSM,NSM,NSM,NSM,AL, AL, NSM,NSM,ON, NSM,NSM,NSM,NSM,AL, AL,
+        EN, EN, EN, EN, EN, EN, EN, EN, EN, EN, AL, AL, AL, AL, AL, AL,
+    },
+    {
+        AL, AL, AL, AL, AL, AL, AL, AL, AL, AL, AL, AL, AL, AL, ON, AL,
+        AL, NSM,AL, AL, AL, AL, AL, AL, AL, AL, AL, AL, AL, AL, AL, AL,
+        AL, AL, AL, AL, AL, AL, AL, AL, AL, AL, AL, AL, AL, AL, AL, AL,
+        NSM,NSM,NSM,NSM,NSM,NSM,NSM,NSM,NSM,NSM,NSM,NSM,NSM,NSM,NSM,NSM,
+        NSM,NSM,NSM,NSM,NSM,NSM,NSM,NSM,NSM,NSM,NSM,ON, ON, AL, AL, AL,
+        AL, AL, AL, AL, AL, AL, AL, AL, AL, AL, AL, AL, AL, AL, AL, AL,
+        AL, AL, AL, AL, AL, AL, AL, AL, AL, AL, AL, AL, AL, AL, AL, AL,
+        AL, AL, AL, AL, AL, AL, AL, AL, AL, AL, AL, AL, AL, AL, AL, AL,
+        AL, AL, AL, AL, AL, AL, AL, AL, AL, AL, AL, AL, AL, AL, AL, AL,
+        AL, AL, AL, AL, AL, AL, AL, AL, AL, AL, AL, AL, AL, AL, AL, AL,
+        AL, AL, AL, AL, AL, AL, NSM,NSM,NSM,NSM,NSM,NSM,NSM,NSM,NSM,NSM,
+        NSM,AL, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON,
+        R,  R,  R,  R,  R,  R,  R,  R,  R,  R,  R,  R,  R,  R,  R,  R,
+        R,  R,  R,  R,  R,  R,  R,  R,  R,  R,  R,  R,  R,  R,  R,  R,
+        R,  R,  R,  R,  R,  R,  R,  R,  R,  R,  R,  NSM,NSM,NSM,NSM,NSM,
+        NSM,NSM,NSM,NSM,R,  R,  ON, ON, ON, ON, R,  ON, ON, NSM,R,  R,
+    },
+    {
+        R,  R,  R,  R,  R,  R,  R,  R,  R,  R,  R,  R,  R,  R,  R,  R,
+        R,  R,  R,  R,  R,  R,  NSM,NSM,NSM,NSM,R,  NSM,NSM,NSM,NSM,NSM,
+        NSM,NSM,NSM,NSM,R,  NSM,NSM,NSM,R,  NSM,NSM,NSM,NSM,NSM,ON, ON,
+        R,  R,  R,  R,  R,  R,  R,  R,  R,  R,  R,  R,  R,  R,  R,  ON,
+        R,  R,  R,  R,  R,  R,  R,  R,  R,  R,  R,  R,  R,  R,  R,  R,
+        R,  R,  R,  R,  R,  R,  R,  R,  R,  NSM,NSM,NSM,ON, ON, R,  ON,
+        AL, AL, AL, AL, AL, AL, AL, AL, AL, AL, AL, ON, ON, ON, ON, ON,
+        AL, AL, AL, AL, AL, AL, AL, AL, AL, AL, AL, AL, AL, AL, AL, AL,
+        AL, AL, AL, AL, AL, AL, AL, AL, AL, AL, AL, AL, AL, AL, AL, ON,
+        AN, AN, ON, ON, ON, ON, ON, ON, NSM,NSM,NSM,NSM,NSM,NSM,NSM,NSM,
+        AL, AL, AL, AL, AL, AL, AL, AL, AL, AL, AL, AL, AL, AL, AL, AL,
+        AL, AL, AL, AL, AL, AL, AL, AL, AL, AL, AL, AL, AL, AL, AL, AL,
+        AL, AL, AL, AL, AL, AL, AL, AL, AL, AL, NSM,NSM,NSM,NSM,NSM,NSM,
+        NSM,NSM,NSM,NSM,NSM,NSM,NSM,NSM,NSM,NSM,NSM,NSM,NSM,NSM,NSM,NSM,
+        NSM,NSM,AN, NSM,NSM,NSM,NSM,NSM,NSM,NSM,NSM,NSM,NSM,NSM,NSM,NSM,
+        NSM,NSM,NSM,NSM,NSM,NSM,NSM,NSM,NSM,NSM,NSM,NSM,NSM,NSM,NSM,NSM,
+    },
+    {
+        NSM,NSM,NSM,L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,
+        L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,
+        L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,
+        L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  NSM,L,  NSM,L,  L,  L,
+        L,  NSM,NSM,NSM,NSM,NSM,NSM,NSM,NSM,L,  L,  L,  L,  NSM,L,  L,
+        L,  NSM,NSM,NSM,NSM,NSM,NSM,NSM,L,  L,  L,  L,  L,  L,  L,  L,
+        L,  L,  NSM,NSM,L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,
+        L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,
+        L,  NSM,L,  L,  ON, L,  L,  L,  L,  L,  L,  L,  L,  ON, ON, L,
+        L,  ON, ON, L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,
+        L,  L,  L,  L,  L,  L,  L,  L,  L,  ON, L,  L,  L,  L,  L,  L,
+        L,  ON, L,  ON, ON, ON, L,  L,  L,  L,  ON, ON, NSM,L,  L,  L,
+        L,  NSM,NSM,NSM,NSM,ON, ON, L,  L,  ON, ON, L,  L,  NSM,L,  ON,
+        ON, ON, ON, ON, ON, ON, ON, L,  ON, ON, ON, ON, L,  L,  ON, L,
+        L,  L,  NSM,NSM,ON, ON, L,  L,  L,  L,  L,  L,  L,  L,  L,  L,
+        L,  L,  ET, ET, L,  L,  L,  L,  L,  L,  L,  ET, L,  L,  NSM,ON,
+    },
+    {
+        ON, NSM,NSM,L,  ON, L,  L,  L,  L,  L,  L,  ON, ON, ON, ON, L,
+        L,  ON, ON, L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,
+        L,  L,  L,  L,  L,  L,  L,  L,  L,  ON, L,  L,  L,  L,  L,  L,
+        L,  ON, L,  L,  ON, L,  L,  ON, L,  L,  ON, ON, NSM,ON, L,  L,
+        L,  NSM,NSM,ON, ON, ON, ON, NSM,NSM,ON, ON, NSM,NSM,NSM,ON, ON,
+        ON, NSM,ON, ON, ON, ON, ON, ON, ON, L,  L,  L,  L,  ON, L,  ON,
+        ON, ON, ON, ON, ON, ON, L,  L,  L,  L,  L,  L,  L,  L,  L,  L,
+        NSM,NSM,L,  L,  L,  NSM,L,  ON, ON, ON, ON, ON, ON, ON, ON, ON,
+        ON, NSM,NSM,L,  ON, L,  L,  L,  L,  L,  L,  L,  L,  L,  ON, L,
+        L,  L,  ON, L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,
+        L,  L,  L,  L,  L,  L,  L,  L,  L,  ON, L,  L,  L,  L,  L,  L,
+        L,  ON, L,  L,  ON, L,  L,  L,  L,  L,  ON, ON, NSM,L,  L,  L,
+        L,  NSM,NSM,NSM,NSM,NSM,ON, NSM,NSM,L,  ON, L,  L,  NSM,ON, ON,
+        L,  ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON,
+        L,  L,  NSM,NSM,ON, ON, L,  L,  L,  L,  L,  L,  L,  L,  L,  L,
+        L,  ET, ON, ON, ON, ON, ON, ON, ON, L,  NSM,NSM,NSM,NSM,NSM,NSM,
+    },
+    {
+        ON, NSM,L,  L,  ON, L,  L,  L,  L,  L,  L,  L,  L,  ON, ON, L,
+        L,  ON, ON, L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,
+        L,  L,  L,  L,  L,  L,  L,  L,  L,  ON, L,  L,  L,  L,  L,  L,
+        L,  ON, L,  L,  ON, L,  L,  L,  L,  L,  ON, ON, NSM,L,  L,  NSM,
+        L,  NSM,NSM,NSM,NSM,ON, ON, L,  L,  ON, ON, L,  L,  NSM,ON, ON,
+        ON, ON, ON, ON, ON, NSM,NSM,L,  ON, ON, ON, ON, L,  L,  ON, L,
+        L,  L,  NSM,NSM,ON, ON, L,  L,  L,  L,  L,  L,  L,  L,  L,  L,
+        L,  L,  L,  L,  L,  L,  L,  L,  ON, ON, ON, ON, ON, ON, ON, ON,
+        ON, ON, NSM,L,  ON, L,  L,  L,  L,  L,  L,  ON, ON, ON, L,  L,
+        L,  ON, L,  L,  L,  L,  ON, ON, ON, L,  L,  ON, L,  ON, L,  L,
+        ON, ON, ON, L,  L,  ON, ON, ON, L,  L,  L,  ON, ON, ON, L,  L,
+        L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  ON, ON, ON, ON, L,  L,
+        NSM,L,  L,  ON, ON, ON, L,  L,  L,  ON, L,  L,  L,  NSM,ON, ON,
+        L,  ON, ON, ON, ON, ON, ON, L,  ON, ON, ON, ON, ON, ON, ON, ON,
+        ON, ON, ON, ON, ON, ON, L,  L,  L,  L,  L,  L,  L,  L,  L,  L,
+        L,  L,  L,  ON, ON, ON, ON, ON, ON, ET, ON, ON, ON, ON, ON, ON,
+    },
+    {
+        NSM,L,  L,  L,  NSM,L,  L,  L,  L,  L,  L,  L,  L,  ON, L,  L,
+        L,  ON, L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,
+        L,  L,  L,  L,  L,  L,  L,  L,  L,  ON, L,  L,  L,  L,  L,  L,
+        L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  ON, ON, NSM,L,  NSM,NSM,
+        NSM,L,  L,  L,  L,  ON, NSM,NSM,NSM,ON, NSM,NSM,NSM,NSM,ON, ON,
+        ON, ON, ON, ON, ON, NSM,NSM,ON, L,  L,  L,  ON, ON, L,  ON, ON,
+        L,  L,  NSM,NSM,ON, ON, L,  L,  L,  L,  L,  L,  L,  L,  L,  L,
+        ON, ON, ON, ON, ON, ON, ON, L,  ON, ON, ON, ON, ON, ON, ON, L,
+        L,  NSM,L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  ON, L,  L,
+        L,  ON, L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,
+        L,  L,  L,  L,  L,  L,  L,  L,  L,  ON, L,  L,  L,  L,  L,  L,
+        L,  L,  L,  L,  ON, L,  L,  L,  L,  L,  ON, ON, NSM,L,  L,  L,
+        L,  L,  L,  L,  L,  ON, L,  L,  L,  ON, L,  L,  NSM,NSM,ON, ON,
+        ON, ON, ON, ON, ON, L,  L,  ON, ON, ON, ON, ON, ON, L,  L,  ON,
+        L,  L,  NSM,NSM,ON, ON, L,  L,  L,  L,  L,  L,  L,  L,  L,  L,
+        ON, L,  L,  ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON,
+    },
+    {
+        NSM,NSM,L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  ON, L,  L,
+        L,  ON, L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,
+        L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,
+        L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  NSM,NSM,L,  L,  L,
+        L,  NSM,NSM,NSM,NSM,ON, L,  L,  L,  ON, L,  L,  L,  NSM,L,  L,
+        ON, ON, ON, ON, L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,
+        L,  L,  NSM,NSM,ON, ON, L,  L,  L,  L,  L,  L,  L,  L,  L,  L,
+        L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,
+        ON, NSM,L,  L,  ON, L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,
+        L,  L,  L,  L,  L,  L,  L,  ON, ON, ON, L,  L,  L,  L,  L,  L,
+        L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,
+        L,  L,  ON, L,  L,  L,  L,  L,  L,  L,  L,  L,  ON, L,  ON, ON,
+        L,  L,  L,  L,  L,  L,  L,  ON, ON, ON, NSM,ON, ON, ON, ON, L,
+        L,  L,  NSM,NSM,NSM,ON, NSM,ON, L,  L,  L,  L,  L,  L,  L,  L,
+        ON, ON, ON, ON, ON, ON, L,  L,  L,  L,  L,  L,  L,  L,  L,  L,
+        ON, ON, L,  L,  L,  ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON,
+    },
+    {
+        ON, L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,
+        L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,
+        L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,
+        L,  NSM,L,  L,  NSM,NSM,NSM,NSM,NSM,NSM,NSM,ON, ON, ON, ON, ET,
+        L,  L,  L,  L,  L,  L,  L,  NSM,NSM,NSM,NSM,NSM,NSM,NSM,NSM,L,
+        L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  ON, ON, ON, ON,
+        ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON,
+        ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON,
+        ON, L,  L,  ON, L,  ON, L,  L,  L,  L,  L,  ON, L,  L,  L,  L,
+        L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,
+        L,  L,  L,  L,  ON, L,  ON, L,  L,  L,  L,  L,  L,  L,  L,  L,
+        L,  NSM,L,  L,  NSM,NSM,NSM,NSM,NSM,NSM,NSM,NSM,NSM,L,  ON, ON,
+        L,  L,  L,  L,  L,  ON, L,  ON, NSM,NSM,NSM,NSM,NSM,NSM,ON, ON,
+        L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  ON, ON, L,  L,  L,  L,
+        ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON,
+        ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON,
+    },
+    {
+        L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,
+        L,  L,  L,  L,  L,  L,  L,  L,  NSM,NSM,L,  L,  L,  L,  L,  L,
+        L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,
+        L,  L,  L,  L,  L,  NSM,L,  NSM,L,  NSM,ON, ON, ON, ON, L,  L,
+        L,  L,  L,  L,  L,  L,  L,  L,  ON, L,  L,  L,  L,  L,  L,  L,
+        L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,
+        L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  ON, ON, ON,
+        ON, NSM,NSM,NSM,NSM,NSM,NSM,NSM,NSM,NSM,NSM,NSM,NSM,NSM,NSM,L,
+        NSM,NSM,NSM,NSM,NSM,L,  NSM,NSM,L,  L,  L,  L,  L,  NSM,NSM,NSM,
+        NSM,NSM,NSM,NSM,NSM,NSM,NSM,NSM,ON, NSM,NSM,NSM,NSM,NSM,NSM,NSM,
+        NSM,NSM,NSM,NSM,NSM,NSM,NSM,NSM,NSM,NSM,NSM,NSM,NSM,NSM,NSM,NSM,
+        NSM,NSM,NSM,NSM,NSM,NSM,NSM,NSM,NSM,NSM,NSM,NSM,NSM,ON, L,  L,
+        L,  L,  L,  L,  L,  L,  NSM,L,  L,  L,  L,  L,  L,  ON, L,  L,
+        L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  ON, ON, ON, ON, ON,
+        ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON,
+        ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON,
+    },
+    {
+        L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,
+        L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,
+        L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  NSM,NSM,NSM,
+        NSM,L,  NSM,NSM,NSM,NSM,NSM,NSM,L,  NSM,NSM,L,  L,  NSM,NSM,L,
+        L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,
+        L,  L,  L,  L,  L,  L,  L,  L,  NSM,NSM,L,  L,  L,  L,  NSM,NSM,
+        NSM,L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,
+        L,  NSM,NSM,NSM,NSM,L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,
+        L,  L,  NSM,L,  L,  NSM,NSM,L,  L,  L,  L,  L,  L,  NSM,L,  L,
+        L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  NSM,L,  L,
+        L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,
+        L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,
+        L,  L,  L,  L,  L,  L,  ON, L,  ON, ON, ON, ON, ON, L,  ON, ON,
+        L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,
+        L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,
+        L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,
+    },
+    {
+        L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,
+        L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,
+        L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,
+        L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,
+        L,  L,  L,  L,  L,  L,  L,  L,  L,  ON, L,  L,  L,  L,  ON, ON,
+        L,  L,  L,  L,  L,  L,  L,  ON, L,  ON, L,  L,  L,  L,  ON, ON,
+        L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,
+        L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,
+        L,  L,  L,  L,  L,  L,  L,  L,  L,  ON, L,  L,  L,  L,  ON, ON,
+        L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,
+        L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,
+        L,  ON, L,  L,  L,  L,  ON, ON, L,  L,  L,  L,  L,  L,  L,  ON,
+        L,  ON, L,  L,  L,  L,  ON, ON, L,  L,  L,  L,  L,  L,  L,  L,
+        L,  L,  L,  L,  L,  L,  L,  ON, L,  L,  L,  L,  L,  L,  L,  L,
+        L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,
+        L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,
+    },
+    {
+        L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,
+        L,  ON, L,  L,  L,  L,  ON, ON, L,  L,  L,  L,  L,  L,  L,  L,
+        L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,
+        L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,
+        L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,
+        L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  ON, ON, NSM,NSM,NSM,
+        L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,
+        L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  ON, ON, ON,
+        L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,
+        ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON,
+        L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,
+        L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,
+        L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,
+        L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,
+        L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,
+        L,  L,  L,  L,  L,  L,  ON, ON, L,  L,  L,  L,  L,  L,  ON, ON,
+    },
+    {
+        ON, L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,
+        L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,
+        L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,
+        L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,
+        L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,
+        L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,
+        L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,
+        L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,
+        L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,
+        L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,
+        L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,
+        L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,
+        L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,
+        L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,
+        L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,
+        L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,
+    },
+    {
+        L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,
+        L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,
+        L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,
+        L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,
+        L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,
+        L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,
+        L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,
+        L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,
+        WS, L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,
+        L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  ON, ON, ON, ON, ON,
+        L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,
+        L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,
+        L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,
+        L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,
+        L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,
+        L,  L,  L,  L,  L,  L,  L,  L,  L,  ON, ON, ON, ON, ON, ON, ON,
+    },
+    {
+        L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,
+        L,  L,  NSM,NSM,NSM,L,  ON, ON, ON, ON, ON, ON, ON, ON, ON, L,
+        L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,
+        L,  L,  NSM,NSM,L,  L,  L,  ON, ON, ON, ON, ON, ON, ON, ON, ON,
+        L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,
+        L,  L,  NSM,NSM,ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON,
+        L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  ON, L,  L,
+        L,  ON, NSM,NSM,ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON,
+        L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,
+        L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,
+        L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,
+        L,  L,  L,  L,  NSM,NSM,L,  NSM,NSM,NSM,NSM,NSM,NSM,NSM,L,  L,
+        L,  L,  L,  L,  L,  L,  NSM,L,  L,  NSM,NSM,NSM,NSM,NSM,NSM,NSM,
+        NSM,NSM,NSM,NSM,L,  L,  L,  L,  L,  L,  L,  ET, L,  NSM,ON, ON,
+        L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  ON, ON, ON, ON, ON, ON,
+        ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON,
+    },
+    {
+        ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, NSM,NSM,NSM,BN, NSM,
+        L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  ON, ON, ON, ON, ON, ON,
+        L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,
+        L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,
+        L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,
+        L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,
+        L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,
+        L,  L,  L,  L,  L,  L,  L,  L,  L,  ON, ON, ON, ON, ON, ON, ON,
+        L,  L,  L,  L,  L,  NSM,NSM,L,  L,  L,  L,  L,  L,  L,  L,  L,
+        L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,
+        L,  L,  L,  L,  L,  L,  L,  L,  L,  NSM,L,  ON, ON, ON, ON, ON,
+        L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,
+        L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,
+        L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,
+        L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,
+        L,  L,  L,  L,  L,  L,  ON, ON, ON, ON, ON, ON, ON, ON, ON, ON,
+    },
+    {
+        L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,
+        L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  ON,
+        NSM,NSM,NSM,L,  L,  L,  L,  NSM,NSM,L,  L,  L,  ON, ON, ON, ON,
+        L,  L,  NSM,L,  L,  L,  L,  L,  L,  NSM,NSM,NSM,ON, ON, ON, ON,
+        ON, ON, ON, ON, ON, ON, L,  L,  L,  L,  L,  L,  L,  L,  L,  L,
+        L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,
+        L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  ON, ON,
+        L,  L,  L,  L,  L,  ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON,
+        L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,
+        L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,
+        L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  ON, ON, ON, ON,
+        L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,
+        L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  ON, ON, ON, ON, ON, ON,
+        L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  ON, ON, ON, ON, ON,
+        ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON,
+        ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON,
+    },
+    {
+        L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,
+        L,  L,  L,  L,  L,  L,  L,  NSM,NSM,L,  L,  NSM,ON, ON, L,  L,
+        L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,
+        L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,
+        L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,
+        L,  L,  L,  L,  L,  L,  NSM,L,  NSM,NSM,NSM,NSM,NSM,NSM,NSM,ON,
+        NSM,L,  NSM,L,  L,  NSM,NSM,NSM,NSM,NSM,NSM,NSM,NSM,L,  L,  L,
+        L,  L,  L,  NSM,NSM,NSM,NSM,NSM,NSM,NSM,NSM,NSM,NSM,ON, ON, NSM,
+        L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  ON, ON, ON, ON, ON, ON,
+        L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  ON, ON, ON, ON, ON, ON,
+        L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  ON, ON,
+        NSM,NSM,NSM,NSM,NSM,NSM,NSM,NSM,NSM,NSM,NSM,NSM,NSM,NSM,NSM,NSM,
+        NSM,NSM,NSM,NSM,NSM,NSM,NSM,NSM,NSM,NSM,NSM,NSM,NSM,NSM,NSM,ON,
+        ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON,
+        ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON,
+        ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON,
+    },
+    {
+        NSM,NSM,NSM,NSM,L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,
+        L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,
+        L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,
+        L,  L,  L,  L,  NSM,L,  NSM,NSM,NSM,NSM,NSM,L,  NSM,L,  L,  L,
+        L,  L,  NSM,L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  ON, ON, ON,
+        L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,
+        L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  NSM,NSM,NSM,NSM,NSM,
+        NSM,NSM,NSM,NSM,L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  ON,
+        NSM,NSM,L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,
+        L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,
+        L,  L,  NSM,NSM,NSM,NSM,L,  L,  NSM,NSM,L,  NSM,NSM,NSM,L,  L,
+        L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,
+        L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,
+        L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,
+        L,  L,  L,  L,  L,  L,  NSM,L,  NSM,NSM,L,  L,  L,  NSM,L,  NSM,
+        NSM,NSM,L,  L,  ON, ON, ON, ON, ON, ON, ON, ON, L,  L,  L,  L,
+    },
+    {
+        L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,
+        L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,
+        L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  NSM,NSM,NSM,NSM,
+        NSM,NSM,NSM,NSM,L,  L,  NSM,NSM,ON, ON, ON, L,  L,  L,  L,  L,
+        L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  ON, ON, ON, L,  L,  L,
+        L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,
+        L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,
+        L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,
+        L,  L,  L,  L,  L,  L,  L,  L,  L,  ON, ON, ON, ON, ON, ON, ON,
+        L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,
+        L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,
+        L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  ON, ON, L,  L,  L,
+        L,  L,  L,  L,  L,  L,  L,  L,  ON, ON, ON, ON, ON, ON, ON, ON,
+        NSM,NSM,NSM,L,  NSM,NSM,NSM,NSM,NSM,NSM,NSM,NSM,NSM,NSM,NSM,NSM,
+        NSM,L,  NSM,NSM,NSM,NSM,NSM,NSM,NSM,L,  L,  L,  L,  NSM,L,  L,
+        L,  L,  L,  L,  NSM,L,  L,  L,  NSM,NSM,L,  ON, ON, ON, ON, ON,
+    },
+    {
+        L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,
+        L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,
+        L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,
+        L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,
+        L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,
+        L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,
+        L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,
+        L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,
+        L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,
+        L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,
+        L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,
+        L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,
+        NSM,NSM,NSM,NSM,NSM,NSM,NSM,NSM,NSM,NSM,NSM,NSM,NSM,NSM,NSM,NSM,
+        NSM,NSM,NSM,NSM,NSM,NSM,NSM,NSM,NSM,NSM,NSM,NSM,NSM,NSM,NSM,NSM,
+        NSM,NSM,NSM,NSM,NSM,NSM,NSM,NSM,NSM,NSM,NSM,NSM,NSM,NSM,NSM,NSM,
+        NSM,NSM,NSM,NSM,NSM,NSM,NSM,NSM,NSM,NSM,NSM,NSM,NSM,NSM,NSM,NSM,
+    },
+    {
+        L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,
+        L,  L,  L,  L,  L,  L,  ON, ON, L,  L,  L,  L,  L,  L,  ON, ON,
+        L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,
+        L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,
+        L,  L,  L,  L,  L,  L,  ON, ON, L,  L,  L,  L,  L,  L,  ON, ON,
+        L,  L,  L,  L,  L,  L,  L,  L,  ON, L,  ON, L,  ON, L,  ON, L,
+        L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,
+        L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  ON, ON,
+        L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,
+        L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,
+        L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,
+        L,  L,  L,  L,  L,  ON, L,  L,  L,  L,  L,  L,  L,  ON, L,  ON,
+        ON, ON, L,  L,  L,  ON, L,  L,  L,  L,  L,  L,  L,  ON, ON, ON,
+        L,  L,  L,  L,  ON, ON, L,  L,  L,  L,  L,  L,  ON, ON, ON, ON,
+        L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  ON, ON, ON,
+        ON, ON, L,  L,  L,  ON, L,  L,  L,  L,  L,  L,  L,  ON, ON, ON,
+    },
+    {
+        WS, WS, WS, WS, WS, WS, WS, WS, WS, WS, WS, BN, BN, BN, L,  R,
+        ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON,
+        ON, ON, ON, ON, ON, ON, ON, ON, WS, B,  LRE,RLE,PDF,LRO,RLO,CS,
+        ET, ET, ET, ET, ET, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON,
+        ON, ON, ON, ON, CS, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON,
+        ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, WS,
+        BN, BN, BN, BN, BN, ON, LRI,RLI,FSI,PDI,BN, BN, BN, BN, BN, BN,
+        EN, L,  ON, ON, EN, EN, EN, EN, EN, EN, ES, ES, ON, ON, ON, L,
+        EN, EN, EN, EN, EN, EN, EN, EN, EN, EN, ES, ES, ON, ON, ON, ON,
+        L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  ON, ON, ON,
+        ET, ET, ET, ET, ET, ET, ET, ET, ET, ET, ET, ET, ET, ET, ET, ET,
+        ET, ET, ET, ET, ET, ET, ET, ET, ET, ET, ET, ET, ET, ET, ET, ET,
+        ET, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON,
+        NSM,NSM,NSM,NSM,NSM,NSM,NSM,NSM,NSM,NSM,NSM,NSM,NSM,NSM,NSM,NSM,
+        NSM,NSM,NSM,NSM,NSM,NSM,NSM,NSM,NSM,NSM,NSM,NSM,NSM,NSM,NSM,NSM,
+        NSM,ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON,
+    },
+    {
+        ON, ON, L,  ON, ON, ON, ON, L,  ON, ON, L,  L,  L,  L,  L,  L,
+        L,  L,  L,  L,  ON, L,  ON, ON, ON, L,  L,  L,  L,  L,  ON, ON,
+        ON, ON, ON, ON, L,  ON, L,  ON, L,  ON, L,  L,  L,  L,  ET, L,
+        L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  ON, ON, L,  L,  L,  L,
+        ON, ON, ON, ON, ON, L,  L,  L,  L,  L,  ON, ON, ON, ON, L,  L,
+        ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON,
+        L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,
+        L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,
+        L,  L,  L,  L,  L,  L,  L,  L,  L,  ON, ON, ON, ON, ON, ON, ON,
+        ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON,
+        ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON,
+        ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON,
+        ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON,
+        ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON,
+        ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON,
+        ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON,
+    },
+    {
+        ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON,
+        ON, ON, ES, ET, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON,
+        ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON,
+        ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON,
+        ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON,
+        ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON,
+        ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON,
+        ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON,
+        ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON,
+        ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON,
+        ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON,
+        ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON,
+        ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON,
+        ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON,
+        ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON,
+        ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON,
+    },
+    {
+        ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON,
+        ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON,
+        ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON,
+        ON, ON, ON, ON, ON, ON, L,  L,  L,  L,  L,  L,  L,  L,  L,  L,
+        L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,
+        L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,
+        L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,
+        L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  ON, ON, ON, ON, ON,
+        ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON,
+        ON, ON, ON, ON, ON, L,  ON, ON, ON, ON, ON, ON, ON, ON, ON, ON,
+        ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON,
+        ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON,
+        ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON,
+        ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON,
+        ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON,
+        ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON,
+    },
+    {
+        ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON,
+        ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON,
+        ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON,
+        ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON,
+        ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON,
+        ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON,
+        ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON,
+        ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON,
+        ON, ON, ON, ON, ON, ON, ON, ON, EN, EN, EN, EN, EN, EN, EN, EN,
+        EN, EN, EN, EN, EN, EN, EN, EN, EN, EN, EN, EN, L,  L,  L,  L,
+        L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,
+        L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,
+        L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,
+        L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,
+        L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  ON, ON, ON, ON, ON, ON,
+        ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON,
+    },
+    {
+        ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON,
+        ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON,
+        ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON,
+        ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON,
+        ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON,
+        ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON,
+        ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON,
+        ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON,
+        ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON,
+        ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON,
+        ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON,
+        ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON,
+        ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON,
+        ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON,
+        ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON,
+        ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON,
+    },
+    {
+        ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON,
+        ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON,
+        ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON,
+        ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON,
+        ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON,
+        ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON,
+        ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON,
+        ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON,
+        ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON,
+        ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON,
+        ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, L,  ON, ON, ON,
+        ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON,
+        ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON,
+        ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON,
+        ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON,
+        ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON,
+    },
+    {
+        L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,
+        L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,
+        L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,
+        L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,
+        L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,
+        L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,
+        L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,
+        L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,
+        L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,
+        L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,
+        L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,
+        L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,
+        L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,
+        L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,
+        L,  L,  L,  L,  L,  ON, ON, ON, ON, ON, ON, L,  L,  L,  L,  NSM,
+        NSM,NSM,L,  L,  ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON,
+    },
+    {
+        L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,
+        L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,
+        L,  L,  L,  L,  L,  L,  ON, L,  ON, ON, ON, ON, ON, L,  ON, ON,
+        L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,
+        L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,
+        L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,
+        L,  L,  L,  L,  L,  L,  L,  L,  ON, ON, ON, ON, ON, ON, ON, L,
+        L,  ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, NSM,
+        L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,
+        L,  L,  L,  L,  L,  L,  L,  ON, ON, ON, ON, ON, ON, ON, ON, ON,
+        L,  L,  L,  L,  L,  L,  L,  ON, L,  L,  L,  L,  L,  L,  L,  ON,
+        L,  L,  L,  L,  L,  L,  L,  ON, L,  L,  L,  L,  L,  L,  L,  ON,
+        L,  L,  L,  L,  L,  L,  L,  ON, L,  L,  L,  L,  L,  L,  L,  ON,
+        L,  L,  L,  L,  L,  L,  L,  ON, L,  L,  L,  L,  L,  L,  L,  ON,
+        NSM,NSM,NSM,NSM,NSM,NSM,NSM,NSM,NSM,NSM,NSM,NSM,NSM,NSM,NSM,NSM,
+        NSM,NSM,NSM,NSM,NSM,NSM,NSM,NSM,NSM,NSM,NSM,NSM,NSM,NSM,NSM,NSM,
+    },
+    {
+        WS, ON, ON, ON, ON, L,  L,  L,  ON, ON, ON, ON, ON, ON, ON, ON,
+        ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON,
+        ON, L,  L,  L,  L,  L,  L,  L,  L,  L,  NSM,NSM,NSM,NSM,L,  L,
+        ON, L,  L,  L,  L,  L,  ON, ON, L,  L,  L,  L,  L,  ON, ON, ON,
+        ON, L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,
+        L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,
+        L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,
+        L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,
+        L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,
+        L,  L,  L,  L,  L,  L,  L,  ON, ON, NSM,NSM,ON, ON, L,  L,  L,
+        ON, L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,
+        L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,
+        L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,
+        L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,
+        L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,
+        L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  ON, L,  L,  L,  L,
+    },
+    {
+        ON, ON, ON, ON, ON, L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,
+        L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,
+        L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,
+        ON, L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,
+        L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,
+        L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,
+        L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,
+        L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,
+        L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  ON,
+        L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,
+        L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,
+        L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,
+        ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON,
+        ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON,
+        ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON,
+        L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,
+    },
+    {
+        L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,
+        L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  ON, ON, ON,
+        L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,
+        L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,
+        L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,
+        ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON,
+        L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,
+        L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  ON, ON, ON, L,
+        L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,
+        L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,
+        L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,
+        L,  ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON,
+        L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  ON, ON, ON, ON,
+        L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,
+        L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,
+        L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,
+    },
+    {
+        L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,
+        L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,
+        L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,
+        L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,
+        L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,
+        L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,
+        L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,
+        L,  L,  L,  L,  L,  L,  L,  ON, ON, ON, ON, L,  L,  L,  L,  L,
+        L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,
+        L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,
+        L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,
+        L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,
+        L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,
+        L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  ON, ON,
+        L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,
+        L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  ON,
+    },
+    {
+        L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,
+        L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,
+        L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,
+        L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,
+        L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,
+        L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,
+        L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,
+        L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,
+        L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,
+        L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,
+        L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,
+        L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,
+        ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON,
+        ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON,
+        ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON,
+        ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON,
+    },
+    {
+        L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,
+        L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,
+        L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,
+        L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,
+        L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,
+        L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,
+        L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,
+        L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,
+        L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  ON, ON, ON,
+        ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON,
+        ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON,
+        ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON,
+        ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON,
+        L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,
+        L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,
+        L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,
+    },
+    {
+        L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  ON, ON, ON,
+        L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,
+        L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  ON, ON, ON, ON,
+        ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON,
+        L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,
+        L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,
+        L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  NSM,
+        NSM,NSM,NSM,ON, NSM,NSM,NSM,NSM,NSM,NSM,NSM,NSM,NSM,NSM,ON, ON,
+        L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,
+        L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  NSM,NSM,
+        L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,
+        L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,
+        L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,
+        L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,
+        L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,
+        NSM,NSM,L,  L,  L,  L,  L,  L,  ON, ON, ON, ON, ON, ON, ON, ON,
+    },
+    {
+        ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON,
+        ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON,
+        ON, ON, L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,
+        L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,
+        L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,
+        L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,
+        L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,
+        L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,
+        L,  L,  L,  L,  L,  L,  L,  L,  ON, L,  L,  L,  L,  L,  L,  L,
+        L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,
+        L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,
+        L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,
+        L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  ON, ON, ON, ON, ON,
+        L,  L,  ON, L,  ON, L,  L,  L,  L,  L,  ON, ON, ON, ON, ON, ON,
+        ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON,
+        ON, ON, L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,
+    },
+    {
+        L,  L,  NSM,L,  L,  L,  NSM,L,  L,  L,  L,  NSM,L,  L,  L,  L,
+        L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,
+        L,  L,  L,  L,  L,  NSM,NSM,L,  ON, ON, ON, ON, NSM,ON, ON, ON,
+        L,  L,  L,  L,  L,  L,  L,  L,  ET, ET, ON, ON, ON, ON, ON, ON,
+        L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,
+        L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,
+        L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,
+        L,  L,  L,  L,  ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON,
+        L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,
+        L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,
+        L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,
+        L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,
+        L,  L,  L,  L,  NSM,NSM,ON, ON, ON, ON, ON, ON, ON, ON, L,  L,
+        L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  ON, ON, ON, ON, ON, ON,
+        NSM,NSM,NSM,NSM,NSM,NSM,NSM,NSM,NSM,NSM,NSM,NSM,NSM,NSM,NSM,NSM,
+        NSM,NSM,L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  NSM,
+    },
+    {
+        L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,
+        L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,
+        L,  L,  L,  L,  L,  L,  NSM,NSM,NSM,NSM,NSM,NSM,NSM,NSM,L,  L,
+        L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,
+        L,  L,  L,  L,  L,  L,  L,  NSM,NSM,NSM,NSM,NSM,NSM,NSM,NSM,NSM,
+        NSM,NSM,L,  L,  ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, L,
+        L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,
+        L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  ON, ON, ON,
+        NSM,NSM,NSM,L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,
+        L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,
+        L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,
+        L,  L,  L,  NSM,L,  L,  NSM,NSM,NSM,NSM,L,  L,  NSM,NSM,L,  L,
+        L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  ON, L,
+        L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  ON, ON, ON, ON, L,  L,
+        L,  L,  L,  L,  L,  NSM,L,  L,  L,  L,  L,  L,  L,  L,  L,  L,
+        L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  ON,
+    },
+    {
+        L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,
+        L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,
+        L,  L,  L,  L,  L,  L,  L,  L,  L,  NSM,NSM,NSM,NSM,NSM,NSM,L,
+        L,  NSM,NSM,L,  L,  NSM,NSM,ON, ON, ON, ON, ON, ON, ON, ON, ON,
+        L,  L,  L,  NSM,L,  L,  L,  L,  L,  L,  L,  L,  NSM,L,  ON, ON,
+        L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  ON, ON, L,  L,  L,  L,
+        L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,
+        L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  NSM,L,  L,  L,
+        L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,
+        L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,
+        L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,
+        NSM,L,  NSM,NSM,NSM,L,  L,  NSM,NSM,L,  L,  L,  L,  L,  NSM,NSM,
+        L,  NSM,L,  ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON,
+        ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, L,  L,  L,  L,  L,
+        L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  NSM,NSM,L,  L,
+        L,  L,  L,  L,  L,  L,  NSM,ON, ON, ON, ON, ON, ON, ON, ON, ON,
+    },
+    {
+        ON, L,  L,  L,  L,  L,  L,  ON, ON, L,  L,  L,  L,  L,  L,  ON,
+        ON, L,  L,  L,  L,  L,  L,  ON, ON, ON, ON, ON, ON, ON, ON, ON,
+        L,  L,  L,  L,  L,  L,  L,  ON, L,  L,  L,  L,  L,  L,  L,  ON,
+        L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,
+        L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,
+        L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,
+        L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  ON, ON, ON, ON, ON, ON,
+        L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,
+        L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,
+        L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,
+        L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,
+        L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,
+        L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,
+        L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,
+        L,  L,  L,  L,  L,  NSM,L,  L,  NSM,L,  L,  L,  L,  NSM,ON, ON,
+        L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  ON, ON, ON, ON, ON, ON,
+    },
+    {
+        L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,
+        L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,
+        L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,
+        L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,
+        L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,
+        L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,
+        L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,
+        L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,
+        L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,
+        L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,
+        L,  L,  L,  L,  ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON,
+        L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,
+        L,  L,  L,  L,  L,  L,  L,  ON, ON, ON, ON, L,  L,  L,  L,  L,
+        L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,
+        L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,
+        L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  ON, ON, ON, ON,
+    },
+    {
+        L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,
+        L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,
+        L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,
+        L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,
+        L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,
+        L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,
+        L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  ON, ON,
+        L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,
+        L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,
+        L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,
+        L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,
+        L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,
+        L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,
+        L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  ON, ON, ON, ON, ON, ON,
+        ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON,
+        ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON,
+    },
+    {
+        L,  L,  L,  L,  L,  L,  L,  ON, ON, ON, ON, ON, ON, ON, ON, ON,
+        ON, ON, ON, L,  L,  L,  L,  L,  ON, ON, ON, ON, ON, R,  NSM,R,
+        R,  R,  R,  R,  R,  R,  R,  R,  R,  ES, R,  R,  R,  R,  R,  R,
+        R,  R,  R,  R,  R,  R,  R,  ON, R,  R,  R,  R,  R,  ON, R,  ON,
+        R,  R,  ON, R,  R,  ON, R,  R,  R,  R,  R,  R,  R,  R,  R,  R,
+        AL, AL, AL, AL, AL, AL, AL, AL, AL, AL, AL, AL, AL, AL, AL, AL,
+        AL, AL, AL, AL, AL, AL, AL, AL, AL, AL, AL, AL, AL, AL, AL, AL,
+        AL, AL, AL, AL, AL, AL, AL, AL, AL, AL, AL, AL, AL, AL, AL, AL,
+        AL, AL, AL, AL, AL, AL, AL, AL, AL, AL, AL, AL, AL, AL, AL, AL,
+        AL, AL, AL, AL, AL, AL, AL, AL, AL, AL, AL, AL, AL, AL, AL, AL,
+        AL, AL, AL, AL, AL, AL, AL, AL, AL, AL, AL, AL, AL, AL, AL, AL,
+        AL, AL, AL, AL, AL, AL, AL, AL, AL, AL, AL, AL, AL, AL, AL, AL,
+        AL, AL, AL, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON,
+        ON, ON, ON, AL, AL, AL, AL, AL, AL, AL, AL, AL, AL, AL, AL, AL,
+        AL, AL, AL, AL, AL, AL, AL, AL, AL, AL, AL, AL, AL, AL, AL, AL,
+        AL, AL, AL, AL, AL, AL, AL, AL, AL, AL, AL, AL, AL, AL, AL, AL,
+    },
+    {
+        AL, AL, AL, AL, AL, AL, AL, AL, AL, AL, AL, AL, AL, AL, AL, AL,
+        AL, AL, AL, AL, AL, AL, AL, AL, AL, AL, AL, AL, AL, AL, AL, AL,
+        AL, AL, AL, AL, AL, AL, AL, AL, AL, AL, AL, AL, AL, AL, AL, AL,
+        AL, AL, AL, AL, AL, AL, AL, AL, AL, AL, AL, AL, AL, AL, AL, AL,
+        AL, AL, AL, AL, AL, AL, AL, AL, AL, AL, AL, AL, AL, AL, AL, AL,
+        AL, AL, AL, AL, AL, AL, AL, AL, AL, AL, AL, AL, AL, AL, AL, AL,
+        AL, AL, AL, AL, AL, AL, AL, AL, AL, AL, AL, AL, AL, AL, AL, AL,
+        AL, AL, AL, AL, AL, AL, AL, AL, AL, AL, AL, AL, AL, AL, AL, AL,
+        AL, AL, AL, AL, AL, AL, AL, AL, AL, AL, AL, AL, AL, AL, AL, AL,
+        AL, AL, AL, AL, AL, AL, AL, AL, AL, AL, AL, AL, AL, AL, AL, AL,
+        AL, AL, AL, AL, AL, AL, AL, AL, AL, AL, AL, AL, AL, AL, AL, AL,
+        AL, AL, AL, AL, AL, AL, AL, AL, AL, AL, AL, AL, AL, AL, AL, AL,
+        AL, AL, AL, AL, AL, AL, AL, AL, AL, AL, AL, AL, AL, AL, AL, AL,
+        AL, AL, AL, AL, AL, AL, AL, AL, AL, AL, AL, AL, AL, AL, AL, AL,
+        AL, AL, AL, AL, AL, AL, AL, AL, AL, AL, AL, AL, AL, AL, AL, AL,
+        AL, AL, AL, AL, AL, AL, AL, AL, AL, AL, AL, AL, AL, AL, AL, AL,
+    },
+    {
+        AL, AL, AL, AL, AL, AL, AL, AL, AL, AL, AL, AL, AL, AL, AL, AL,
+        AL, AL, AL, AL, AL, AL, AL, AL, AL, AL, AL, AL, AL, AL, AL, AL,
+        AL, AL, AL, AL, AL, AL, AL, AL, AL, AL, AL, AL, AL, AL, AL, AL,
+        AL, AL, AL, AL, AL, AL, AL, AL, AL, AL, AL, AL, AL, AL, ON, ON,
+        ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON,
+        AL, AL, AL, AL, AL, AL, AL, AL, AL, AL, AL, AL, AL, AL, AL, AL,
+        AL, AL, AL, AL, AL, AL, AL, AL, AL, AL, AL, AL, AL, AL, AL, AL,
+        AL, AL, AL, AL, AL, AL, AL, AL, AL, AL, AL, AL, AL, AL, AL, AL,
+        AL, AL, AL, AL, AL, AL, AL, AL, AL, AL, AL, AL, AL, AL, AL, AL,
+        ON, ON, AL, AL, AL, AL, AL, AL, AL, AL, AL, AL, AL, AL, AL, AL,
+        AL, AL, AL, AL, AL, AL, AL, AL, AL, AL, AL, AL, AL, AL, AL, AL,
+        AL, AL, AL, AL, AL, AL, AL, AL, AL, AL, AL, AL, AL, AL, AL, AL,
+        AL, AL, AL, AL, AL, AL, AL, AL, ON, ON, ON, ON, ON, ON, ON, ON,
+        ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON,
+        ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON,
+        AL, AL, AL, AL, AL, AL, AL, AL, AL, AL, AL, AL, AL, ON, ON, ON,
+    },
+    {
+        NSM,NSM,NSM,NSM,NSM,NSM,NSM,NSM,NSM,NSM,NSM,NSM,NSM,NSM,NSM,NSM,
+        ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON,
+        NSM,NSM,NSM,NSM,NSM,NSM,NSM,NSM,NSM,NSM,NSM,NSM,NSM,NSM,NSM,NSM,
+        ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON,
+        ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON,
+        CS, ON, CS, ON, ON, CS, ON, ON, ON, ON, ON, ON, ON, ON, ON, ET,
+        ON, ON, ES, ES, ON, ON, ON, ON, ON, ET, ET, ON, ON, ON, ON, ON,
+        AL, AL, AL, AL, AL, ON, AL, AL, AL, AL, AL, AL, AL, AL, AL, AL,
+        AL, AL, AL, AL, AL, AL, AL, AL, AL, AL, AL, AL, AL, AL, AL, AL,
+        AL, AL, AL, AL, AL, AL, AL, AL, AL, AL, AL, AL, AL, AL, AL, AL,
+        AL, AL, AL, AL, AL, AL, AL, AL, AL, AL, AL, AL, AL, AL, AL, AL,
+        AL, AL, AL, AL, AL, AL, AL, AL, AL, AL, AL, AL, AL, AL, AL, AL,
+        AL, AL, AL, AL, AL, AL, AL, AL, AL, AL, AL, AL, AL, AL, AL, AL,
+        AL, AL, AL, AL, AL, AL, AL, AL, AL, AL, AL, AL, AL, AL, AL, AL,
+        AL, AL, AL, AL, AL, AL, AL, AL, AL, AL, AL, AL, AL, AL, AL, AL,
+        AL, AL, AL, AL, AL, AL, AL, AL, AL, AL, AL, AL, AL, ON, ON, BN,
+    },
+    {
+        ON, ON, ON, ET, ET, ET, ON, ON, ON, ON, ON, ES, CS, ES, CS, CS,
+        EN, EN, EN, EN, EN, EN, EN, EN, EN, EN, CS, ON, ON, ON, ON, ON,
+        ON, L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,
+        L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  ON, ON, ON, ON, ON,
+        ON, L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,
+        L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  ON, ON, ON, ON, ON,
+        ON, ON, ON, ON, ON, ON, L,  L,  L,  L,  L,  L,  L,  L,  L,  L,
+        L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,
+        L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,
+        L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,
+        L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,
+        L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  ON,
+        ON, ON, L,  L,  L,  L,  L,  L,  ON, ON, L,  L,  L,  L,  L,  L,
+        ON, ON, L,  L,  L,  L,  L,  L,  ON, ON, L,  L,  L,  ON, ON, ON,
+        ET, ET, ON, ON, ON, ET, ET, ON, ON, ON, ON, ON, ON, ON, ON, ON,
+        ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON,
+    },
+    {
+        L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  ON, L,  L,  L,
+        L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,
+        L,  L,  L,  L,  L,  L,  L,  ON, L,  L,  L,  L,  L,  L,  L,  L,
+        L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  ON, L,  L,  ON, L,
+        L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  ON, ON,
+        L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  ON, ON,
+        ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON,
+        ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON,
+        L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,
+        L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,
+        L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,
+        L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,
+        L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,
+        L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,
+        L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,
+        L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  ON, ON, ON, ON, ON,
+    },
+    {
+        L,  ON, L,  ON, ON, ON, ON, L,  L,  L,  L,  L,  L,  L,  L,  L,
+        L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,
+        L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,
+        L,  L,  L,  L,  ON, ON, ON, L,  L,  L,  L,  L,  L,  L,  L,  L,
+        ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON,
+        ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON,
+        ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON,
+        ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON,
+        ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, L,  L,  ON,
+        ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON,
+        ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON,
+        ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON,
+        ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON,
+        L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,
+        L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,
+        L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  NSM,ON, ON,
+    },
+    {
+        ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON,
+        ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON,
+        ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON,
+        ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON,
+        ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON,
+        ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON,
+        ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON,
+        ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON,
+        L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,
+        L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  ON, ON, ON,
+        L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,
+        L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,
+        L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,
+        L,  ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON,
+        NSM,EN, EN, EN, EN, EN, EN, EN, EN, EN, EN, EN, EN, EN, EN, EN,
+        EN, EN, EN, EN, EN, EN, EN, EN, EN, EN, EN, EN, ON, ON, ON, ON,
+    },
+    {
+        L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,
+        L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,
+        L,  L,  L,  L,  ON, ON, ON, ON, ON, ON, ON, ON, ON, L,  L,  L,
+        L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,
+        L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  ON, ON, ON, ON, ON,
+        L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,
+        L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,
+        L,  L,  L,  L,  L,  L,  NSM,NSM,NSM,NSM,NSM,ON, ON, ON, ON, ON,
+        L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,
+        L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  ON, L,
+        L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,
+        L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,
+        L,  L,  L,  L,  ON, ON, ON, ON, L,  L,  L,  L,  L,  L,  L,  L,
+        L,  L,  L,  L,  L,  L,  ON, ON, ON, ON, ON, ON, ON, ON, ON, ON,
+        ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON,
+        ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON,
+    },
+    {
+        L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,
+        L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,
+        L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,
+        L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,
+        L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,
+        L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,
+        L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,
+        L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,
+        L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,
+        L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  ON, ON,
+        L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  ON, ON, ON, ON, ON, ON,
+        L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,
+        L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,
+        L,  L,  L,  L,  ON, ON, ON, ON, L,  L,  L,  L,  L,  L,  L,  L,
+        L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,
+        L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  ON, ON, ON, ON,
+    },
+    {
+        L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,
+        L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,
+        L,  L,  L,  L,  L,  L,  L,  L,  ON, ON, ON, ON, ON, ON, ON, ON,
+        L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,
+        L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,
+        L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,
+        L,  L,  L,  L,  ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, L,
+        L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  ON, L,  L,  L,  L,
+        L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  ON, L,  L,  L,  L,
+        L,  L,  L,  ON, L,  L,  ON, L,  L,  L,  L,  L,  L,  L,  L,  L,
+        L,  L,  ON, L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,
+        L,  L,  ON, L,  L,  L,  L,  L,  L,  L,  ON, L,  L,  ON, ON, ON,
+        ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON,
+        ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON,
+        ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON,
+        ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON,
+    },
+    {
+        L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,
+        L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,
+        L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,
+        L,  L,  L,  L,  L,  L,  L,  ON, ON, ON, ON, ON, ON, ON, ON, ON,
+        L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,
+        L,  L,  L,  L,  L,  L,  ON, ON, ON, ON, ON, ON, ON, ON, ON, ON,
+        L,  L,  L,  L,  L,  L,  L,  L,  ON, ON, ON, ON, ON, ON, ON, ON,
+        ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON,
+        L,  L,  L,  L,  L,  L,  ON, L,  L,  L,  L,  L,  L,  L,  L,  L,
+        L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,
+        L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,
+        L,  ON, L,  L,  L,  L,  L,  L,  L,  L,  L,  ON, ON, ON, ON, ON,
+        ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON,
+        ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON,
+        ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON,
+        ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON,
+    },
+    {
+        R,  R,  R,  R,  R,  R,  ON, ON, R,  ON, R,  R,  R,  R,  R,  R,
+        R,  R,  R,  R,  R,  R,  R,  R,  R,  R,  R,  R,  R,  R,  R,  R,
+        R,  R,  R,  R,  R,  R,  R,  R,  R,  R,  R,  R,  R,  R,  R,  R,
+        R,  R,  R,  R,  R,  R,  ON, R,  R,  ON, ON, ON, R,  ON, ON, R,
+        R,  R,  R,  R,  R,  R,  R,  R,  R,  R,  R,  R,  R,  R,  R,  R,
+        R,  R,  R,  R,  R,  R,  ON, R,  R,  R,  R,  R,  R,  R,  R,  R,
+        R,  R,  R,  R,  R,  R,  R,  R,  R,  R,  R,  R,  R,  R,  R,  R,
+        R,  R,  R,  R,  R,  R,  R,  R,  R,  R,  R,  R,  R,  R,  R,  R,
+        R,  R,  R,  R,  R,  R,  R,  R,  R,  R,  R,  R,  R,  R,  R,  R,
+        R,  R,  R,  R,  R,  R,  R,  R,  R,  R,  R,  R,  R,  R,  R,  ON,
+        ON, ON, ON, ON, ON, ON, ON, R,  R,  R,  R,  R,  R,  R,  R,  R,
+        ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON,
+        ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON,
+        ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON,
+        R,  R,  R,  R,  R,  R,  R,  R,  R,  R,  R,  R,  R,  R,  R,  R,
+        R,  R,  R,  ON, R,  R,  ON, ON, ON, ON, ON, R,  R,  R,  R,  R,
+    },
+    {
+        R,  R,  R,  R,  R,  R,  R,  R,  R,  R,  R,  R,  R,  R,  R,  R,
+        R,  R,  R,  R,  R,  R,  R,  R,  R,  R,  R,  R,  ON, ON, ON, ON,
+        R,  R,  R,  R,  R,  R,  R,  R,  R,  R,  R,  R,  R,  R,  R,  R,
+        R,  R,  R,  R,  R,  R,  R,  R,  R,  R,  ON, ON, ON, ON, ON, R,
+        ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON,
+        ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON,
+        ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON,
+        ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON,
+        R,  R,  R,  R,  R,  R,  R,  R,  R,  R,  R,  R,  R,  R,  R,  R,
+        R,  R,  R,  R,  R,  R,  R,  R,  R,  R,  R,  R,  R,  R,  R,  R,
+        R,  R,  R,  R,  R,  R,  R,  R,  R,  R,  R,  R,  R,  R,  R,  R,
+        R,  R,  R,  R,  R,  R,  R,  R,  ON, ON, ON, ON, R,  R,  R,  R,
+        R,  R,  R,  R,  R,  R,  R,  R,  R,  R,  R,  R,  R,  R,  R,  R,
+        ON, ON, R,  R,  R,  R,  R,  R,  R,  R,  R,  R,  R,  R,  R,  R,
+        R,  R,  R,  R,  R,  R,  R,  R,  R,  R,  R,  R,  R,  R,  R,  R,
+        R,  R,  R,  R,  R,  R,  R,  R,  R,  R,  R,  R,  R,  R,  R,  R,
+    },
+    {
+        R,  NSM,NSM,NSM,ON, NSM,NSM,ON, ON, ON, ON, ON, NSM,NSM,NSM,NSM,
+        R,  R,  R,  R,  ON, R,  R,  R,  ON, R,  R,  R,  R,  R,  R,  R,
+        R,  R,  R,  R,  R,  R,  R,  R,  R,  R,  R,  R,  R,  R,  R,  R,
+        R,  R,  R,  R,  R,  R,  ON, ON, NSM,NSM,NSM,ON, ON, ON, ON, NSM,
+        R,  R,  R,  R,  R,  R,  R,  R,  R,  ON, ON, ON, ON, ON, ON, ON,
+        R,  R,  R,  R,  R,  R,  R,  R,  R,  ON, ON, ON, ON, ON, ON, ON,
+        R,  R,  R,  R,  R,  R,  R,  R,  R,  R,  R,  R,  R,  R,  R,  R,
+        R,  R,  R,  R,  R,  R,  R,  R,  R,  R,  R,  R,  R,  R,  R,  R,
+        R,  R,  R,  R,  R,  R,  R,  R,  R,  R,  R,  R,  R,  R,  R,  R,
+        R,  R,  R,  R,  R,  R,  R,  R,  R,  R,  R,  R,  R,  R,  R,  R,
+        ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON,
+        ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON,
+        R,  R,  R,  R,  R,  R,  R,  R,  R,  R,  R,  R,  R,  R,  R,  R,
+        R,  R,  R,  R,  R,  R,  R,  R,  R,  R,  R,  R,  R,  R,  R,  R,
+        R,  R,  R,  R,  R,  NSM,NSM,ON, ON, ON, ON, R,  R,  R,  R,  R,
+        R,  R,  R,  R,  R,  R,  R,  ON, ON, ON, ON, ON, ON, ON, ON, ON,
+    },
+    {
+        R,  R,  R,  R,  R,  R,  R,  R,  R,  R,  R,  R,  R,  R,  R,  R,
+        R,  R,  R,  R,  R,  R,  R,  R,  R,  R,  R,  R,  R,  R,  R,  R,
+        R,  R,  R,  R,  R,  R,  R,  R,  R,  R,  R,  R,  R,  R,  R,  R,
+        R,  R,  R,  R,  R,  R,  ON, ON, ON, ON, ON, ON, ON, ON, ON, ON,
+        R,  R,  R,  R,  R,  R,  R,  R,  R,  R,  R,  R,  R,  R,  R,  R,
+        R,  R,  R,  R,  R,  R,  ON, ON, R,  R,  R,  R,  R,  R,  R,  R,
+        R,  R,  R,  R,  R,  R,  R,  R,  R,  R,  R,  R,  R,  R,  R,  R,
+        R,  R,  R,  ON, ON, ON, ON, ON, R,  R,  R,  R,  R,  R,  R,  R,
+        R,  R,  R,  R,  R,  R,  R,  R,  R,  R,  R,  R,  R,  R,  R,  R,
+        R,  R,  ON, ON, ON, ON, ON, ON, ON, R,  R,  R,  R,  ON, ON, ON,
+        ON, ON, ON, ON, ON, ON, ON, ON, ON, R,  R,  R,  R,  R,  R,  R,
+        ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON,
+        ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON,
+        ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON,
+        ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON,
+        ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON,
+    },
+    {
+        R,  R,  R,  R,  R,  R,  R,  R,  R,  R,  R,  R,  R,  R,  R,  R,
+        R,  R,  R,  R,  R,  R,  R,  R,  R,  R,  R,  R,  R,  R,  R,  R,
+        R,  R,  R,  R,  R,  R,  R,  R,  R,  R,  R,  R,  R,  R,  R,  R,
+        R,  R,  R,  R,  R,  R,  R,  R,  R,  R,  R,  R,  R,  R,  R,  R,
+        R,  R,  R,  R,  R,  R,  R,  R,  R,  ON, ON, ON, ON, ON, ON, ON,
+        ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON,
+        ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON,
+        ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON,
+        R,  R,  R,  R,  R,  R,  R,  R,  R,  R,  R,  R,  R,  R,  R,  R,
+        R,  R,  R,  R,  R,  R,  R,  R,  R,  R,  R,  R,  R,  R,  R,  R,
+        R,  R,  R,  R,  R,  R,  R,  R,  R,  R,  R,  R,  R,  R,  R,  R,
+        R,  R,  R,  ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON,
+        R,  R,  R,  R,  R,  R,  R,  R,  R,  R,  R,  R,  R,  R,  R,  R,
+        R,  R,  R,  R,  R,  R,  R,  R,  R,  R,  R,  R,  R,  R,  R,  R,
+        R,  R,  R,  R,  R,  R,  R,  R,  R,  R,  R,  R,  R,  R,  R,  R,
+        R,  R,  R,  ON, ON, ON, ON, ON, ON, ON, R,  R,  R,  R,  R,  R,
+    },
+    {
+        AL, AL, AL, AL, AL, AL, AL, AL, AL, AL, AL, AL, AL, AL, AL, AL,
+        AL, AL, AL, AL, AL, AL, AL, AL, AL, AL, AL, AL, AL, AL, AL, AL,
+        AL, AL, AL, AL, NSM,NSM,NSM,NSM,ON, ON, ON, ON, ON, ON, ON, ON,
+        AN, AN, AN, AN, AN, AN, AN, AN, AN, AN, ON, ON, ON, ON, ON, ON,
+        ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON,
+        ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON,
+        ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON,
+        ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON,
+        ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON,
+        ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON,
+        ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON,
+        ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON,
+        ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON,
+        ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON,
+        ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON,
+        ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON,
+    },
+    {
+        ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON,
+        ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON,
+        ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON,
+        ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON,
+        ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON,
+        ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON,
+        AN, AN, AN, AN, AN, AN, AN, AN, AN, AN, AN, AN, AN, AN, AN, AN,
+        AN, AN, AN, AN, AN, AN, AN, AN, AN, AN, AN, AN, AN, AN, AN, ON,
+        R,  R,  R,  R,  R,  R,  R,  R,  R,  R,  R,  R,  R,  R,  R,  R,
+        R,  R,  R,  R,  R,  R,  R,  R,  R,  R,  R,  R,  R,  R,  R,  R,
+        R,  R,  R,  R,  R,  R,  R,  R,  R,  R,  ON, NSM,NSM,R,  ON, ON,
+        R,  R,  ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON,
+        ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON,
+        ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON,
+        ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON,
+        ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON,
+    },
+    {
+        R,  R,  R,  R,  R,  R,  R,  R,  R,  R,  R,  R,  R,  R,  R,  R,
+        R,  R,  R,  R,  R,  R,  R,  R,  R,  R,  R,  R,  R,  R,  R,  R,
+        R,  R,  R,  R,  R,  R,  R,  R,  ON, ON, ON, ON, ON, ON, ON, ON,
+        AL, AL, AL, AL, AL, AL, AL, AL, AL, AL, AL, AL, AL, AL, AL, AL,
+        AL, AL, AL, AL, AL, AL, NSM,NSM,NSM,NSM,NSM,NSM,NSM,NSM,NSM,NSM,
+        NSM,AL, AL, AL, AL, AL, AL, AL, AL, AL, ON, ON, ON, ON, ON, ON,
+        ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON,
+        R,  R,  R,  R,  R,  R,  R,  R,  R,  R,  R,  R,  R,  R,  R,  R,
+        R,  R,  NSM,NSM,NSM,NSM,R,  R,  R,  R,  ON, ON, ON, ON, ON, ON,
+        ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON,
+        ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON,
+        R,  R,  R,  R,  R,  R,  R,  R,  R,  R,  R,  R,  R,  R,  R,  R,
+        R,  R,  R,  R,  R,  R,  R,  R,  R,  R,  R,  R,  ON, ON, ON, ON,
+        ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON,
+        R,  R,  R,  R,  R,  R,  R,  R,  R,  R,  R,  R,  R,  R,  R,  R,
+        R,  R,  R,  R,  R,  R,  R,  ON, ON, ON, ON, ON, ON, ON, ON, ON,
+    },
+    {
+        L,  NSM,L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,
+        L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,
+        L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,
+        L,  L,  L,  L,  L,  L,  L,  L,  NSM,NSM,NSM,NSM,NSM,NSM,NSM,NSM,
+        NSM,NSM,NSM,NSM,NSM,NSM,NSM,L,  L,  L,  L,  L,  L,  L,  ON, ON,
+        ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON,
+        ON, ON, ON, ON, ON, ON, L,  L,  L,  L,  L,  L,  L,  L,  L,  L,
+        NSM,L,  L,  NSM,NSM,L,  ON, ON, ON, ON, ON, ON, ON, ON, ON, NSM,
+        NSM,NSM,L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,
+        L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,
+        L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,
+        L,  L,  L,  NSM,NSM,NSM,NSM,L,  L,  NSM,NSM,L,  L,  L,  L,  L,
+        L,  L,  NSM,ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, L,  ON, ON,
+        L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,
+        L,  L,  L,  L,  L,  L,  L,  L,  L,  ON, ON, ON, ON, ON, ON, ON,
+        L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  ON, ON, ON, ON, ON, ON,
+    },
+    {
+        NSM,NSM,NSM,L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,
+        L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,
+        L,  L,  L,  L,  L,  L,  L,  NSM,NSM,NSM,NSM,NSM,L,  NSM,NSM,NSM,
+        NSM,NSM,NSM,NSM,NSM,ON, L,  L,  L,  L,  L,  L,  L,  L,  L,  L,
+        L,  L,  L,  L,  L,  L,  L,  L,  ON, ON, ON, ON, ON, ON, ON, ON,
+        L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,
+        L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,
+        L,  L,  L,  NSM,L,  L,  L,  ON, ON, ON, ON, ON, ON, ON, ON, ON,
+        NSM,NSM,L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,
+        L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,
+        L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,
+        L,  L,  L,  L,  L,  L,  NSM,NSM,NSM,NSM,NSM,NSM,NSM,NSM,NSM,L,
+        L,  L,  L,  L,  L,  L,  L,  L,  L,  NSM,NSM,NSM,NSM,L,  L,  NSM,
+        L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,
+        ON, L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,
+        L,  L,  L,  L,  L,  ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON,
+    },
+    {
+        L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,
+        L,  L,  ON, L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,
+        L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  NSM,
+        NSM,NSM,L,  L,  NSM,L,  NSM,NSM,L,  L,  L,  L,  L,  L,  NSM,ON,
+        ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON,
+        ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON,
+        ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON,
+        ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON,
+        L,  L,  L,  L,  L,  L,  L,  ON, L,  ON, L,  L,  L,  L,  ON, L,
+        L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  ON, L,
+        L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  ON, ON, ON, ON, ON, ON,
+        L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,
+        L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,
+        L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  NSM,
+        L,  L,  L,  NSM,NSM,NSM,NSM,NSM,NSM,NSM,NSM,ON, ON, ON, ON, ON,
+        L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  ON, ON, ON, ON, ON, ON,
+    },
+    {
+        NSM,NSM,L,  L,  ON, L,  L,  L,  L,  L,  L,  L,  L,  ON, ON, L,
+        L,  ON, ON, L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,
+        L,  L,  L,  L,  L,  L,  L,  L,  L,  ON, L,  L,  L,  L,  L,  L,
+        L,  ON, L,  L,  ON, L,  L,  L,  L,  L,  ON, NSM,NSM,L,  L,  L,
+        NSM,L,  L,  L,  L,  ON, ON, L,  L,  ON, ON, L,  L,  L,  ON, ON,
+        L,  ON, ON, ON, ON, ON, ON, L,  ON, ON, ON, ON, ON, L,  L,  L,
+        L,  L,  L,  L,  ON, ON, NSM,NSM,NSM,NSM,NSM,NSM,NSM,ON, ON, ON,
+        NSM,NSM,NSM,NSM,NSM,ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON,
+        ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON,
+        ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON,
+        ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON,
+        ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON,
+        ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON,
+        ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON,
+        ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON,
+        ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON,
+    },
+    {
+        L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,
+        L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,
+        L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,
+        L,  L,  L,  L,  L,  L,  L,  L,  NSM,NSM,NSM,NSM,NSM,NSM,NSM,NSM,
+        L,  L,  NSM,NSM,NSM,L,  NSM,L,  L,  L,  L,  L,  L,  L,  L,  L,
+        L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  ON, L,  NSM,L,
+        L,  L,  ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON,
+        ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON,
+        L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,
+        L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,
+        L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,
+        L,  L,  L,  NSM,NSM,NSM,NSM,NSM,NSM,L,  NSM,L,  L,  L,  L,  NSM,
+        NSM,L,  NSM,NSM,L,  L,  L,  L,  ON, ON, ON, ON, ON, ON, ON, ON,
+        L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  ON, ON, ON, ON, ON, ON,
+        ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON,
+        ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON,
+    },
+    {
+        ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON,
+        ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON,
+        ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON,
+        ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON,
+        ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON,
+        ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON,
+        ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON,
+        ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON,
+        L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,
+        L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,
+        L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,
+        L,  L,  NSM,NSM,NSM,NSM,ON, ON, L,  L,  L,  L,  NSM,NSM,L,  NSM,
+        NSM,L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,
+        L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  NSM,NSM,ON, ON,
+        ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON,
+        ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON,
+    },
+    {
+        L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,
+        L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,
+        L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,
+        L,  L,  L,  NSM,NSM,NSM,NSM,NSM,NSM,NSM,NSM,L,  L,  NSM,L,  NSM,
+        NSM,L,  L,  L,  L,  ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON,
+        L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  ON, ON, ON, ON, ON, ON,
+        ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON,
+        ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON,
+        L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,
+        L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,
+        L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  NSM,L,  NSM,L,  L,
+        NSM,NSM,NSM,NSM,NSM,NSM,L,  NSM,L,  L,  ON, ON, ON, ON, ON, ON,
+        L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  ON, ON, ON, ON, ON, ON,
+        ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON,
+        ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON,
+        ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON,
+    },
+    {
+        L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,
+        L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  ON, ON, NSM,NSM,NSM,
+        L,  L,  NSM,NSM,NSM,NSM,L,  NSM,NSM,NSM,NSM,NSM,ON, ON, ON, ON,
+        L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,
+        L,  L,  L,  L,  L,  L,  L,  ON, ON, ON, ON, ON, ON, ON, ON, ON,
+        ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON,
+        ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON,
+        ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON,
+        ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON,
+        ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON,
+        ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON,
+        ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON,
+        ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON,
+        ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON,
+        ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON,
+        ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON,
+    },
+    {
+        L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,
+        L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,
+        L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  NSM,
+        NSM,NSM,NSM,NSM,NSM,NSM,NSM,NSM,L,  NSM,NSM,L,  ON, ON, ON, ON,
+        ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON,
+        ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON,
+        ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON,
+        ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON,
+        ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON,
+        ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON,
+        L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,
+        L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,
+        L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,
+        L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,
+        L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,
+        L,  L,  L,  ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, L,
+    },
+    {
+        L,  L,  L,  L,  L,  L,  L,  ON, ON, L,  ON, ON, L,  L,  L,  L,
+        L,  L,  L,  L,  ON, L,  L,  ON, L,  L,  L,  L,  L,  L,  L,  L,
+        L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,
+        L,  L,  L,  L,  L,  L,  ON, L,  L,  ON, ON, NSM,NSM,L,  NSM,L,
+        L,  L,  L,  NSM,L,  L,  L,  ON, ON, ON, ON, ON, ON, ON, ON, ON,
+        L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  ON, ON, ON, ON, ON, ON,
+        ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON,
+        ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON,
+        ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON,
+        ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON,
+        L,  L,  L,  L,  L,  L,  L,  L,  ON, ON, L,  L,  L,  L,  L,  L,
+        L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,
+        L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,
+        L,  L,  L,  L,  NSM,NSM,NSM,NSM,ON, ON, NSM,NSM,L,  L,  L,  L,
+        NSM,L,  L,  L,  L,  ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON,
+        ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON,
+    },
+    {
+        L,  NSM,NSM,NSM,NSM,NSM,NSM,L,  L,  NSM,NSM,L,  L,  L,  L,  L,
+        L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,
+        L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,
+        L,  L,  L,  NSM,NSM,NSM,NSM,NSM,NSM,L,  L,  NSM,NSM,NSM,NSM,L,
+        L,  L,  L,  L,  L,  L,  L,  NSM,ON, ON, ON, ON, ON, ON, ON, ON,
+        L,  NSM,NSM,NSM,NSM,NSM,NSM,L,  L,  NSM,NSM,NSM,L,  L,  L,  L,
+        L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,
+        L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,
+        L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  NSM,NSM,NSM,NSM,NSM,NSM,
+        NSM,NSM,NSM,NSM,NSM,NSM,NSM,L,  NSM,NSM,L,  L,  L,  L,  L,  L,
+        L,  L,  L,  ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON,
+        L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,
+        L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,
+        L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,
+        L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,
+        L,  L,  L,  L,  L,  L,  L,  L,  L,  ON, ON, ON, ON, ON, ON, ON,
+    },
+    {
+        L,  L,  L,  L,  L,  L,  L,  L,  L,  ON, L,  L,  L,  L,  L,  L,
+        L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,
+        L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,
+        NSM,NSM,NSM,NSM,NSM,NSM,NSM,ON, NSM,NSM,NSM,NSM,NSM,NSM,L,  L,
+        L,  L,  L,  L,  L,  L,  ON, ON, ON, ON, ON, ON, ON, ON, ON, ON,
+        L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,
+        L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  ON, ON, ON,
+        L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,
+        L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,
+        ON, ON, NSM,NSM,NSM,NSM,NSM,NSM,NSM,NSM,NSM,NSM,NSM,NSM,NSM,NSM,
+        NSM,NSM,NSM,NSM,NSM,NSM,NSM,NSM,ON, L,  NSM,NSM,NSM,NSM,NSM,NSM,
+        NSM,L,  NSM,NSM,L,  NSM,NSM,ON, ON, ON, ON, ON, ON, ON, ON, ON,
+        ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON,
+        ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON,
+        ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON,
+        ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON,
+    },
+    {
+        L,  L,  L,  L,  L,  L,  L,  ON, L,  L,  ON, L,  L,  L,  L,  L,
+        L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,
+        L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,
+        L,  NSM,NSM,NSM,NSM,NSM,NSM,ON, ON, ON, NSM,ON, NSM,NSM,ON, NSM,
+        NSM,NSM,NSM,NSM,NSM,NSM,L,  NSM,ON, ON, ON, ON, ON, ON, ON, ON,
+        L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  ON, ON, ON, ON, ON, ON,
+        L,  L,  L,  L,  L,  L,  ON, L,  L,  ON, L,  L,  L,  L,  L,  L,
+        L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,
+        L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  ON,
+        NSM,NSM,ON, L,  L,  NSM,L,  NSM,L,  ON, ON, ON, ON, ON, ON, ON,
+        L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  ON, ON, ON, ON, ON, ON,
+        ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON,
+        ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON,
+        ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON,
+        ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON,
+        ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON,
+    },
+    {
+        ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON,
+        ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON,
+        ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON,
+        ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON,
+        ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON,
+        ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON,
+        ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON,
+        ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON,
+        ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON,
+        ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON,
+        ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON,
+        ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON,
+        ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON,
+        ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON,
+        L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,
+        L,  L,  L,  NSM,NSM,L,  L,  L,  L,  ON, ON, ON, ON, ON, ON, ON,
+    },
+    {
+        ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON,
+        ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON,
+        ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON,
+        ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON,
+        ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON,
+        ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON,
+        ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON,
+        ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON,
+        ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON,
+        ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON,
+        ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON,
+        L,  ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON,
+        L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,
+        L,  L,  L,  L,  L,  ON, ON, ON, ON, ON, ON, ON, ON, ET, ET, ET,
+        ET, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON,
+        ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, L,
+    },
+    {
+        L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,
+        L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,
+        L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,
+        L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,
+        L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,
+        L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,
+        L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,
+        L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,
+        L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,
+        L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  ON, ON, ON, ON, ON, ON,
+        ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON,
+        ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON,
+        ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON,
+        ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON,
+        ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON,
+        ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON,
+    },
+    {
+        L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,
+        L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,
+        L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,
+        L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,
+        L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,
+        L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,
+        L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  ON,
+        L,  L,  L,  L,  L,  ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON,
+        L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,
+        L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,
+        L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,
+        L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,
+        L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,
+        L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,
+        L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,
+        L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,
+    },
+    {
+        L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,
+        L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,
+        L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,
+        L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,
+        L,  L,  L,  L,  ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON,
+        ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON,
+        ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON,
+        ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON,
+        ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON,
+        ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON,
+        ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON,
+        ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON,
+        ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON,
+        ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON,
+        ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON,
+        ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON,
+    },
+    {
+        ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON,
+        ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON,
+        ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON,
+        ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON,
+        ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON,
+        ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON,
+        ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON,
+        ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON,
+        ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON,
+        L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,
+        L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,
+        L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,
+        L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,
+        L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,
+        L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,
+        L,  L,  L,  ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON,
+    },
+    {
+        L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,
+        L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,
+        L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  ON,
+        L,  L,  L,  L,  L,  L,  L,  L,  L,  ON, ON, ON, ON, ON, ON, ON,
+        ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON,
+        ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON,
+        ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON,
+        ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON,
+        ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON,
+        ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON,
+        ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON,
+        ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON,
+        ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON,
+        ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON,
+        ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON,
+        ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON,
+    },
+    {
+        L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,
+        L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,
+        L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,
+        L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,
+        L,  L,  L,  L,  L,  L,  L,  ON, ON, ON, ON, ON, ON, ON, ON, ON,
+        ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON,
+        ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON,
+        ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON,
+        ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON,
+        ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON,
+        ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON,
+        ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON,
+        ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON,
+        ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON,
+        ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON,
+        ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON,
+    },
+    {
+        L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,
+        L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,
+        L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,
+        L,  L,  L,  L,  L,  L,  L,  L,  L,  ON, ON, ON, ON, ON, ON, ON,
+        L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,
+        L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  ON,
+        L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  ON, ON, ON, ON, L,  L,
+        L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,
+        L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,
+        L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,
+        L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,
+        L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  ON,
+        L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  ON, ON, ON, ON, ON, ON,
+        L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,
+        L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  ON, ON,
+        NSM,NSM,NSM,NSM,NSM,L,  ON, ON, ON, ON, ON, ON, ON, ON, ON, ON,
+    },
+    {
+        L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,
+        L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,
+        L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,
+        NSM,NSM,NSM,NSM,NSM,NSM,NSM,L,  L,  L,  L,  L,  L,  L,  L,  L,
+        L,  L,  L,  L,  L,  L,  ON, ON, ON, ON, ON, ON, ON, ON, ON, ON,
+        L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  ON, L,  L,  L,  L,  L,
+        L,  L,  ON, L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,
+        L,  L,  L,  L,  L,  L,  L,  L,  ON, ON, ON, ON, ON, L,  L,  L,
+        L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,
+        ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON,
+        ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON,
+        ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON,
+        ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON,
+        ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON,
+        ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON,
+        ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON,
+    },
+    {
+        ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON,
+        ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON,
+        ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON,
+        ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON,
+        L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,
+        L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,
+        L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,
+        L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,
+        L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,
+        L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  ON, ON, ON, ON, ON,
+        ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON,
+        ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON,
+        ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON,
+        ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON,
+        ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON,
+        ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON,
+    },
+    {
+        L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,
+        L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,
+        L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,
+        L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,
+        L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  ON, ON, ON, ON, NSM,
+        L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,
+        L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,
+        L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,
+        L,  L,  L,  L,  L,  L,  L,  L,  ON, ON, ON, ON, ON, ON, ON, NSM,
+        NSM,NSM,NSM,L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,
+        ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON,
+        ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON,
+        ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON,
+        ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON,
+        L,  L,  ON, L,  NSM,ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON,
+        L,  L,  ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON,
+    },
+    {
+        L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,
+        L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,
+        L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,
+        L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,
+        L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,
+        L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,
+        L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,
+        L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,
+        L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,
+        L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,
+        L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,
+        L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,
+        L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,
+        L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,
+        L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,
+        L,  L,  L,  L,  L,  L,  L,  L,  ON, ON, ON, ON, ON, ON, ON, ON,
+    },
+    {
+        L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,
+        L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,
+        L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,
+        L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,
+        L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,
+        L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,
+        L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,
+        L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,
+        L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,
+        L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,
+        L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,
+        L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,
+        L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,
+        L,  L,  L,  L,  L,  L,  ON, ON, ON, ON, ON, ON, ON, ON, ON, ON,
+        ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON,
+        ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON,
+    },
+    {
+        L,  L,  L,  L,  L,  L,  L,  L,  L,  ON, ON, ON, ON, ON, ON, ON,
+        ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON,
+        ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON,
+        ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON,
+        ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON,
+        ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON,
+        ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON,
+        ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON,
+        ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON,
+        ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON,
+        ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON,
+        ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON,
+        ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON,
+        ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON,
+        ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON,
+        ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON,
+    },
+    {
+        ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON,
+        ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON,
+        ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON,
+        ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON,
+        ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON,
+        ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON,
+        ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON,
+        ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON,
+        ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON,
+        ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON,
+        ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON,
+        ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON,
+        ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON,
+        ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON,
+        ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON,
+        L,  L,  L,  L,  ON, L,  L,  L,  L,  L,  L,  L,  ON, L,  L,  ON,
+    },
+    {
+        L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,
+        L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,
+        L,  L,  L,  ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON,
+        ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON,
+        ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON,
+        L,  L,  L,  ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON,
+        ON, ON, ON, ON, L,  L,  L,  L,  ON, ON, ON, ON, ON, ON, ON, ON,
+        L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,
+        L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,
+        L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,
+        L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,
+        L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,
+        L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,
+        L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,
+        L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,
+        L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,
+    },
+    {
+        L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,
+        L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,
+        L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,
+        L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,
+        L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,
+        L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,
+        L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,
+        L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,
+        L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,
+        L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,
+        L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,
+        L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,
+        L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,
+        L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,
+        L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,
+        L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  ON, ON, ON, ON,
+    },
+    {
+        L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,
+        L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,
+        L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,
+        L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,
+        L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,
+        L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,
+        L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  ON, ON, ON, ON, ON,
+        L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  ON, ON, ON,
+        L,  L,  L,  L,  L,  L,  L,  L,  L,  ON, ON, ON, ON, ON, ON, ON,
+        L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  ON, ON, L,  NSM,NSM,L,
+        BN, BN, BN, BN, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON,
+        ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON,
+        ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON,
+        ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON,
+        ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON,
+        ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON,
+    },
+    {
+        NSM,NSM,NSM,NSM,NSM,NSM,NSM,NSM,NSM,NSM,NSM,NSM,NSM,NSM,NSM,NSM,
+        NSM,NSM,NSM,NSM,NSM,NSM,NSM,NSM,NSM,NSM,NSM,NSM,NSM,NSM,NSM,NSM,
+        NSM,NSM,NSM,NSM,NSM,NSM,NSM,NSM,NSM,NSM,NSM,NSM,NSM,NSM,ON, ON,
+        NSM,NSM,NSM,NSM,NSM,NSM,NSM,NSM,NSM,NSM,NSM,NSM,NSM,NSM,NSM,NSM,
+        NSM,NSM,NSM,NSM,NSM,NSM,NSM,ON, ON, ON, ON, ON, ON, ON, ON, ON,
+        L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,
+        L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,
+        L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,
+        L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,
+        L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,
+        L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,
+        L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,
+        L,  L,  L,  L,  ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON,
+        ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON,
+        ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON,
+        ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON,
+    },
+    {
+        L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,
+        L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,
+        L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,
+        L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,
+        L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,
+        L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,
+        L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,
+        L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,
+        L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,
+        L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,
+        L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,
+        L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,
+        L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,
+        L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,
+        L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,
+        L,  L,  L,  L,  L,  L,  ON, ON, ON, ON, ON, ON, ON, ON, ON, ON,
+    },
+    {
+        L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,
+        L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,
+        L,  L,  L,  L,  L,  L,  L,  ON, ON, L,  L,  L,  L,  L,  L,  L,
+        L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,
+        L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,
+        L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,
+        L,  L,  L,  L,  L,  L,  L,  NSM,NSM,NSM,L,  L,  L,  L,  L,  L,
+        L,  L,  L,  BN, BN, BN, BN, BN, BN, BN, BN, NSM,NSM,NSM,NSM,NSM,
+        NSM,NSM,NSM,L,  L,  NSM,NSM,NSM,NSM,NSM,NSM,NSM,L,  L,  L,  L,
+        L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,
+        L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  NSM,NSM,NSM,NSM,L,  L,
+        L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,
+        L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,
+        L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,
+        L,  L,  L,  L,  L,  L,  L,  L,  L,  ON, ON, ON, ON, ON, ON, ON,
+        ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON,
+    },
+    {
+        ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON,
+        ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON,
+        ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON,
+        ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON,
+        ON, ON, NSM,NSM,NSM,ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON,
+        ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON,
+        ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON,
+        ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON,
+        ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON,
+        ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON,
+        ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON,
+        ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON,
+        ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON,
+        ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON,
+        L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,
+        L,  L,  L,  L,  ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON,
+    },
+    {
+        ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON,
+        ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON,
+        ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON,
+        ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON,
+        ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON,
+        ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON,
+        L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,
+        L,  L,  L,  L,  L,  L,  L,  L,  L,  ON, ON, ON, ON, ON, ON, ON,
+        ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON,
+        ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON,
+        ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON,
+        ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON,
+        ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON,
+        ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON,
+        ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON,
+        ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON,
+    },
+    {
+        L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,
+        L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,
+        L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,
+        L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,
+        L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,
+        L,  L,  L,  L,  L,  ON, L,  L,  L,  L,  L,  L,  L,  L,  L,  L,
+        L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,
+        L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,
+        L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,
+        L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  ON, L,  L,
+        ON, ON, L,  ON, ON, L,  L,  ON, ON, L,  L,  L,  L,  ON, L,  L,
+        L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  ON, L,  ON, L,  L,  L,
+        L,  L,  L,  L,  ON, L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,
+        L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,
+        L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,
+        L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,
+    },
+    {
+        L,  L,  L,  L,  L,  L,  ON, L,  L,  L,  L,  ON, ON, L,  L,  L,
+        L,  L,  L,  L,  L,  ON, L,  L,  L,  L,  L,  L,  L,  ON, L,  L,
+        L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,
+        L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  ON, L,  L,  L,  L,  ON,
+        L,  L,  L,  L,  L,  ON, L,  ON, ON, ON, L,  L,  L,  L,  L,  L,
+        L,  ON, L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,
+        L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,
+        L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,
+        L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,
+        L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,
+        L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,
+        L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,
+        L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,
+        L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,
+        L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,
+        L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,
+    },
+    {
+        L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,
+        L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,
+        L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,
+        L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,
+        L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,
+        L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,
+        L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,
+        L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,
+        L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,
+        L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,
+        L,  L,  L,  L,  L,  L,  ON, ON, L,  L,  L,  L,  L,  L,  L,  L,
+        L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,
+        L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,
+        L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  ON, L,  L,  L,  L,
+        L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,
+        L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,
+    },
+    {
+        L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,
+        L,  L,  L,  L,  L,  ON, L,  L,  L,  L,  L,  L,  L,  L,  L,  L,
+        L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,
+        L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,
+        L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  ON,
+        L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,
+        L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,
+        L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,
+        L,  L,  L,  L,  L,  L,  L,  L,  L,  ON, L,  L,  L,  L,  L,  L,
+        L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,
+        L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,
+        L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,
+        L,  L,  L,  ON, L,  L,  L,  L,  L,  L,  L,  L,  ON, ON, EN, EN,
+        EN, EN, EN, EN, EN, EN, EN, EN, EN, EN, EN, EN, EN, EN, EN, EN,
+        EN, EN, EN, EN, EN, EN, EN, EN, EN, EN, EN, EN, EN, EN, EN, EN,
+        EN, EN, EN, EN, EN, EN, EN, EN, EN, EN, EN, EN, EN, EN, EN, EN,
+    },
+    {
+        NSM,NSM,NSM,NSM,NSM,NSM,NSM,NSM,NSM,NSM,NSM,NSM,NSM,NSM,NSM,NSM,
+        NSM,NSM,NSM,NSM,NSM,NSM,NSM,NSM,NSM,NSM,NSM,NSM,NSM,NSM,NSM,NSM,
+        NSM,NSM,NSM,NSM,NSM,NSM,NSM,NSM,NSM,NSM,NSM,NSM,NSM,NSM,NSM,NSM,
+        NSM,NSM,NSM,NSM,NSM,NSM,NSM,L,  L,  L,  L,  NSM,NSM,NSM,NSM,NSM,
+        NSM,NSM,NSM,NSM,NSM,NSM,NSM,NSM,NSM,NSM,NSM,NSM,NSM,NSM,NSM,NSM,
+        NSM,NSM,NSM,NSM,NSM,NSM,NSM,NSM,NSM,NSM,NSM,NSM,NSM,NSM,NSM,NSM,
+        NSM,NSM,NSM,NSM,NSM,NSM,NSM,NSM,NSM,NSM,NSM,NSM,NSM,L,  L,  L,
+        L,  L,  L,  L,  L,  NSM,L,  L,  L,  L,  L,  L,  L,  L,  L,  L,
+        L,  L,  L,  L,  NSM,L,  L,  L,  L,  L,  L,  L,  ON, ON, ON, ON,
+        ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, NSM,NSM,NSM,NSM,NSM,
+        ON, NSM,NSM,NSM,NSM,NSM,NSM,NSM,NSM,NSM,NSM,NSM,NSM,NSM,NSM,NSM,
+        ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON,
+        ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON,
+        ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON,
+        ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON,
+        ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON,
+    },
+    {
+        L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,
+        L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  ON,
+        ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON,
+        ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON,
+        ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON,
+        ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON,
+        ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON,
+        ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON,
+        ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON,
+        ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON,
+        ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON,
+        ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON,
+        ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON,
+        ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON,
+        ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON,
+        ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON,
+    },
+    {
+        NSM,NSM,NSM,NSM,NSM,NSM,NSM,ON, NSM,NSM,NSM,NSM,NSM,NSM,NSM,NSM,
+        NSM,NSM,NSM,NSM,NSM,NSM,NSM,NSM,NSM,ON, ON, NSM,NSM,NSM,NSM,NSM,
+        NSM,NSM,ON, NSM,NSM,ON, NSM,NSM,NSM,NSM,NSM,ON, ON, ON, ON, ON,
+        ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON,
+        ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON,
+        ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON,
+        ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON,
+        ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON,
+        ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON,
+        ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON,
+        ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON,
+        ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON,
+        ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON,
+        ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON,
+        ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON,
+        ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON,
+    },
+    {
+        L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,
+        L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,
+        L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  ON, ON, ON,
+        NSM,NSM,NSM,NSM,NSM,NSM,NSM,L,  L,  L,  L,  L,  L,  L,  ON, ON,
+        L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  ON, ON, ON, ON, L,  L,
+        ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON,
+        ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON,
+        ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON,
+        ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON,
+        ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON,
+        ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON,
+        ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON,
+        ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON,
+        ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON,
+        ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON,
+        ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON,
+    },
+    {
+        ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON,
+        ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON,
+        ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON,
+        ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON,
+        ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON,
+        ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON,
+        ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON,
+        ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON,
+        ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON,
+        L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,
+        L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  NSM,ON,
+        ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON,
+        L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,
+        L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,
+        L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  NSM,NSM,NSM,NSM,
+        L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  ON, ON, ON, ON, ON, ET,
+    },
+    {
+        ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON,
+        ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON,
+        ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON,
+        ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON,
+        ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON,
+        ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON,
+        ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON,
+        ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON,
+        ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON,
+        ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON,
+        ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON,
+        ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON,
+        ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON,
+        ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON,
+        L,  L,  L,  L,  L,  L,  L,  ON, L,  L,  L,  L,  ON, L,  L,  ON,
+        L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  ON,
+    },
+    {
+        R,  R,  R,  R,  R,  R,  R,  R,  R,  R,  R,  R,  R,  R,  R,  R,
+        R,  R,  R,  R,  R,  R,  R,  R,  R,  R,  R,  R,  R,  R,  R,  R,
+        R,  R,  R,  R,  R,  R,  R,  R,  R,  R,  R,  R,  R,  R,  R,  R,
+        R,  R,  R,  R,  R,  R,  R,  R,  R,  R,  R,  R,  R,  R,  R,  R,
+        R,  R,  R,  R,  R,  R,  R,  R,  R,  R,  R,  R,  R,  R,  R,  R,
+        R,  R,  R,  R,  R,  R,  R,  R,  R,  R,  R,  R,  R,  R,  R,  R,
+        R,  R,  R,  R,  R,  R,  R,  R,  R,  R,  R,  R,  R,  R,  R,  R,
+        R,  R,  R,  R,  R,  R,  R,  R,  R,  R,  R,  R,  R,  R,  R,  R,
+        R,  R,  R,  R,  R,  R,  R,  R,  R,  R,  R,  R,  R,  R,  R,  R,
+        R,  R,  R,  R,  R,  R,  R,  R,  R,  R,  R,  R,  R,  R,  R,  R,
+        R,  R,  R,  R,  R,  R,  R,  R,  R,  R,  R,  R,  R,  R,  R,  R,
+        R,  R,  R,  R,  R,  R,  R,  R,  R,  R,  R,  R,  R,  R,  R,  R,
+        R,  R,  R,  R,  R,  ON, ON, R,  R,  R,  R,  R,  R,  R,  R,  R,
+        NSM,NSM,NSM,NSM,NSM,NSM,NSM,ON, ON, ON, ON, ON, ON, ON, ON, ON,
+        ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON,
+        ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON,
+    },
+    {
+        R,  R,  R,  R,  R,  R,  R,  R,  R,  R,  R,  R,  R,  R,  R,  R,
+        R,  R,  R,  R,  R,  R,  R,  R,  R,  R,  R,  R,  R,  R,  R,  R,
+        R,  R,  R,  R,  R,  R,  R,  R,  R,  R,  R,  R,  R,  R,  R,  R,
+        R,  R,  R,  R,  R,  R,  R,  R,  R,  R,  R,  R,  R,  R,  R,  R,
+        R,  R,  R,  R,  NSM,NSM,NSM,NSM,NSM,NSM,NSM,R,  ON, ON, ON, ON,
+        R,  R,  R,  R,  R,  R,  R,  R,  R,  R,  ON, ON, ON, ON, R,  R,
+        ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON,
+        ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON,
+        ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON,
+        ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON,
+        ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON,
+        ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON,
+        ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON,
+        ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON,
+        ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON,
+        ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON,
+    },
+    {
+        ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON,
+        ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON,
+        ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON,
+        ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON,
+        ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON,
+        ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON,
+        ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON,
+        ON, AL, AL, AL, AL, AL, AL, AL, AL, AL, AL, AL, AL, AL, AL, AL,
+        AL, AL, AL, AL, AL, AL, AL, AL, AL, AL, AL, AL, AL, AL, AL, AL,
+        AL, AL, AL, AL, AL, AL, AL, AL, AL, AL, AL, AL, AL, AL, AL, AL,
+        AL, AL, AL, AL, AL, AL, AL, AL, AL, AL, AL, AL, AL, AL, AL, AL,
+        AL, AL, AL, AL, AL, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON,
+        ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON,
+        ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON,
+        ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON,
+        ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON,
+    },
+    {
+        ON, AL, AL, AL, AL, AL, AL, AL, AL, AL, AL, AL, AL, AL, AL, AL,
+        AL, AL, AL, AL, AL, AL, AL, AL, AL, AL, AL, AL, AL, AL, AL, AL,
+        AL, AL, AL, AL, AL, AL, AL, AL, AL, AL, AL, AL, AL, AL, AL, AL,
+        AL, AL, AL, AL, AL, AL, AL, AL, AL, AL, AL, AL, AL, AL, ON, ON,
+        ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON,
+        ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON,
+        ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON,
+        ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON,
+        ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON,
+        ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON,
+        ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON,
+        ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON,
+        ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON,
+        ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON,
+        ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON,
+        ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON,
+    },
+    {
+        AL, AL, AL, AL, ON, AL, AL, AL, AL, AL, AL, AL, AL, AL, AL, AL,
+        AL, AL, AL, AL, AL, AL, AL, AL, AL, AL, AL, AL, AL, AL, AL, AL,
+        ON, AL, AL, ON, AL, ON, ON, AL, ON, AL, AL, AL, AL, AL, AL, AL,
+        AL, AL, AL, ON, AL, AL, AL, AL, ON, AL, ON, AL, ON, ON, ON, ON,
+        ON, ON, AL, ON, ON, ON, ON, AL, ON, AL, ON, AL, ON, AL, AL, AL,
+        ON, AL, AL, ON, AL, ON, ON, AL, ON, AL, ON, AL, ON, AL, ON, AL,
+        ON, AL, AL, ON, AL, ON, ON, AL, AL, AL, AL, ON, AL, AL, AL, AL,
+        AL, AL, AL, ON, AL, AL, AL, AL, ON, AL, AL, AL, AL, ON, AL, ON,
+        AL, AL, AL, AL, AL, AL, AL, AL, AL, AL, ON, AL, AL, AL, AL, AL,
+        AL, AL, AL, AL, AL, AL, AL, AL, AL, AL, AL, AL, ON, ON, ON, ON,
+        ON, AL, AL, AL, ON, AL, AL, AL, AL, AL, ON, AL, AL, AL, AL, AL,
+        AL, AL, AL, AL, AL, AL, AL, AL, AL, AL, AL, AL, ON, ON, ON, ON,
+        ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON,
+        ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON,
+        ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON,
+        ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON,
+    },
+    {
+        EN, EN, EN, EN, EN, EN, EN, EN, EN, EN, EN, ON, ON, ON, ON, ON,
+        L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,
+        L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  ON,
+        L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,
+        L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,
+        L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,
+        L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  ON, ON, ON, ON, ON, ON,
+        L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,
+        L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,
+        L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,
+        L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  ON, ON, ON,
+        ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON,
+        ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON,
+        ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON,
+        ON, ON, ON, ON, ON, ON, L,  L,  L,  L,  L,  L,  L,  L,  L,  L,
+        L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,
+    },
+    {
+        L,  L,  L,  ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON,
+        L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,
+        L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,
+        L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  ON, ON, ON, ON,
+        L,  L,  L,  L,  L,  L,  L,  L,  L,  ON, ON, ON, ON, ON, ON, ON,
+        L,  L,  ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON,
+        ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON,
+        ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON,
+        ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON,
+        ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON,
+        ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON,
+        ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON,
+        ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON,
+        ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON,
+        ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON,
+        ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON,
+    },
+    {
+        ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON,
+        ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON,
+        ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON,
+        ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON,
+        ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON,
+        ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON,
+        ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON,
+        ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON,
+        ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON,
+        ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON,
+        ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON,
+        ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON,
+        ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON,
+        ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON,
+        ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON,
+        EN, EN, EN, EN, EN, EN, EN, EN, EN, EN, ON, ON, ON, ON, ON, ON,
+    },
+    {
+        L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,
+        L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,
+        L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,
+        L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,
+        L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,
+        L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,
+        L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,
+        L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,
+        L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,
+        L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,
+        L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,
+        L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,
+        L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,
+        L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,
+        ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON,
+        ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON,
+    },
+    {
+        L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,
+        L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,
+        L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,
+        L,  L,  L,  L,  L,  L,  L,  L,  L,  ON, ON, ON, ON, ON, ON, ON,
+        L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,
+        L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,
+        L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,
+        L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,
+        L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,
+        L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,
+        L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,
+        L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,
+        L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,
+        L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,
+        L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,
+        L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,
+    },
+    {
+        L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,
+        L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  ON, ON,
+        L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,
+        L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,
+        L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,
+        L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,
+        L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,
+        L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,
+        L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,
+        L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,
+        L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,
+        L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,
+        L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,
+        L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,
+        L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,
+        L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,
+    },
+    {
+        L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,
+        L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,
+        L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,
+        L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,
+        L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,
+        L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,
+        L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,
+        L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,
+        L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,
+        L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,
+        L,  L,  ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON,
+        L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,
+        L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,
+        L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,
+        L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,
+        L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,
+    },
+    {
+        L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,
+        L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,
+        L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,
+        L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,
+        L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,
+        L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,
+        L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,
+        L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,
+        L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,
+        L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,
+        L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,
+        L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,
+        L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,
+        L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,
+        L,  ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON,
+        ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON,
+    },
+    {
+        L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,
+        L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  ON, ON,
+        ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON,
+        ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON,
+        ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON,
+        ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON,
+        ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON,
+        ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON,
+        ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON,
+        ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON,
+        ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON,
+        ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON,
+        ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON,
+        ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON,
+        ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON,
+        ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON,
+    },
+    {
+        L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,
+        L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,
+        L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,
+        L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,
+        L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  ON, ON, ON, ON, ON,
+        ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON,
+        ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON,
+        ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON,
+        ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON,
+        ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON,
+        ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON,
+        ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON,
+        ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON,
+        ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON,
+        ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON,
+        ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON,
+    },
+    {
+        ON, BN, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON,
+        ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON,
+        BN, BN, BN, BN, BN, BN, BN, BN, BN, BN, BN, BN, BN, BN, BN, BN,
+        BN, BN, BN, BN, BN, BN, BN, BN, BN, BN, BN, BN, BN, BN, BN, BN,
+        BN, BN, BN, BN, BN, BN, BN, BN, BN, BN, BN, BN, BN, BN, BN, BN,
+        BN, BN, BN, BN, BN, BN, BN, BN, BN, BN, BN, BN, BN, BN, BN, BN,
+        BN, BN, BN, BN, BN, BN, BN, BN, BN, BN, BN, BN, BN, BN, BN, BN,
+        BN, BN, BN, BN, BN, BN, BN, BN, BN, BN, BN, BN, BN, BN, BN, BN,
+        ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON,
+        ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON,
+        ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON,
+        ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON,
+        ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON,
+        ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON,
+        ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON,
+        ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON,
+    },
+    {
+        NSM,NSM,NSM,NSM,NSM,NSM,NSM,NSM,NSM,NSM,NSM,NSM,NSM,NSM,NSM,NSM,
+        NSM,NSM,NSM,NSM,NSM,NSM,NSM,NSM,NSM,NSM,NSM,NSM,NSM,NSM,NSM,NSM,
+        NSM,NSM,NSM,NSM,NSM,NSM,NSM,NSM,NSM,NSM,NSM,NSM,NSM,NSM,NSM,NSM,
+        NSM,NSM,NSM,NSM,NSM,NSM,NSM,NSM,NSM,NSM,NSM,NSM,NSM,NSM,NSM,NSM,
+        NSM,NSM,NSM,NSM,NSM,NSM,NSM,NSM,NSM,NSM,NSM,NSM,NSM,NSM,NSM,NSM,
+        NSM,NSM,NSM,NSM,NSM,NSM,NSM,NSM,NSM,NSM,NSM,NSM,NSM,NSM,NSM,NSM,
+        NSM,NSM,NSM,NSM,NSM,NSM,NSM,NSM,NSM,NSM,NSM,NSM,NSM,NSM,NSM,NSM,
+        NSM,NSM,NSM,NSM,NSM,NSM,NSM,NSM,NSM,NSM,NSM,NSM,NSM,NSM,NSM,NSM,
+        NSM,NSM,NSM,NSM,NSM,NSM,NSM,NSM,NSM,NSM,NSM,NSM,NSM,NSM,NSM,NSM,
+        NSM,NSM,NSM,NSM,NSM,NSM,NSM,NSM,NSM,NSM,NSM,NSM,NSM,NSM,NSM,NSM,
+        NSM,NSM,NSM,NSM,NSM,NSM,NSM,NSM,NSM,NSM,NSM,NSM,NSM,NSM,NSM,NSM,
+        NSM,NSM,NSM,NSM,NSM,NSM,NSM,NSM,NSM,NSM,NSM,NSM,NSM,NSM,NSM,NSM,
+        NSM,NSM,NSM,NSM,NSM,NSM,NSM,NSM,NSM,NSM,NSM,NSM,NSM,NSM,NSM,NSM,
+        NSM,NSM,NSM,NSM,NSM,NSM,NSM,NSM,NSM,NSM,NSM,NSM,NSM,NSM,NSM,NSM,
+        NSM,NSM,NSM,NSM,NSM,NSM,NSM,NSM,NSM,NSM,NSM,NSM,NSM,NSM,NSM,NSM,
+        ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON, ON,
+    },
+    {
+        L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,
+        L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,
+        L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,
+        L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,
+        L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,
+        L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,
+        L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,
+        L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,
+        L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,
+        L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,
+        L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,
+        L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,
+        L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,
+        L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,
+        L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,
+        L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  L,  ON, ON,
+    },
+};
+
+unsigned char bidi_getType(int ch)
+{
+    unsigned uc = ch;
+
+    if (uc >= 0x110000)
+        return ON;
+    return bidi_type_blocks[bidi_type_pages[uc >> 8]][uc & 0xFF];
+}
+
 /*
  * Return the mirrored version of a glyph.
 
@@ -3607,3 +6411,85 @@ void do_bidi(BidiContext *ctx, bidi_char *text, size_t textlen)
     do_bidi_new(ctx, text, textlen);
 #endif
 }
+
+#ifdef TEST
+
+#include <stdio.h>
+#include <time.h>
+
+/*
+ * Test program: check the two-stage table against a binary search of
+ * the interval table for every code point, and then time both over
+ * a few representative ranges of characters, as a microbenchmark of
+ * the per-character cost.
+ */
+
+void out_of_memory(void)
+{
+    fprintf(stderr, "out of memory!\n");
+    exit(2);
+}
+
+static const struct {
+    const char *name;
+    unsigned first, last;
+} ranges[] = {
+    { "ASCII", 0x20, 0x7E },
+    { "Hebrew/Arabic", 0x590, 0x6FF },
+    { "CJK ideographs", 0x4E00, 0x9FFF },
+    { "all code points", 0, 0x10FFFF },
+};
+
+#define BENCH_CHARS (1 << 24)
+
+static double ns_per_char(unsigned char (*fn)(int), const int *chars)
+{
+    volatile unsigned sink;
+    unsigned sum = 0;
+    clock_t start = clock();
+
+    for (size_t i = 0; i < BENCH_CHARS; i++)
+        sum += fn(chars[i]);
+    sink = sum;
+    (void)sink;
+
+    return (double)(clock() - start) / CLOCKS_PER_SEC * 1e9 / BENCH_CHARS;
+}
+
+int main(void)
+{
+    int *chars;
+    int passes = 0, fails = 0;
+
+    for (int ch = 0; ch < 0x110100; ch++) {
+        unsigned t = bidi_getType(ch), b = bisearch_bidi_getType(ch);
+        if (t != b) {
+            if (fails < 20)
+                printf("failed test: bidi_getType(U+%04X) returned %u, "
+                       "not %u\n", (unsigned)ch, t, b);
+            fails++;
+        } else
+            passes++;
+    }
+    printf("passed %d, failed %d\n", passes, fails);
+
+    printf("table size: %u bytes (%u pages, %u distinct blocks)\n",
+           (unsigned)(sizeof(bidi_type_pages) + sizeof(bidi_type_blocks)),
+           (unsigned)lenof(bidi_type_pages),
+           (unsigned)lenof(bidi_type_blocks));
+
+    chars = snewn(BENCH_CHARS, int);
+    for (size_t r = 0; r < lenof(ranges); r++) {
+        unsigned span = ranges[r].last - ranges[r].first + 1;
+        for (size_t i = 0; i < BENCH_CHARS; i++)
+            chars[i] = ranges[r].first + (unsigned)(i * 40503U) % span;
+        printf("%-16s  table %6.2f ns/char, bisearch %6.2f ns/char\n",
+               ranges[r].name, ns_per_char(bidi_getType, chars),
+               ns_per_char(bisearch_bidi_getType, chars));
+    }
+    sfree(chars);
+
+    return fails != 0;
+}
+
+#endif /* TEST */
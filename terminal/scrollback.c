@@ -0,0 +1,734 @@
+/*
+ * Storage for the terminal's scrollback.
+ *
+ * Each line arrives already compressed by compressline() in
+ * terminal.c, and this module treats it as an opaque byte string.
+ * Rather than giving every line an allocation and a tree node of its
+ * own, lines are packed into blocks of SB_BLOCK_LINES. Once a block
+ * is full it is sealed: its contents are compressed again as a unit
+ * with the Deflate compressor from ssh/zlib.c, so that neighbouring
+ * lines with a lot of text in common share the cost of it.
+ *
+ * Looking up a line in a sealed block decompresses the whole block,
+ * so the most recently used few are kept decompressed in a small
+ * cache, which makes scrolling back through the history cheap.
+ *
+ * The uncompressed form of a block is a table of SB_BLOCK_LINES
+ * 32-bit big-endian end offsets (one per line, measured from the end
+ * of the table), followed by the data of all the lines.
+ *
+ * Optionally, sealed blocks beyond a given number of the newest lines
+ * can be moved out of memory altogether, into a temporary spill file
+ * (see spillfile_new). Only the block index stays in memory, holding
+ * each block's offset in the file, and reading a line back maps the
+ * relevant part of the file in. Since blocks are spilled oldest first,
+ * the spilled ones are always at the start of the block array.
+ *
+ * To make searching fast, each block also has a filter recording
+ * which trigrams (runs of three characters) occur in its lines: the
+ * terminal passes the text of every line it appends to
+ * scrollback_index_text, and each trigram sets one bit of the filter,
+ * chosen by hashing it. A search can then skip every block in which
+ * some trigram of the search string has its bit clear, without having
+ * to decompress it. The filter stays in memory even for spilled
+ * blocks, and is never cleared as lines leave a block, so it can give
+ * false positives but not false negatives.
+ *
+ * How big the filter needs to be depends on how much text the block
+ * holds: 256 full-width lines have tens of thousands of trigrams, and
+ * would set most of the bits in any fixed size small enough to spend
+ * on a block of short lines. So the open block just collects the
+ * hashes of its trigrams, and the filter is built when it's sealed,
+ * with about SB_FILTER_BITS bits for each distinct trigram.
+ */
+
+#include <assert.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "putty.h"
+#include "ssh.h"                       /* for the zlib compressor */
+#include "terminal.h"
+
+#define SB_BLOCK_LINES 256
+#define SB_CACHE_SIZE 4
+#define SB_FILTER_BITS 4
+#define SB_FILTER_MIN_SHIFT 9
+#define SB_FILTER_MAX_SHIFT 22
+
+typedef struct sbblock {
+    uint64_t id;                       /* identifies it in the cache */
+    int nlines;                        /* including any deleted at the start */
+
+    /* The newest block is open, with its data uncompressed */
+    strbuf *data;
+    uint32_t *ends;                    /* end offset of each line */
+
+    /* Every other block is sealed */
+    unsigned char *zdata;              /* NULL if spilled */
+    int zlen;
+    uint64_t spilloff;                 /* offset in the spill file */
+
+    unsigned char *filter;             /* trigram filter, or NULL if empty */
+    int filter_shift;                  /* filter has 1 << this many bits */
+    uint32_t *hashes;                  /* trigrams not yet in the filter */
+    size_t nhashes, hashsize;
+} sbblock;
+
+typedef struct sbcache {
+    uint64_t id;
+    unsigned char *data;               /* uncompressed block, or NULL */
+    int len;
+} sbcache;
+
+struct scrollback {
+    sbblock **blocks;
+    size_t nblocks, blocksize;
+    int skip;                  /* lines deleted from the start of blocks[0] */
+    size_t nlines;
+    uint64_t next_id;
+    sbcache cache[SB_CACHE_SIZE];      /* most recently used first */
+
+    SpillFile *spill;
+    size_t memlimit;           /* lines to keep in memory, or 0 for all */
+    size_t nspilled;           /* blocks at the start that are spilled */
+};
+
+scrollback *scrollback_new(void)
+{
+    scrollback *sb = snew(scrollback);
+    memset(sb, 0, sizeof(*sb));
+    return sb;
+}
+
+static void sbcache_discard(scrollback *sb, uint64_t id)
+{
+    for (size_t i = 0; i < SB_CACHE_SIZE; i++) {
+        if (sb->cache[i].data && sb->cache[i].id == id) {
+            sfree(sb->cache[i].data);
+            memmove(sb->cache + i, sb->cache + i + 1,
+                    (SB_CACHE_SIZE - i - 1) * sizeof(sbcache));
+            sb->cache[SB_CACHE_SIZE - 1].data = NULL;
+            return;
+        }
+    }
+}
+
+static void sbblock_free(scrollback *sb, sbblock *blk)
+{
+    sbcache_discard(sb, blk->id);
+    if (blk->data)
+        strbuf_free(blk->data);
+    sfree(blk->ends);
+    sfree(blk->zdata);
+    sfree(blk->filter);
+    sfree(blk->hashes);
+    sfree(blk);
+}
+
+static void sb_free_blocks(scrollback *sb)
+{
+    for (size_t i = 0; i < sb->nblocks; i++)
+        sbblock_free(sb, sb->blocks[i]);
+    sb->nblocks = 0;
+    sb->skip = 0;
+    sb->nlines = 0;
+    sb->nspilled = 0;
+}
+
+bool scrollback_clear(scrollback *sb)
+{
+    sb_free_blocks(sb);
+
+    /*
+     * Don't leave the cleared lines lying around on disk: start again
+     * with a fresh spill file.
+     */
+    if (sb->spill) {
+        spillfile_free(sb->spill);
+        sb->spill = spillfile_new();
+        if (!sb->spill) {
+            sb->memlimit = 0;
+            return false;
+        }
+    }
+    return true;
+}
+
+void scrollback_free(scrollback *sb)
+{
+    if (sb) {
+        sb_free_blocks(sb);
+        if (sb->spill)
+            spillfile_free(sb->spill);
+        sfree(sb->blocks);
+        sfree(sb);
+    }
+}
+
+size_t scrollback_count(scrollback *sb)
+{
+    return sb->nlines;
+}
+
+/*
+ * Count the memory the scrollback is using, not counting anything
+ * spilled to disk. This is only an estimate (it ignores malloc
+ * overhead and spare space in the open block's strbuf), for termbench
+ * to report.
+ */
+size_t scrollback_memory(scrollback *sb)
+{
+    size_t total = sizeof(scrollback) + sb->blocksize * sizeof(sbblock *);
+
+    for (size_t i = 0; i < sb->nblocks; i++) {
+        sbblock *blk = sb->blocks[i];
+        total += sizeof(sbblock);
+        if (blk->data)
+            total += blk->data->len + SB_BLOCK_LINES * sizeof(uint32_t);
+        if (blk->zdata)
+            total += blk->zlen;
+        if (blk->filter)
+            total += ((size_t)1 << blk->filter_shift) / 8;
+        total += blk->hashsize * sizeof(uint32_t);
+    }
+    for (size_t i = 0; i < SB_CACHE_SIZE; i++)
+        if (sb->cache[i].data)
+            total += sb->cache[i].len;
+
+    return total;
+}
+
+static int uint32_cmp(const void *av, const void *bv)
+{
+    uint32_t a = *(const uint32_t *)av, b = *(const uint32_t *)bv;
+    return a < b ? -1 : a > b ? +1 : 0;
+}
+
+/*
+ * Build a block's trigram filter from the hashes collected while it
+ * was open. If it was sealed before, and reopened to delete lines
+ * from its end, then the old filter must still cover the lines that
+ * are left: keep at least its size, and set every bit of the new
+ * filter that an old bit could stand for.
+ */
+static void sbblock_build_filter(sbblock *blk)
+{
+    size_t ndistinct = 0;
+    qsort(blk->hashes, blk->nhashes, sizeof(uint32_t), uint32_cmp);
+    for (size_t i = 0; i < blk->nhashes; i++)
+        if (i == 0 || blk->hashes[i] != blk->hashes[i-1])
+            ndistinct++;
+
+    if (ndistinct || blk->filter) {
+        int shift = SB_FILTER_MIN_SHIFT;
+        while (shift < SB_FILTER_MAX_SHIFT &&
+               ((size_t)1 << shift) < ndistinct * SB_FILTER_BITS)
+            shift++;
+        if (blk->filter && shift < blk->filter_shift)
+            shift = blk->filter_shift;
+
+        size_t nbytes = ((size_t)1 << shift) / 8;
+        unsigned char *filter = snewn(nbytes, unsigned char);
+        memset(filter, 0, nbytes);
+
+        for (size_t i = 0; i < blk->nhashes; i++) {
+            uint32_t h = blk->hashes[i] >> (32 - shift);
+            filter[h >> 3] |= 1 << (h & 7);
+        }
+
+        if (blk->filter) {
+            int scale = shift - blk->filter_shift;
+            for (size_t j = 0; j < ((size_t)1 << blk->filter_shift); j++) {
+                if (!(blk->filter[j >> 3] & (1 << (j & 7))))
+                    continue;
+                for (size_t h = j << scale; h < (j+1) << scale; h++)
+                    filter[h >> 3] |= 1 << (h & 7);
+            }
+            sfree(blk->filter);
+        }
+
+        blk->filter = filter;
+        blk->filter_shift = shift;
+    }
+
+    sfree(blk->hashes);
+    blk->hashes = NULL;
+    blk->nhashes = blk->hashsize = 0;
+}
+
+static void sbblock_seal(sbblock *blk)
+{
+    strbuf *payload = strbuf_new_nm();
+    assert(blk->nlines == SB_BLOCK_LINES);
+    for (int i = 0; i < SB_BLOCK_LINES; i++)
+        put_uint32(payload, blk->ends[i]);
+    put_datapl(payload, ptrlen_from_strbuf(blk->data));
+
+    ssh_compressor *comp = ssh_compressor_new(&ssh_zlib);
+    ssh_compressor_compress(comp, payload->u, payload->len,
+                            &blk->zdata, &blk->zlen, 0);
+    ssh_compressor_free(comp);
+
+    strbuf_free(payload);
+    strbuf_free(blk->data);
+    blk->data = NULL;
+    sfree(blk->ends);
+    blk->ends = NULL;
+
+    sbblock_build_filter(blk);
+}
+
+/*
+ * Return the uncompressed form of a sealed block, from the cache if
+ * possible.
+ */
+static ptrlen sbblock_contents(scrollback *sb, sbblock *blk)
+{
+    size_t i;
+    sbcache entry;
+
+    for (i = 0; i < SB_CACHE_SIZE; i++)
+        if (sb->cache[i].data && sb->cache[i].id == blk->id)
+            break;
+
+    if (i < SB_CACHE_SIZE) {
+        entry = sb->cache[i];
+    } else {
+        ptrlen zdata = make_ptrlen(blk->zdata, blk->zlen);
+        if (!blk->zdata)
+            zdata = spillfile_read(sb->spill, blk->spilloff, blk->zlen);
+
+        /*
+         * If the spill file has let us down, there's nothing to do
+         * but return nothing, and let our caller make do.
+         */
+        if (zdata.len != blk->zlen)
+            return make_ptrlen(NULL, 0);
+
+        ssh_decompressor *dc = ssh_decompressor_new(&ssh_zlib);
+        bool ok = ssh_decompressor_decompress(
+            dc, zdata.ptr, zdata.len, &entry.data, &entry.len);
+        ssh_decompressor_free(dc);
+        if (!ok || entry.len < 4*SB_BLOCK_LINES) {
+            if (ok)
+                sfree(entry.data);
+            return make_ptrlen(NULL, 0);
+        }
+        entry.id = blk->id;
+
+        i = SB_CACHE_SIZE - 1;
+        sfree(sb->cache[i].data);
+    }
+
+    /* Move this entry to the front */
+    memmove(sb->cache + 1, sb->cache, i * sizeof(sbcache));
+    sb->cache[0] = entry;
+
+    return make_ptrlen(entry.data, entry.len);
+}
+
+/*
+ * Turn a sealed block back into an open one, so that lines can be
+ * deleted from the end of it.
+ */
+static void sbblock_unseal(scrollback *sb, sbblock *blk)
+{
+    ptrlen contents = sbblock_contents(sb, blk);
+    const unsigned char *p = contents.ptr;
+
+    blk->ends = snewn(SB_BLOCK_LINES, uint32_t);
+    blk->data = strbuf_new_nm();
+    if (contents.len) {
+        for (int i = 0; i < blk->nlines; i++)
+            blk->ends[i] = GET_32BIT_MSB_FIRST(p + 4*i);
+        put_data(blk->data, p + 4*SB_BLOCK_LINES,
+                 contents.len - 4*SB_BLOCK_LINES);
+    } else {
+        /* The lines are lost; carry on as if they were all empty */
+        for (int i = 0; i < blk->nlines; i++)
+            blk->ends[i] = 0;
+    }
+
+    sbcache_discard(sb, blk->id);
+    sfree(blk->zdata);
+    blk->zdata = NULL;
+}
+
+/*
+ * Move sealed blocks out to the spill file, oldest first, for as
+ * long as that leaves at least memlimit lines in memory.
+ */
+static void sb_spill_excess(scrollback *sb)
+{
+    if (!sb->memlimit)
+        return;
+
+    while (sb->nspilled < sb->nblocks) {
+        sbblock *blk = sb->blocks[sb->nspilled];
+        if (blk->data)
+            break;                     /* the open block stays put */
+
+        size_t spilled = (sb->nspilled ?
+                          sb->nspilled * SB_BLOCK_LINES - sb->skip : 0);
+        size_t blklines = blk->nlines - (sb->nspilled ? 0 : sb->skip);
+        if (sb->nlines - spilled < sb->memlimit + blklines)
+            break;
+
+        uint64_t offset = spillfile_append(
+            sb->spill, make_ptrlen(blk->zdata, blk->zlen));
+        if (offset == SPILLFILE_FAILED)
+            break;                     /* just keep it in memory */
+
+        blk->spilloff = offset;
+        sfree(blk->zdata);
+        blk->zdata = NULL;
+        sb->nspilled++;
+    }
+}
+
+bool scrollback_set_spill(scrollback *sb, size_t memlines)
+{
+    if (memlines && !sb->spill)
+        sb->spill = spillfile_new();
+    sb->memlimit = sb->spill ? memlines : 0;
+    sb_spill_excess(sb);
+    return sb->memlimit > 0;
+}
+
+void scrollback_append(scrollback *sb, ptrlen line)
+{
+    sbblock *blk = sb->nblocks ? sb->blocks[sb->nblocks - 1] : NULL;
+
+    if (!blk || blk->nlines == SB_BLOCK_LINES) {
+        if (blk && blk->data) {
+            sbblock_seal(blk);
+            sb_spill_excess(sb);
+        }
+
+        blk = snew(sbblock);
+        blk->id = sb->next_id++;
+        blk->nlines = 0;
+        blk->data = strbuf_new_nm();
+        blk->ends = snewn(SB_BLOCK_LINES, uint32_t);
+        blk->zdata = NULL;
+        blk->zlen = 0;
+        blk->spilloff = 0;
+        blk->filter = NULL;
+        blk->filter_shift = 0;
+        blk->hashes = NULL;
+        blk->nhashes = blk->hashsize = 0;
+
+        sgrowarray(sb->blocks, sb->blocksize, sb->nblocks);
+        sb->blocks[sb->nblocks++] = blk;
+    }
+
+    put_datapl(blk->data, line);
+    blk->ends[blk->nlines++] = blk->data->len;
+    sb->nlines++;
+}
+
+ptrlen scrollback_get(scrollback *sb, size_t index)
+{
+    assert(index < sb->nlines);
+    index += sb->skip;
+    sbblock *blk = sb->blocks[index / SB_BLOCK_LINES];
+    size_t i = index % SB_BLOCK_LINES;
+
+    const unsigned char *data;
+    size_t start, end;
+    if (blk->data) {
+        data = blk->data->u;
+        start = i ? blk->ends[i-1] : 0;
+        end = blk->ends[i];
+    } else {
+        data = sbblock_contents(sb, blk).ptr;
+        if (!data)
+            return make_ptrlen(NULL, 0);
+        start = i ? GET_32BIT_MSB_FIRST(data + 4*(i-1)) : 0;
+        end = GET_32BIT_MSB_FIRST(data + 4*i);
+        data += 4*SB_BLOCK_LINES;
+    }
+
+    return make_ptrlen(data + start, end - start);
+}
+
+void scrollback_delete_oldest(scrollback *sb)
+{
+    assert(sb->nlines > 0);
+    sb->nlines--;
+    if (++sb->skip == sb->blocks[0]->nlines) {
+        sbblock_free(sb, sb->blocks[0]);
+        memmove(sb->blocks, sb->blocks + 1,
+                (sb->nblocks - 1) * sizeof(*sb->blocks));
+        sb->nblocks--;
+        sb->skip = 0;
+        if (sb->nspilled)
+            sb->nspilled--;
+    }
+}
+
+void scrollback_delete_newest(scrollback *sb)
+{
+    assert(sb->nlines > 0);
+    sbblock *blk = sb->blocks[sb->nblocks - 1];
+    if (!blk->data) {
+        sbblock_unseal(sb, blk);
+        if (sb->nspilled == sb->nblocks)
+            sb->nspilled--;
+    }
+
+    sb->nlines--;
+    blk->nlines--;
+    strbuf_shrink_to(blk->data, blk->nlines ? blk->ends[blk->nlines-1] : 0);
+    if (blk->nlines == (sb->nblocks == 1 ? sb->skip : 0)) {
+        sbblock_free(sb, blk);
+        sb->nblocks--;
+        if (!sb->nblocks)
+            sb->skip = 0;
+    }
+}
+
+/* Full 32-bit hash of a trigram; a filter uses its top bits */
+static uint32_t sb_trigram_hash(const wchar_t *text)
+{
+    uint32_t h = (uint32_t)text[0] * 0x9E3779B1U;
+    h = (h ^ (uint32_t)text[1]) * 0x85EBCA77U;
+    h = (h ^ (uint32_t)text[2]) * 0xC2B2AE3DU;
+    return h;
+}
+
+void scrollback_index_text(scrollback *sb, const wchar_t *text, size_t len)
+{
+    assert(sb->nlines > 0);
+    if (len < 3)
+        return;
+
+    sbblock *blk = sb->blocks[sb->nblocks - 1];
+    assert(blk->data);                 /* the newest block is open */
+
+    for (size_t i = 0; i + 3 <= len; i++) {
+        sgrowarray(blk->hashes, blk->hashsize, blk->nhashes);
+        blk->hashes[blk->nhashes++] = sb_trigram_hash(text + i);
+    }
+}
+
+static bool sbblock_may_contain(sbblock *blk, const uint32_t *hashes,
+                                size_t nhashes)
+{
+    if (blk->data) {
+        /* An open block has no filter to speak of yet; it's at most
+         * one block for the caller to check by hand. */
+        return blk->filter || blk->nhashes;
+    }
+
+    if (!blk->filter)
+        return false;
+    for (size_t i = 0; i < nhashes; i++) {
+        uint32_t h = hashes[i] >> (32 - blk->filter_shift);
+        if (!(blk->filter[h >> 3] & (1 << (h & 7))))
+            return false;
+    }
+    return true;
+}
+
+size_t scrollback_search(scrollback *sb, const wchar_t *text, size_t len,
+                         size_t index, bool backwards)
+{
+    assert(index < sb->nlines);
+    if (len < 3)
+        return index;                  /* no trigrams to go on */
+
+    size_t nhashes = len - 2;
+    uint32_t *hashes = snewn(nhashes, uint32_t);
+    for (size_t i = 0; i < nhashes; i++)
+        hashes[i] = sb_trigram_hash(text + i);
+
+    size_t b = (index + sb->skip) / SB_BLOCK_LINES;
+    while (!sbblock_may_contain(sb->blocks[b], hashes, nhashes)) {
+        if (backwards) {
+            if (b == 0) {
+                index = SIZE_MAX;
+                break;
+            }
+            index = b * SB_BLOCK_LINES - sb->skip - 1;
+            b--;
+        } else {
+            if (++b == sb->nblocks) {
+                index = SIZE_MAX;
+                break;
+            }
+            index = b * SB_BLOCK_LINES - sb->skip;
+        }
+    }
+
+    sfree(hashes);
+    return index;
+}
+
+#ifdef TEST
+
+#include <stdio.h>
+
+void out_of_memory(void) { fprintf(stderr, "out of memory\n"); abort(); }
+
+static int fails, passes;
+
+#define TEST_BLOCKS 40
+#define TEST_LINES (TEST_BLOCKS * SB_BLOCK_LINES)
+#define TEST_COLS 80
+#define TEST_NEEDLE 8
+
+/* Full-width lines of text from a few hundred characters, so that
+ * every block has about as many distinct trigrams as it can get */
+static wchar_t text[TEST_LINES + SB_BLOCK_LINES][TEST_COLS];
+static size_t ntext;
+
+static uint32_t rng = 12345;
+static unsigned rnd(unsigned n)
+{
+    /* xorshift32: an LCG's low bits repeat far too soon for this */
+    rng ^= rng << 13;
+    rng ^= rng >> 17;
+    rng ^= rng << 5;
+    return rng % n;
+}
+
+static void add_line(scrollback *sb)
+{
+    wchar_t *t = text[ntext++];
+    for (size_t i = 0; i < TEST_COLS; i++)
+        t[i] = 0x100 + rnd(512);
+    scrollback_append(sb, make_ptrlen(t, sizeof(text[0])));
+    scrollback_index_text(sb, t, TEST_COLS);
+}
+
+static bool line_contains(size_t line, const wchar_t *needle)
+{
+    for (size_t i = 0; i + TEST_NEEDLE <= TEST_COLS; i++)
+        if (!memcmp(text[line] + i, needle, TEST_NEEDLE * sizeof(wchar_t)))
+            return true;
+    return false;
+}
+
+static void check(bool ok, const char *what)
+{
+    if (ok) {
+        passes++;
+    } else {
+        printf("FAIL: %s\n", what);
+        fails++;
+    }
+}
+
+/*
+ * Check every block's filter against needles taken from random
+ * lines: a block containing the needle must never be skipped, and
+ * (since the filter is sized for the block) hardly any of the others
+ * should get through.
+ */
+static void test_filters(scrollback *sb, const char *what)
+{
+    size_t falsepos = 0, checked = 0;
+    bool falseneg = false;
+
+    for (int q = 0; q < 200; q++) {
+        size_t line = rnd(ntext);
+        const wchar_t *needle = text[line] + rnd(TEST_COLS - TEST_NEEDLE);
+        uint32_t hashes[TEST_NEEDLE - 2];
+        for (size_t i = 0; i < TEST_NEEDLE - 2; i++)
+            hashes[i] = sb_trigram_hash(needle + i);
+
+        for (size_t b = 0; b < sb->nblocks; b++) {
+            sbblock *blk = sb->blocks[b];
+            bool present = false;
+            for (int i = (b ? 0 : sb->skip); i < blk->nlines; i++)
+                if (line_contains(b * SB_BLOCK_LINES + i, needle))
+                    present = true;
+            bool maybe = sbblock_may_contain(blk, hashes, TEST_NEEDLE - 2);
+            if (present && !maybe)
+                falseneg = true;
+            if (!present && blk->filter && !blk->data) {
+                checked++;
+                if (maybe)
+                    falsepos++;
+            }
+        }
+    }
+
+    char *msg = dupprintf("%s: no false negatives", what);
+    check(!falseneg, msg);
+    sfree(msg);
+    msg = dupprintf("%s: %"SIZEu" of %"SIZEu" blocks not skipped",
+                    what, falsepos, checked);
+    check(falsepos * 100 <= checked, msg);
+    sfree(msg);
+}
+
+int main(void)
+{
+    scrollback *sb = scrollback_new();
+    wchar_t absent[TEST_NEEDLE];
+    for (size_t i = 0; i < TEST_NEEDLE; i++)
+        absent[i] = 'a' + i;           /* nowhere in the generated text */
+
+    for (size_t i = 0; i < TEST_LINES; i++)
+        add_line(sb);
+    test_filters(sb, "full blocks");
+
+    /* A short line opens a new block with no trigrams in it */
+    scrollback_append(sb, PTRLEN_LITERAL("ab"));
+    scrollback_index_text(sb, L"ab", 2);
+    text[ntext][0] = 0;
+    ntext++;
+
+    check(scrollback_search(sb, absent, TEST_NEEDLE, 0, false) == SIZE_MAX,
+          "absent text, forwards");
+    check(scrollback_search(sb, absent, TEST_NEEDLE, sb->nlines - 1,
+                            true) == SIZE_MAX,
+          "absent text, backwards");
+    check(scrollback_search(sb, absent, 2, 17, false) == 17,
+          "too short to search");
+
+    /*
+     * Searching for a needle that only one line has should go
+     * straight to the start (or end) of its block, allowing for the
+     * lines deleted from the start of the first block.
+     */
+    for (int i = 0; i < 10; i++)
+        scrollback_delete_oldest(sb);
+    {
+        size_t target = 5 * SB_BLOCK_LINES + 100;
+        const wchar_t *needle = text[target] + 20;
+        check(scrollback_search(sb, needle, TEST_NEEDLE, 0, false) ==
+              5 * SB_BLOCK_LINES - 10, "forwards to block");
+        check(scrollback_search(sb, needle, TEST_NEEDLE,
+                                sb->nlines - 2, true) ==
+              6 * SB_BLOCK_LINES - 10 - 1, "backwards to block");
+        check(scrollback_search(sb, needle, TEST_NEEDLE,
+                                6 * SB_BLOCK_LINES, false) == SIZE_MAX,
+              "forwards past block");
+    }
+
+    /*
+     * Reopen the last full block by deleting lines from the end of
+     * it, and fill it up again with different text: its rebuilt
+     * filter must still cover the lines that stayed.
+     */
+    scrollback_delete_newest(sb);
+    ntext--;
+    for (int i = 0; i < 100; i++) {
+        scrollback_delete_newest(sb);
+        ntext--;
+    }
+    for (int i = 0; i < 101; i++)
+        add_line(sb);
+    test_filters(sb, "reopened block");
+
+    scrollback_free(sb);
+
+    printf("passed %d, failed %d\n", passes, fails);
+    return fails != 0;
+}
+
+#endif /* TEST */
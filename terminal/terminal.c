@@ -38,6 +38,10 @@
 #define TM_PUTTY        (0xFFFF)
 
 #define UPDATE_DELAY    ((TICKSPERSEC+49)/50)/* ticks to defer window update */
+#define FLOOD_DELAY     ((TICKSPERSEC+9)/10)/* ...while flooded: at least */
+#define FLOOD_MAX_DELAY ((TICKSPERSEC+3)/4)/* ...and at most */
+#define FLOOD_UPDATES   3               /* flooded updates before we slow */
+#define FLOOD_PAINT_SHARE 8             /* while flooded, paint 1/8 the time */
 #define TBLINK_DELAY    ((TICKSPERSEC*9+19)/20)/* ticks between text blinks*/
 #define CBLINK_DELAY    (CURSORBLINK) /* ticks between cursor blinks */
 #define VBELL_DELAY     (VBELL_TIMEOUT) /* visual bell timeout in ticks */
@@ -92,8 +96,9 @@ static termline *lineptr(Terminal *, int, int, int);
 static void unlineptr(termline *);
 static void check_line_size(Terminal *, termline *);
 static void do_paint(Terminal *);
+static void term_bidi_cache_flush(Terminal *);
 static void erase_lots(Terminal *, bool, bool, bool);
-static int find_last_nonempty_line(Terminal *, tree234 *);
+static int find_last_nonempty_line(Terminal *, termscreen *);
 static void swap_screen(Terminal *, int, bool, bool);
 static void update_sbar(Terminal *);
 static void deselect(Terminal *);
@@ -103,6 +108,30 @@ static void parse_optionalrgb(optionalrgb *out, unsigned *values);
 static void term_added_data(Terminal *term, bool);
 static void term_update_raw_mouse_mode(Terminal *term);
 static void term_out_cb(void *);
+static void sb_flush_staged(Terminal *);
+
+/*
+ * Record that some cells of a line have changed and will need
+ * repainting. An end of INT_MAX means 'to the end of the line'.
+ */
+static inline void termline_damage(termline *line, int start, int end)
+{
+    if (line->damage_start > start)
+        line->damage_start = start;
+    if (line->damage_end < end)
+        line->damage_end = end;
+}
+
+/*
+ * What do_paint wants a cell of the display to look like, before
+ * comparing it with disptext. One of these is kept for every cell of
+ * the display, so that cells of a line that haven't changed don't
+ * have to be worked out again.
+ */
+struct paintchar {
+    unsigned long chr, attr;
+    truecolour truecolour;
+};
 
 static termline *newtermline(Terminal *term, int cols, bool bce)
 {
@@ -118,6 +147,8 @@ static termline *newtermline(Terminal *term, int cols, bool bce)
     line->trusted = false;
     line->temporary = false;
     line->cc_free = 0;
+    line->damage_start = 0;
+    line->damage_end = INT_MAX;
 
     return line;
 }
@@ -130,6 +161,88 @@ static void freetermline(termline *line)
     }
 }
 
+static termscreen *termscreen_new(void)
+{
+    termscreen *s = snew(termscreen);
+    s->lines = NULL;
+    s->size = s->nlines = s->top = 0;
+    return s;
+}
+
+static void termscreen_free(termscreen *s)
+{
+    if (s) {
+        for (int y = 0; y < s->nlines; y++)
+            freetermline(termscreen_line(s, y));
+        sfree(s->lines);
+        sfree(s);
+    }
+}
+
+static inline termline **termscreen_slot(termscreen *s, int y)
+{
+    int i = s->top + y;
+    if (i >= s->size)
+        i -= s->size;
+    return &s->lines[i];
+}
+
+/*
+ * Remove line y from a screen and return it. The lines on whichever
+ * side of it is shorter are moved up to fill the gap, so taking a
+ * line off either end takes constant time.
+ */
+static termline *termscreen_delpos(termscreen *s, int y)
+{
+    assert(y >= 0 && y < s->nlines);
+    termline *line = *termscreen_slot(s, y);
+
+    if (y < s->nlines / 2) {
+        for (int i = y; i > 0; i--)
+            *termscreen_slot(s, i) = *termscreen_slot(s, i-1);
+        if (++s->top == s->size)
+            s->top = 0;
+    } else {
+        for (int i = y; i < s->nlines - 1; i++)
+            *termscreen_slot(s, i) = *termscreen_slot(s, i+1);
+    }
+    s->nlines--;
+    return line;
+}
+
+/*
+ * Insert a line into a screen, so that it becomes line y.
+ */
+static void termscreen_addpos(termscreen *s, termline *line, int y)
+{
+    assert(y >= 0 && y <= s->nlines);
+
+    if (s->nlines == s->size) {
+        /* Reallocate the array, unwrapping it in the process */
+        termline **newlines = NULL;
+        size_t newsize = 0;
+        sgrowarray(newlines, newsize, s->nlines);
+        for (int i = 0; i < s->nlines; i++)
+            newlines[i] = *termscreen_slot(s, i);
+        sfree(s->lines);
+        s->lines = newlines;
+        s->size = newsize;
+        s->top = 0;
+    }
+
+    s->nlines++;
+    if (y < s->nlines / 2) {
+        if (s->top-- == 0)
+            s->top = s->size - 1;
+        for (int i = 0; i < y; i++)
+            *termscreen_slot(s, i) = *termscreen_slot(s, i+1);
+    } else {
+        for (int i = s->nlines - 1; i > y; i--)
+            *termscreen_slot(s, i) = *termscreen_slot(s, i-1);
+    }
+    *termscreen_slot(s, y) = line;
+}
+
 static void unlineptr(termline *line)
 {
     if (line->temporary)
@@ -293,6 +406,7 @@ static void add_cc(termline *line, int col, unsigned long chr)
     line->chars[newcc].cc_next = 0;
     line->chars[newcc].chr = chr;
     line->chars[col].cc_next = newcc - col;
+    termline_damage(line, origcol, origcol + 1);
 
 #ifdef TERM_CC_DIAGS
     cc_check(line);
@@ -308,6 +422,12 @@ static void clear_cc(termline *line, int col)
 
     assert(col >= 0 && col < line->cols);
 
+    /*
+     * Everything that changes a cell clears its cc list first, which
+     * makes this the most convenient place to note the change.
+     */
+    termline_damage(line, col, col + 1);
+
     if (!line->chars[col].cc_next)
         return;                        /* nothing needs doing */
 
@@ -328,20 +448,210 @@ static void clear_cc(termline *line, int col)
 }
 
 /*
- * Compare two character cells for equality. Special case required
- * in do_paint() where we override what we expect the chr and attr
- * fields to be.
+ * The table of attribute and colour combinations that termchar.attr
+ * indexes into. Entry 0 is always the one for basic_erase_char.
  */
-static bool termchars_equal_override(termchar *a, termchar *b,
-                                     unsigned long bchr, unsigned long battr)
+#define ATTRTAB_MAX 65536
+
+static inline const termattr *cellattr(Terminal *term, const termchar *c)
+{
+    return &term->attrtab[c->attr];
+}
+
+/*
+ * The full attribute word of a cell of term->disptext, including the
+ * display-only bits kept in its dattr field.
+ */
+static unsigned long disp_attr(Terminal *term, const termchar *c)
+{
+    unsigned long attr = cellattr(term, c)->attr;
+    attr |= (unsigned long)(c->dattr &~ DISP_INVALID) << DISP_TDATTR_SHIFT;
+    if (c->dattr & DISP_INVALID)
+        attr |= ATTR_INVALID;
+    return attr;
+}
+
+static inline uint32_t optionalrgb_word(optionalrgb c)
+{
+    return c.enabled ? 0x1000000 | (c.r << 16) | (c.g << 8) | c.b : 0;
+}
+
+static size_t termattr_hash(unsigned long attr, truecolour tc)
+{
+    uint32_t h = (uint32_t)attr * 0x9E3779B1U;
+    h = (h ^ optionalrgb_word(tc.fg)) * 0x85EBCA77U;
+    h = (h ^ optionalrgb_word(tc.bg)) * 0xC2B2AE3DU;
+    return h ^ (h >> 16);
+}
+
+static void attrhash_rebuild(Terminal *term, size_t size)
+{
+    sfree(term->attrhash);
+    term->attrhash = snewn(size, uint32_t);
+    term->attrhashsize = size;
+    memset(term->attrhash, 0, size * sizeof(uint32_t));
+
+    for (size_t index = 0; index < term->nattrs; index++) {
+        const termattr *ta = &term->attrtab[index];
+        size_t i = termattr_hash(ta->attr, ta->truecolour) & (size - 1);
+        while (term->attrhash[i])
+            i = (i + 1) & (size - 1);
+        term->attrhash[i] = index + 1;
+    }
+}
+
+/*
+ * Find the index of an attribute and colour combination in the
+ * table, adding it if it's new.
+ */
+static unsigned term_intern_attr(Terminal *term, unsigned long attr,
+                                 truecolour tc)
+{
+    if (attr == term->lastattr.attr &&
+        truecolour_equal(tc, term->lastattr.truecolour))
+        return term->lastattr_index;
+
+    size_t mask = term->attrhashsize - 1;
+    size_t i = termattr_hash(attr, tc) & mask;
+    unsigned index;
+    for (; term->attrhash[i]; i = (i + 1) & mask) {
+        index = term->attrhash[i] - 1;
+        if (term->attrtab[index].attr == attr &&
+            truecolour_equal(term->attrtab[index].truecolour, tc))
+            goto found;
+    }
+
+    if (term->attr_gc_countdown)
+        term->attr_gc_countdown--;
+
+    if (term->nattrs == ATTRTAB_MAX) {
+        /*
+         * The table is full, and we can't make room until the next
+         * call to term_attr_gc. Make do with something close: the
+         * same attributes without true colour, or failing that, the
+         * defaults.
+         */
+        if (tc.fg.enabled || tc.bg.enabled) {
+            truecolour none = { optionalrgb_none, optionalrgb_none };
+            return term_intern_attr(term, attr, none);
+        }
+        return 0;
+    }
+
+    index = term->nattrs++;
+    sgrowarray(term->attrtab, term->attrtabsize, index);
+    term->attrtab[index].attr = attr;
+    term->attrtab[index].truecolour = tc;
+    term->attrhash[i] = index + 1;
+    if (term->nattrs * 2 > term->attrhashsize)
+        attrhash_rebuild(term, term->attrhashsize * 2);
+
+  found:
+    term->lastattr.attr = attr;
+    term->lastattr.truecolour = tc;
+    term->lastattr_index = index;
+    return index;
+}
+
+static inline void set_cellattr(Terminal *term, termchar *c,
+                                unsigned long attr, truecolour tc)
+{
+    c->attr = term_intern_attr(term, attr, tc);
+}
+
+static void attr_gc_keep(Terminal *term, const termattr *old, int *map,
+                         termchar *c)
+{
+    if (map[c->attr] < 0) {
+        map[c->attr] = term->nattrs;
+        sgrowarray(term->attrtab, term->attrtabsize, term->nattrs);
+        term->attrtab[term->nattrs++] = old[c->attr];
+    }
+    c->attr = map[c->attr];
+}
+
+static void attr_gc_keep_screen(Terminal *term, const termattr *old,
+                                int *map, termscreen *screen)
+{
+    if (!screen)
+        return;
+    for (int y = 0; y < termscreen_count(screen); y++) {
+        termline *line = termscreen_line(screen, y);
+        for (int x = 0; x < line->cols; x++)
+            attr_gc_keep(term, old, map, &line->chars[x]);
+    }
+}
+
+/*
+ * Rebuild the attribute table with only the entries that some cell
+ * still uses, renumbering them. Every cell that holds an index has
+ * to be reachable from here, so this must only be called when there
+ * are no temporary lines (decompressed from the scrollback) around.
+ */
+static void term_attr_gc(Terminal *term)
+{
+    /* Lines waiting to be compressed would only get in the way */
+    if (term->sbstage)
+        sb_flush_staged(term);
+
+    termattr *old = term->attrtab;
+    size_t nold = term->nattrs;
+    int *map = snewn(nold, int);
+    for (size_t i = 0; i < nold; i++)
+        map[i] = -1;
+
+    term->attrtab = NULL;
+    term->attrtabsize = term->nattrs = 0;
+
+    attr_gc_keep(term, old, map, &term->basic_erase_char);
+    assert(term->basic_erase_char.attr == 0);
+    attr_gc_keep(term, old, map, &term->erase_char);
+    attr_gc_keep_screen(term, old, map, term->screen);
+    attr_gc_keep_screen(term, old, map, term->alt_screen);
+    if (term->disptext) {
+        for (int y = 0; y < term->rows; y++)
+            for (int x = 0; x < term->disptext[y]->cols; x++)
+                attr_gc_keep(term, old, map, &term->disptext[y]->chars[x]);
+    }
+
+    /* The bidi cache just has to be rebuilt */
+    term_bidi_cache_flush(term);
+
+    sfree(map);
+    sfree(old);
+
+    size_t hashsize = 256;
+    while (hashsize < 2 * term->nattrs)
+        hashsize *= 2;
+    attrhash_rebuild(term, hashsize);
+
+    term->lastattr = term->attrtab[0];
+    term->lastattr_index = 0;
+
+    /*
+     * Don't come back here until a good fraction of the remaining
+     * space has been used up. If there's hardly any left, we may have
+     * to make do with approximate entries from term_intern_attr for
+     * a while, but that's better than rebuilding the table
+     * constantly.
+     */
+    term->attr_gc_countdown = (ATTRTAB_MAX - term->nattrs) / 2;
+    if (term->attr_gc_countdown < ATTRTAB_MAX / 4)
+        term->attr_gc_countdown = ATTRTAB_MAX / 4;
+}
+
+/*
+ * Called from places where it's safe to run term_attr_gc, if it's
+ * due.
+ */
+static inline void term_attr_maybe_gc(Terminal *term)
+{
+    if (!term->attr_gc_countdown)
+        term_attr_gc(term);
+}
+
+static bool cc_lists_equal(termchar *a, termchar *b)
 {
-    /* FULL-TERMCHAR */
-    if (!truecolour_equal(a->truecolour, b->truecolour))
-        return false;
-    if (a->chr != bchr)
-        return false;
-    if ((a->attr &~ DATTR_MASK) != (battr &~ DATTR_MASK))
-        return false;
     while (a->cc_next || b->cc_next) {
         if (!a->cc_next || !b->cc_next)
             return false;              /* one cc-list ends, other does not */
@@ -353,9 +663,35 @@ static bool termchars_equal_override(termchar *a, termchar *b,
     return true;
 }
 
+/*
+ * Compare two character cells for equality. Since there's only one
+ * entry in term->attrtab for each combination of attributes and
+ * colours, the attr indices can be compared directly.
+ */
 static bool termchars_equal(termchar *a, termchar *b)
 {
-    return termchars_equal_override(a, b, b->chr, b->attr);
+    /* FULL-TERMCHAR */
+    return (a->chr == b->chr && a->attr == b->attr &&
+            !((a->dattr | b->dattr) & DISP_INVALID) && cc_lists_equal(a, b));
+}
+
+/*
+ * Special case required in do_paint(), comparing a cell of
+ * term->disptext against one of the real screen, where we override
+ * what we expect the chr and attr fields of the latter to be.
+ */
+static bool termchars_equal_override(Terminal *term, termchar *a, termchar *b,
+                                     unsigned long bchr, unsigned long battr)
+{
+    /* FULL-TERMCHAR */
+    if (!truecolour_equal(cellattr(term, a)->truecolour,
+                          cellattr(term, b)->truecolour))
+        return false;
+    if (a->chr != bchr)
+        return false;
+    if ((disp_attr(term, a) &~ DATTR_MASK) != (battr &~ DATTR_MASK))
+        return false;
+    return cc_lists_equal(a, b);
 }
 
 /*
@@ -409,9 +745,9 @@ static void move_termchar(termline *line, termchar *dest, termchar *src)
  * bloating the terminal emulator's memory footprint unless those
  * features are in constant use.)
  */
-static void makerle(strbuf *b, termline *ldata,
-                    void (*makeliteral)(strbuf *b, termchar *c,
-                                        unsigned long *state))
+static void makerle(Terminal *term, strbuf *b, termline *ldata,
+                    void (*makeliteral)(Terminal *term, strbuf *b,
+                                        termchar *c, unsigned long *state))
 {
     int hdrpos, hdrsize, n, prevlen, prevpos, thislen, thispos;
     bool prev2;
@@ -428,7 +764,7 @@ static void makerle(strbuf *b, termline *ldata,
 
     while (n-- > 0) {
         thispos = b->len;
-        makeliteral(b, c++, &state);
+        makeliteral(term, b, c++, &state);
         thislen = b->len - thispos;
         if (thislen == prevlen &&
             !memcmp(b->u + prevpos, b->u + thispos, thislen)) {
@@ -481,7 +817,7 @@ static void makerle(strbuf *b, termline *ldata,
                     int tmppos, tmplen;
                     tmppos = b->len;
                     oldstate = state;
-                    makeliteral(b, c, &state);
+                    makeliteral(term, b, c, &state);
                     tmplen = b->len - tmppos;
                     bool match = tmplen == thislen &&
                         !memcmp(b->u + runpos+1, b->u + tmppos, tmplen);
@@ -545,7 +881,8 @@ static void makerle(strbuf *b, termline *ldata,
         strbuf_shrink_to(b, hdrpos);
     }
 }
-static void makeliteral_chr(strbuf *b, termchar *c, unsigned long *state)
+static void makeliteral_chr(Terminal *term, strbuf *b, termchar *c,
+                            unsigned long *state)
 {
     /*
      * My encoding for characters is UTF-8-like, in that it stores
@@ -600,8 +937,29 @@ static void makeliteral_chr(strbuf *b, termchar *c, unsigned long *state)
     }
     *state = c->chr & ~0xFF;
 }
-static void makeliteral_attr(strbuf *b, termchar *c, unsigned long *state)
+static void makeliteral_truecolour(strbuf *b, truecolour tc)
+{
+    /*
+     * Put the used parts of the colour info into the buffer.
+     */
+    put_byte(b, ((tc.fg.enabled ? 1 : 0) |
+                 (tc.bg.enabled ? 2 : 0)));
+    if (tc.fg.enabled) {
+        put_byte(b, tc.fg.r);
+        put_byte(b, tc.fg.g);
+        put_byte(b, tc.fg.b);
+    }
+    if (tc.bg.enabled) {
+        put_byte(b, tc.bg.r);
+        put_byte(b, tc.bg.g);
+        put_byte(b, tc.bg.b);
+    }
+}
+static void makeliteral_attr(Terminal *term, strbuf *b, termchar *c,
+                             unsigned long *state)
 {
+    const termattr *ta = cellattr(term, c);
+
     /*
      * My encoding for attributes is 16-bit-granular and assumes
      * that the top bit of the word is never required. I either
@@ -615,10 +973,13 @@ static void makeliteral_attr(strbuf *b, termchar *c, unsigned long *state)
      * use are placed higher up the word than everything else. This
      * ensures that attribute values remain 16-bit _unless_ the
      * user uses extended colour.
+     *
+     * The cell's true colour follows, in makeliteral_truecolour's
+     * format.
      */
     unsigned attr, colourbits;
 
-    attr = c->attr;
+    attr = ta->attr;
 
     assert(ATTR_BGSHIFT > ATTR_FGSHIFT);
 
@@ -642,26 +1003,11 @@ static void makeliteral_attr(strbuf *b, termchar *c, unsigned long *state)
         put_byte(b, (unsigned char)((attr >> 8) & 0xFF));
         put_byte(b, (unsigned char)(attr & 0xFF));
     }
+
+    makeliteral_truecolour(b, ta->truecolour);
 }
-static void makeliteral_truecolour(strbuf *b, termchar *c, unsigned long *state)
-{
-    /*
-     * Put the used parts of the colour info into the buffer.
-     */
-    put_byte(b, ((c->truecolour.fg.enabled ? 1 : 0) |
-                 (c->truecolour.bg.enabled ? 2 : 0)));
-    if (c->truecolour.fg.enabled) {
-        put_byte(b, c->truecolour.fg.r);
-        put_byte(b, c->truecolour.fg.g);
-        put_byte(b, c->truecolour.fg.b);
-    }
-    if (c->truecolour.bg.enabled) {
-        put_byte(b, c->truecolour.bg.r);
-        put_byte(b, c->truecolour.bg.g);
-        put_byte(b, c->truecolour.bg.b);
-    }
-}
-static void makeliteral_cc(strbuf *b, termchar *c, unsigned long *state)
+static void makeliteral_cc(Terminal *term, strbuf *b, termchar *c,
+                           unsigned long *state)
 {
     /*
      * For combining characters, I just encode a bunch of ordinary
@@ -680,26 +1026,19 @@ static void makeliteral_cc(strbuf *b, termchar *c, unsigned long *state)
         assert(c->chr != 0);
 
         zstate = 0;
-        makeliteral_chr(b, c, &zstate);
+        makeliteral_chr(term, b, c, &zstate);
     }
 
     z.chr = 0;
     zstate = 0;
-    makeliteral_chr(b, &z, &zstate);
+    makeliteral_chr(term, b, &z, &zstate);
 }
 
-typedef struct compressed_scrollback_line {
-    size_t len;
-} compressed_scrollback_line;
+static termline *decompressline(Terminal *term, ptrlen line);
 
-static termline *decompressline(compressed_scrollback_line *line);
-
-static compressed_scrollback_line *compressline(termline *ldata)
+static strbuf *compressline(Terminal *term, termline *ldata)
 {
-    strbuf *b = strbuf_new();
-
-    /* Leave space for the header structure */
-    strbuf_append(b, sizeof(compressed_scrollback_line));
+    strbuf *b = strbuf_new_nm();
 
     /*
      * First, store the column count, 7 bits at a time, least
@@ -741,15 +1080,9 @@ static compressed_scrollback_line *compressline(termline *ldata)
      *
      * The format of the `literals' varies between the fragments.
      */
-    makerle(b, ldata, makeliteral_chr);
-    makerle(b, ldata, makeliteral_attr);
-    makerle(b, ldata, makeliteral_truecolour);
-    makerle(b, ldata, makeliteral_cc);
-
-    size_t linelen = b->len - sizeof(compressed_scrollback_line);
-    compressed_scrollback_line *line =
-        (compressed_scrollback_line *)strbuf_to_str(b);
-    line->len = linelen;
+    makerle(term, b, ldata, makeliteral_chr);
+    makerle(term, b, ldata, makeliteral_attr);
+    makerle(term, b, ldata, makeliteral_cc);
 
     /*
      * Diagnostics: ensure that the compressed data really does
@@ -770,7 +1103,7 @@ static compressed_scrollback_line *compressline(termline *ldata)
         printf("\n");
 #endif
 
-        dcl = decompressline(line);
+        dcl = decompressline(term, ptrlen_from_strbuf(b));
         assert(ldata->cols == dcl->cols);
         assert(ldata->lattr == dcl->lattr);
         for (i = 0; i < ldata->cols; i++)
@@ -787,12 +1120,231 @@ static compressed_scrollback_line *compressline(termline *ldata)
 #endif
 #endif /* TERM_CC_DIAGS */
 
+    return b;
+}
+
+/*
+ * Lines leaving the top of the screen aren't compressed straight
+ * away. They wait as ordinary termlines in a staging area at the
+ * newest end of the scrollback (term->sbstage), and are compressed
+ * in a batch from a toplevel callback, so that a burst of output
+ * scrolling many lines doesn't pay for compressing each one on the
+ * way. SB_STAGE_MAX bounds the staging area in case the callback
+ * doesn't get a chance to run for a while.
+ */
+#define SB_STAGE_MAX 1024
+
+/*
+ * term->savelines when the scrollback is spilling to disk. It's not
+ * INT_MAX, to leave some room for arithmetic on line numbers.
+ */
+#define SAVELINES_UNLIMITED (INT_MAX / 2)
+
+/*
+ * The text of a line as searched by term_find(), which is also the
+ * form in which it's passed to scrollback_index_text. Combining
+ * characters are left out, and ASCII letters can be folded to lower
+ * case. xpos[i] gives the column that text[i] came from.
+ */
+typedef struct {
+    wchar_t *text;
+    int *xpos;
+    size_t len, size;
+} linetext;
+
+static void linetext_add(linetext *lt, wchar_t wc, int x, bool fold)
+{
+    if (lt->len >= lt->size) {
+        sgrowarray(lt->text, lt->size, lt->len);
+        lt->xpos = sresize(lt->xpos, lt->size, int);
+    }
+    if (fold && wc >= 'A' && wc <= 'Z')
+        wc += 'a' - 'A';
+    lt->text[lt->len] = wc;
+    lt->xpos[lt->len] = x;
+    lt->len++;
+}
+
+static void get_linetext(Terminal *term, termline *ldata, int cols,
+                         linetext *lt, bool fold)
+{
+    lt->len = 0;
+    for (int x = 0; x < cols && x < ldata->cols; x++) {
+        unsigned long uc = ldata->chars[x].chr;
+        if (uc == UCSWIDE)
+            continue;
+
+        switch (uc & CSET_MASK) {
+          case CSET_LINEDRW:
+            uc = term->ucsdata->unitab_xterm[uc & 0xFF];
+            break;
+          case CSET_ASCII:
+            uc = term->ucsdata->unitab_line[uc & 0xFF];
+            break;
+          case CSET_SCOACS:
+            uc = term->ucsdata->unitab_scoacs[uc & 0xFF];
+            break;
+        }
+        switch (uc & CSET_MASK) {
+          case CSET_ACP:
+            uc = term->ucsdata->unitab_font[uc & 0xFF];
+            break;
+          case CSET_OEMCP:
+            uc = term->ucsdata->unitab_oemcp[uc & 0xFF];
+            break;
+        }
+
+        /*
+         * Characters passed straight through to the font are in its
+         * encoding, which we can only translate if we know what it
+         * is. But the ASCII range is safe to assume.
+         */
+        if (DIRECT_CHAR(uc) || DIRECT_FONT(uc)) {
+            char c = uc & 0xFF;
+            wchar_t wbuf[4];
+            if (!(c & 0x80))
+                uc = c;
+            else if (DIRECT_FONT(uc) && mb_to_wc(term->ucsdata->font_codepage,
+                                                 0, &c, 1, wbuf, 4) > 0)
+                uc = wbuf[0];
+        }
+
+#ifdef PLATFORM_IS_UTF16
+        if (uc >= 0x10000 && uc < 0x110000) {
+            linetext_add(lt, 0xD800 | ((uc - 0x10000) >> 10), x, fold);
+            linetext_add(lt, 0xDC00 | ((uc - 0x10000) & 0x3FF), x, fold);
+            continue;
+        }
+#endif
+        linetext_add(lt, uc, x, fold);
+    }
+}
+
+static void sb_flush_staged(Terminal *term)
+{
+    linetext lt = { NULL, NULL, 0, 0 };
+
+    while (termscreen_count(term->sbstage) > 0) {
+        termline *line = termscreen_delpos(term->sbstage, 0);
+        strbuf *b = compressline(term, line);
+        scrollback_append(term->scrollback, ptrlen_from_strbuf(b));
+        strbuf_free(b);
+        get_linetext(term, line, line->cols, &lt, true);
+        scrollback_index_text(term->scrollback, lt.text, lt.len);
+        freetermline(line);
+    }
+
+    sfree(lt.text);
+    sfree(lt.xpos);
+}
+
+static void sb_flush_callback(void *vctx)
+{
+    Terminal *term = (Terminal *)vctx;
+    term->sbstage_pending = false;
+    sb_flush_staged(term);
+}
+
+/*
+ * Get the number of lines in the real scrollback, staged or not.
+ */
+static int sb_count(Terminal *term)
+{
+    return (scrollback_count(term->scrollback) +
+            termscreen_count(term->sbstage));
+}
+
+/*
+ * Add a line to the newest end of the scrollback. The scrollback
+ * takes ownership of the termline.
+ */
+static void sb_push(Terminal *term, termline *line)
+{
+    if (termscreen_count(term->sbstage) >= SB_STAGE_MAX)
+        sb_flush_staged(term);
+    termscreen_addpos(term->sbstage, line, termscreen_count(term->sbstage));
+    if (!term->sbstage_pending) {
+        term->sbstage_pending = true;
+        queue_toplevel_callback(sb_flush_callback, term);
+    }
+}
+
+/*
+ * Decompress line i of the compressed part of the scrollback, into a
+ * temporary termline.
+ */
+static termline *sb_decompress(Terminal *term, int i)
+{
+    ptrlen data = scrollback_get(term->scrollback, i);
+    if (!data.len) {
+        /* It was spilled to disk and we couldn't get it back */
+        termline *line = newtermline(term, term->cols, false);
+        line->temporary = true;
+        return line;
+    }
+    return decompressline(term, data);
+}
+
+/*
+ * Remove the newest line of the scrollback, and return it as a real
+ * (non-temporary) termline.
+ */
+static termline *sb_pop_newest(Terminal *term)
+{
+    int nstaged = termscreen_count(term->sbstage);
+    if (nstaged > 0)
+        return termscreen_delpos(term->sbstage, nstaged - 1);
+
+    termline *line = sb_decompress(
+        term, scrollback_count(term->scrollback) - 1);
+    scrollback_delete_newest(term->scrollback);
+    line->temporary = false;           /* reconstituted line is now real */
     return line;
 }
 
-static void readrle(BinarySource *bs, termline *ldata,
-                    void (*readliteral)(BinarySource *bs, termchar *c,
-                                        termline *ldata, unsigned long *state))
+static void sb_drop_oldest(Terminal *term)
+{
+    if (scrollback_count(term->scrollback) > 0)
+        scrollback_delete_oldest(term->scrollback);
+    else
+        freetermline(termscreen_delpos(term->sbstage, 0));
+}
+
+static void sb_clear(Terminal *term)
+{
+    if (!scrollback_clear(term->scrollback)) {
+        /*
+         * We couldn't make a new spill file, so the scrollback has
+         * gone back to living entirely in memory. Fall back to the
+         * configured limit on it, as term_size does if spilling can't
+         * be set up in the first place, and leave spill_applied
+         * showing that spilling is off, so that the next term_size
+         * tries again.
+         */
+        term->savelines = term->savelines_requested;
+        term->spill_applied = false;
+    }
+    while (termscreen_count(term->sbstage) > 0)
+        freetermline(termscreen_delpos(term->sbstage, 0));
+}
+
+/*
+ * Retrieve line i of the scrollback, counting from the oldest. Lines
+ * that have been compressed come back as temporary copies, to be
+ * freed by unlineptr().
+ */
+static termline *sb_line(Terminal *term, int i)
+{
+    int ncompressed = scrollback_count(term->scrollback);
+    if (i < ncompressed)
+        return sb_decompress(term, i);
+    return termscreen_line(term->sbstage, i - ncompressed);
+}
+
+static void readrle(Terminal *term, BinarySource *bs, termline *ldata,
+                    void (*readliteral)(Terminal *term, BinarySource *bs,
+                                        termchar *c, termline *ldata,
+                                        unsigned long *state))
 {
     int n = 0;
     unsigned long state = 0;
@@ -807,7 +1359,7 @@ static void readrle(BinarySource *bs, termline *ldata,
             while (count--) {
                 assert(n < ldata->cols);
                 bs->pos = pos;
-                readliteral(bs, ldata->chars + n, ldata, &state);
+                readliteral(term, bs, ldata->chars + n, ldata, &state);
                 n++;
             }
         } else {
@@ -816,7 +1368,7 @@ static void readrle(BinarySource *bs, termline *ldata,
             int count = hdr + 1;
             while (count--) {
                 assert(n < ldata->cols);
-                readliteral(bs, ldata->chars + n, ldata, &state);
+                readliteral(term, bs, ldata->chars + n, ldata, &state);
                 n++;
             }
         }
@@ -824,8 +1376,8 @@ static void readrle(BinarySource *bs, termline *ldata,
 
     assert(n == ldata->cols);
 }
-static void readliteral_chr(BinarySource *bs, termchar *c, termline *ldata,
-                            unsigned long *state)
+static void readliteral_chr(Terminal *term, BinarySource *bs, termchar *c,
+                            termline *ldata, unsigned long *state)
 {
     int byte;
 
@@ -856,8 +1408,33 @@ static void readliteral_chr(BinarySource *bs, termchar *c, termline *ldata,
     }
     *state = c->chr & ~0xFF;
 }
-static void readliteral_attr(BinarySource *bs, termchar *c, termline *ldata,
-                             unsigned long *state)
+static truecolour readliteral_truecolour(BinarySource *bs)
+{
+    truecolour tc;
+    int flags = get_byte(bs);
+
+    if (flags & 1) {
+        tc.fg.enabled = true;
+        tc.fg.r = get_byte(bs);
+        tc.fg.g = get_byte(bs);
+        tc.fg.b = get_byte(bs);
+    } else {
+        tc.fg = optionalrgb_none;
+    }
+
+    if (flags & 2) {
+        tc.bg.enabled = true;
+        tc.bg.r = get_byte(bs);
+        tc.bg.g = get_byte(bs);
+        tc.bg.b = get_byte(bs);
+    } else {
+        tc.bg = optionalrgb_none;
+    }
+
+    return tc;
+}
+static void readliteral_attr(Terminal *term, BinarySource *bs, termchar *c,
+                             termline *ldata, unsigned long *state)
 {
     unsigned val, attr, colourbits;
 
@@ -880,33 +1457,11 @@ static void readliteral_attr(BinarySource *bs, termchar *c, termline *ldata,
     attr |= (colourbits >> 4) << (ATTR_BGSHIFT + 4);
     attr |= (colourbits & 0xF) << (ATTR_FGSHIFT + 4);
 
-    c->attr = attr;
-}
-static void readliteral_truecolour(
-    BinarySource *bs, termchar *c, termline *ldata, unsigned long *state)
-{
-    int flags = get_byte(bs);
-
-    if (flags & 1) {
-        c->truecolour.fg.enabled = true;
-        c->truecolour.fg.r = get_byte(bs);
-        c->truecolour.fg.g = get_byte(bs);
-        c->truecolour.fg.b = get_byte(bs);
-    } else {
-        c->truecolour.fg = optionalrgb_none;
-    }
-
-    if (flags & 2) {
-        c->truecolour.bg.enabled = true;
-        c->truecolour.bg.r = get_byte(bs);
-        c->truecolour.bg.g = get_byte(bs);
-        c->truecolour.bg.b = get_byte(bs);
-    } else {
-        c->truecolour.bg = optionalrgb_none;
-    }
+    set_cellattr(term, c, attr, readliteral_truecolour(bs));
+    c->dattr = 0;
 }
-static void readliteral_cc(BinarySource *bs, termchar *c, termline *ldata,
-                           unsigned long *state)
+static void readliteral_cc(Terminal *term, BinarySource *bs, termchar *c,
+                           termline *ldata, unsigned long *state)
 {
     termchar n;
     unsigned long zstate;
@@ -916,20 +1471,20 @@ static void readliteral_cc(BinarySource *bs, termchar *c, termline *ldata,
 
     while (1) {
         zstate = 0;
-        readliteral_chr(bs, &n, ldata, &zstate);
+        readliteral_chr(term, bs, &n, ldata, &zstate);
         if (!n.chr)
             break;
         add_cc(ldata, x, n.chr);
     }
 }
 
-static termline *decompressline(compressed_scrollback_line *line)
+static termline *decompressline(Terminal *term, ptrlen line)
 {
     int ncols, byte, shift;
     BinarySource bs[1];
     termline *ldata;
 
-    BinarySource_BARE_INIT(bs, line+1, line->len);
+    BinarySource_BARE_INIT_PL(bs, line);
 
     /*
      * First read in the column count.
@@ -949,6 +1504,8 @@ static termline *decompressline(compressed_scrollback_line *line)
     ldata->cols = ldata->size = ncols;
     ldata->temporary = true;
     ldata->cc_free = 0;
+    ldata->damage_start = 0;
+    ldata->damage_end = INT_MAX;
 
     /*
      * We must set all the cc pointers in ldata->chars to 0 right
@@ -977,10 +1534,9 @@ static termline *decompressline(compressed_scrollback_line *line)
     /*
      * Now we read in each of the RLE streams in turn.
      */
-    readrle(bs, ldata, readliteral_chr);
-    readrle(bs, ldata, readliteral_attr);
-    readrle(bs, ldata, readliteral_truecolour);
-    readrle(bs, ldata, readliteral_cc);
+    readrle(term, bs, ldata, readliteral_chr);
+    readrle(term, bs, ldata, readliteral_attr);
+    readrle(term, bs, ldata, readliteral_cc);
 
     /* And we always expect that we ended up exactly at the end of the
      * compressed data. */
@@ -1061,6 +1617,8 @@ static void resizeline(Terminal *term, termline *line, int cols)
         for (i = oldcols; i < cols; i++)
             line->chars[i] = term->basic_erase_char;
 
+        termline_damage(line, oldcols < cols ? oldcols : cols, INT_MAX);
+
 #ifdef TERM_CC_DIAGS
         cc_check(line);
 #endif
@@ -1072,7 +1630,7 @@ static void resizeline(Terminal *term, termline *line, int cols)
  */
 static int sblines(Terminal *term)
 {
-    int sblines = count234(term->scrollback);
+    int sblines = sb_count(term);
     if (term->erase_to_scrollback &&
         term->alt_which && term->alt_screen) {
         sblines += term->alt_sblines;
@@ -1081,7 +1639,7 @@ static int sblines(Terminal *term)
 }
 
 static void null_line_error(Terminal *term, int y, int lineno,
-                            tree234 *whichtree, int treeindex,
+                            void *whichtree, int treeindex,
                             const char *varname)
 {
     modalfatalbox("%s==NULL in terminal.c\n"
@@ -1094,9 +1652,9 @@ static void null_line_error(Terminal *term, int y, int lineno,
                   "Please contact <putty@projects.tartarus.org> "
                   "and pass on the above information.",
                   varname, lineno, y, term->cols, term->rows,
-                  term->scrollback, count234(term->scrollback),
-                  term->screen, count234(term->screen),
-                  term->alt_screen, count234(term->alt_screen),
+                  term->scrollback, sb_count(term),
+                  term->screen, termscreen_count(term->screen),
+                  term->alt_screen, termscreen_count(term->alt_screen),
                   term->alt_sblines, whichtree, treeindex, commitid);
 }
 
@@ -1108,7 +1666,7 @@ static void null_line_error(Terminal *term, int y, int lineno,
 static termline *lineptr(Terminal *term, int y, int lineno, int screen)
 {
     termline *line;
-    tree234 *whichtree;
+    void *whichtree;
     int treeindex;
 
     if (y >= 0) {
@@ -1125,7 +1683,7 @@ static termline *lineptr(Terminal *term, int y, int lineno, int screen)
         }
         if (y < -altlines) {
             whichtree = term->scrollback;
-            treeindex = y + altlines + count234(term->scrollback);
+            treeindex = y + altlines + sb_count(term);
         } else {
             whichtree = term->alt_screen;
             treeindex = y + term->alt_sblines;
@@ -1133,12 +1691,11 @@ static termline *lineptr(Terminal *term, int y, int lineno, int screen)
         }
     }
     if (whichtree == term->scrollback) {
-        compressed_scrollback_line *cline = index234(whichtree, treeindex);
-        if (!cline)
+        if (treeindex < 0 || treeindex >= sb_count(term))
             null_line_error(term, y, lineno, whichtree, treeindex, "cline");
-        line = decompressline(cline);
+        line = sb_line(term, treeindex);
     } else {
-        line = index234(whichtree, treeindex);
+        line = termscreen_line(whichtree, treeindex);
     }
 
     /* We assume that we don't screw up and retrieve something out of range. */
@@ -1224,16 +1781,59 @@ static void term_timer(void *ctx, unsigned long now)
         term_update_callback(term);
 }
 
+/*
+ * Decide how long the cooldown after the update we're about to do
+ * should be, from what has happened since the last one.
+ */
+static void term_pace_updates(Terminal *term)
+{
+    unsigned long interval = GETTICKCOUNT() - term->last_update_time;
+    bool flooded;
+
+    if (term->update_pacing != UPDATE_PACING_ADAPTIVE) {
+        term->flood_updates = 0;
+        term->update_delay = UPDATE_DELAY;
+        return;
+    }
+
+    /*
+     * We're flooded if, over at least a normal cooldown period, data
+     * has been coming in at more than a screenful per period, or
+     * parsing it has taken more than half of our time.
+     */
+    flooded = interval >= UPDATE_DELAY &&
+        ((uint64_t)term->parse_bytes * UPDATE_DELAY >
+         (uint64_t)term->rows * term->cols * interval ||
+         term->parse_ticks * 2 > interval);
+
+    if (!flooded) {
+        term->flood_updates = 0;
+        term->update_delay = UPDATE_DELAY;
+    } else if (term->flood_updates < FLOOD_UPDATES) {
+        term->flood_updates++;
+    } else {
+        /*
+         * Sustained flood. Space updates out so that painting takes
+         * at most a small share of the time, but not so far apart
+         * that the window looks stuck.
+         */
+        unsigned long delay = term->paint_cost * FLOOD_PAINT_SHARE / 16;
+        term->update_delay = min(max(delay, FLOOD_DELAY), FLOOD_MAX_DELAY);
+    }
+}
+
 static void term_update_callback(void *ctx)
 {
     Terminal *term = (Terminal *)ctx;
     if (!term->window_update_pending)
         return;
-    if (!term->window_update_cooldown) {
+    if (!term->window_update_cooldown || term->key_update_pending) {
+        term_pace_updates(term);
+        term->key_update_pending = false;
         term_update(term);
         term->window_update_cooldown = true;
         term->window_update_cooldown_end = schedule_timer(
-            UPDATE_DELAY, term_timer, term);
+            term->update_delay, term_timer, term);
     }
 }
 
@@ -1415,6 +2015,9 @@ static void power_on(Terminal *term, bool clear)
 void term_update(Terminal *term)
 {
     term->window_update_pending = false;
+    term->last_update_time = GETTICKCOUNT();
+    term->parse_bytes = 0;
+    term->parse_ticks = 0;
 
     if (term->win_move_pending) {
         win_move(term->win, term->win_move_pending_x,
@@ -1476,6 +2079,8 @@ void term_update(Terminal *term)
         if (need_sbar_update)
             update_sbar(term);
         do_paint(term);
+        term->paint_cost = (term->paint_cost * 7 +
+                            (GETTICKCOUNT() - term->last_update_time) * 16) / 8;
         win_set_cursor_pos(
             term->win, term->curs.x, term->curs.y - term->disptop);
         win_free_draw_ctx(term->win);
@@ -1511,6 +2116,21 @@ void term_seen_key_event(Terminal *term)
         term->disptop = 0;             /* return to main screen */
         seen_disp_event(term);
     }
+
+    /*
+     * Someone is waiting to see what their keypress did, so if we've
+     * been holding back updates for a flood, stop, and let the next
+     * one through straight away. Without a flood, updates go at the
+     * normal pace, keypress or no keypress.
+     */
+    if (term->update_pacing == UPDATE_PACING_ADAPTIVE &&
+        term->flood_updates > 0) {
+        term->flood_updates = 0;
+        term->update_delay = UPDATE_DELAY;
+        term->key_update_pending = true;
+        if (term->window_update_pending)
+            queue_toplevel_callback(term_update_callback, term);
+    }
 }
 
 /*
@@ -1530,9 +2150,10 @@ static void set_erase_char(Terminal *term)
 {
     term->erase_char = term->basic_erase_char;
     if (term->use_bce) {
-        term->erase_char.attr = (term->curr_attr &
-                                 (ATTR_FGMASK | ATTR_BGMASK));
-        term->erase_char.truecolour.bg = term->curr_truecolour.bg;
+        truecolour tc = cellattr(term, &term->basic_erase_char)->truecolour;
+        tc.bg = term->curr_truecolour.bg;
+        set_cellattr(term, &term->erase_char,
+                     term->curr_attr & (ATTR_FGMASK | ATTR_BGMASK), tc);
     }
 }
 
@@ -1583,6 +2204,8 @@ static void term_copy_stuff_from_conf(Terminal *term)
     term->rxvt_homeend = conf_get_bool(term->conf, CONF_rxvt_homeend);
     term->scroll_on_disp = conf_get_bool(term->conf, CONF_scroll_on_disp);
     term->scroll_on_key = conf_get_bool(term->conf, CONF_scroll_on_key);
+    term->spill_scrollback = conf_get_bool(term->conf, CONF_spill_scrollback);
+    term->update_pacing = conf_get_int(term->conf, CONF_update_pacing);
     term->xterm_mouse_forbidden = conf_get_bool(term->conf, CONF_no_mouse_rep);
     term->xterm_256_colour = conf_get_bool(term->conf, CONF_xterm_256_colour);
     term->true_colour = conf_get_bool(term->conf, CONF_true_colour);
@@ -1663,14 +2286,7 @@ void term_reconfig(Terminal *term, Conf *conf)
         conf_get_bool(conf, CONF_no_arabicshaping) ||
         conf_get_bool(term->conf, CONF_no_bidi) !=
         conf_get_bool(conf, CONF_no_bidi)) {
-        for (i = 0; i < term->bidi_cache_size; i++) {
-            sfree(term->pre_bidi_cache[i].chars);
-            sfree(term->post_bidi_cache[i].chars);
-            term->pre_bidi_cache[i].width = -1;
-            term->pre_bidi_cache[i].chars = NULL;
-            term->post_bidi_cache[i].width = -1;
-            term->post_bidi_cache[i].chars = NULL;
-        }
+        term_bidi_cache_flush(term);
     }
 
     {
@@ -1742,6 +2358,9 @@ void term_reconfig(Terminal *term, Conf *conf)
     term_schedule_cblink(term);
     term_copy_stuff_from_conf(term);
     term_update_raw_mouse_mode(term);
+
+    if (term->rows >= 0 && term->spill_scrollback != term->spill_applied)
+        term_size(term, term->rows, term->cols, term->savelines_requested);
 }
 
 /*
@@ -1749,7 +2368,6 @@ void term_reconfig(Terminal *term, Conf *conf)
  */
 void term_clrsb(Terminal *term)
 {
-    unsigned char *line;
     int i;
 
     /*
@@ -1761,9 +2379,7 @@ void term_clrsb(Terminal *term)
     /*
      * Clear the actual scrollback.
      */
-    while ((line = delpos234(term->scrollback, 0)) != NULL) {
-        sfree(line);            /* this is compressed data, not a termline */
-    }
+    sb_clear(term);
 
     /*
      * When clearing the scrollback, we also truncate any termlines on
@@ -1964,6 +2580,7 @@ Terminal *term_init(Conf *myconf, struct unicode_data *ucsdata, TermWin *win)
     term->ucsdata = ucsdata;
     term->conf = conf_copy(myconf);
     term->logctx = NULL;
+    term->logbuf_len = 0;
     term->compatibility_level = TM_PUTTY;
     strcpy(term->id_string, "\033[?6c");
     term->cblink_pending = term->tblink_pending = false;
@@ -1989,12 +2606,18 @@ Terminal *term_init(Conf *myconf, struct unicode_data *ucsdata, TermWin *win)
 
     term_copy_stuff_from_conf(term);
 
-    term->screen = term->alt_screen = term->scrollback = NULL;
+    term->screen = term->alt_screen = NULL;
+    term->scrollback = NULL;
+    term->sbstage = NULL;
+    term->sbstage_pending = false;
     term->tempsblines = 0;
     term->alt_sblines = 0;
     term->disptop = 0;
     term->disptext = NULL;
     term->dispcursx = term->dispcursy = -1;
+    term->dispsrc = NULL;
+    term->paintchars = NULL;
+    memset(&term->paintstate, 0, sizeof(term->paintstate));
     term->tabs = NULL;
     deselect(term);
     term->rows = term->cols = -1;
@@ -2014,16 +2637,39 @@ Terminal *term_init(Conf *myconf, struct unicode_data *ucsdata, TermWin *win)
 
     term->window_update_pending = false;
     term->window_update_cooldown = false;
+    term->update_delay = UPDATE_DELAY;
+    term->last_update_time = GETTICKCOUNT();
+    term->paint_cost = term->parse_ticks = 0;
+    term->parse_bytes = 0;
+    term->flood_updates = 0;
+    term->key_update_pending = false;
+
+    term->bidi_cache = NULL;
+    term->bidi_cache_hash = NULL;
+    term->bidi_cache_size = term->bidi_cache_used = 0;
+    term->bidi_cache_hashmask = 0;
+    term->bidi_lru_head = term->bidi_lru_tail = -1;
+#ifdef DEBUG
+    term->bidi_cache_hits = term->bidi_cache_misses = 0;
+#endif
 
-    term->bidi_cache_size = 0;
-    term->pre_bidi_cache = term->post_bidi_cache = NULL;
+    term->attrtab = snewn(1, termattr);
+    term->attrtabsize = 1;
+    term->nattrs = 1;
+    term->attrtab[0].attr = ATTR_DEFAULT;
+    term->attrtab[0].truecolour.fg = optionalrgb_none;
+    term->attrtab[0].truecolour.bg = optionalrgb_none;
+    term->attrhash = NULL;
+    attrhash_rebuild(term, 256);
+    term->attr_gc_countdown = (ATTRTAB_MAX - 1) / 2;
+    term->lastattr = term->attrtab[0];
+    term->lastattr_index = 0;
 
     /* FULL-TERMCHAR */
     term->basic_erase_char.chr = CSET_ASCII | ' ';
-    term->basic_erase_char.attr = ATTR_DEFAULT;
+    term->basic_erase_char.attr = 0;
+    term->basic_erase_char.dattr = 0;
     term->basic_erase_char.cc_next = 0;
-    term->basic_erase_char.truecolour.fg = optionalrgb_none;
-    term->basic_erase_char.truecolour.bg = optionalrgb_none;
     term->erase_char = term->basic_erase_char;
 
     term->last_selected_text = NULL;
@@ -2070,24 +2716,20 @@ Terminal *term_init(Conf *myconf, struct unicode_data *ucsdata, TermWin *win)
 
 void term_free(Terminal *term)
 {
-    termline *line;
     struct beeptime *beep;
     int i;
 
-    while ((line = delpos234(term->scrollback, 0)) != NULL)
-        sfree(line);                   /* compressed data, not a termline */
-    freetree234(term->scrollback);
-    while ((line = delpos234(term->screen, 0)) != NULL)
-        freetermline(line);
-    freetree234(term->screen);
-    while ((line = delpos234(term->alt_screen, 0)) != NULL)
-        freetermline(line);
-    freetree234(term->alt_screen);
+    scrollback_free(term->scrollback);
+    termscreen_free(term->sbstage);
+    termscreen_free(term->screen);
+    termscreen_free(term->alt_screen);
     if (term->disptext) {
         for (i = 0; i < term->rows; i++)
             freetermline(term->disptext[i]);
     }
     sfree(term->disptext);
+    sfree(term->dispsrc);
+    sfree(term->paintchars);
     while (term->beephead) {
         beep = term->beephead;
         term->beephead = beep->next;
@@ -2103,14 +2745,14 @@ void term_free(Terminal *term)
     sfree(term->wcTo);
     sfree(term->answerback);
 
-    for (i = 0; i < term->bidi_cache_size; i++) {
-        sfree(term->pre_bidi_cache[i].chars);
-        sfree(term->post_bidi_cache[i].chars);
-        sfree(term->post_bidi_cache[i].forward);
-        sfree(term->post_bidi_cache[i].backward);
-    }
-    sfree(term->pre_bidi_cache);
-    sfree(term->post_bidi_cache);
+#ifdef DEBUG
+    debug("bidi cache: %lu hits, %lu misses\n",
+          term->bidi_cache_hits, term->bidi_cache_misses);
+#endif
+    term_bidi_cache_flush(term);
+
+    sfree(term->attrtab);
+    sfree(term->attrhash);
 
     sfree(term->tabs);
 
@@ -2143,14 +2785,15 @@ void term_get_cursor_position(Terminal *term, int *x, int *y)
  */
 void term_size(Terminal *term, int newrows, int newcols, int newsavelines)
 {
-    tree234 *newalt;
+    termscreen *newalt;
     termline **newdisp, *line;
     int i, j, oldrows = term->rows;
     int sblen;
     int save_alt_which = term->alt_which;
 
     if (newrows == term->rows && newcols == term->cols &&
-        newsavelines == term->savelines)
+        newsavelines == term->savelines_requested &&
+        term->spill_scrollback == term->spill_applied)
         return;                        /* nothing to do */
 
     /* Behave sensibly if we're given zero (or negative) rows/cols */
@@ -2165,12 +2808,25 @@ void term_size(Terminal *term, int newrows, int newcols, int newsavelines)
     term->alt_b = term->marg_b = newrows - 1;
 
     if (term->rows == -1) {
-        term->scrollback = newtree234(NULL);
-        term->screen = newtree234(NULL);
+        term->scrollback = scrollback_new();
+        term->sbstage = termscreen_new();
+        term->screen = termscreen_new();
         term->tempsblines = 0;
         term->rows = 0;
     }
 
+    /*
+     * If we're spilling old scrollback to disk, then the number of
+     * lines we were asked for is only how many to keep in memory, and
+     * the scrollback as a whole is unlimited.
+     */
+    term->savelines_requested = newsavelines;
+    term->spill_applied = term->spill_scrollback;
+    if (scrollback_set_spill(term->scrollback, (term->spill_scrollback &&
+                                                newsavelines > 0 ?
+                                                newsavelines : 0)))
+        newsavelines = SAVELINES_UNLIMITED;
+
     /*
      * Resize the screen and scrollback. We only need to shift
      * lines around within our data structures, because lineptr()
@@ -2190,20 +2846,17 @@ void term_size(Terminal *term, int newrows, int newcols, int newsavelines)
      *    amount of scrollback we actually have, we must throw some
      *    away.
      */
-    sblen = count234(term->scrollback);
+    sblen = sb_count(term);
     /* Do this loop to expand the screen if newrows > rows */
-    assert(term->rows == count234(term->screen));
+    assert(term->rows == termscreen_count(term->screen));
     while (term->rows < newrows) {
         if (term->tempsblines > 0) {
-            compressed_scrollback_line *cline;
             /* Insert a line from the scrollback at the top of the screen. */
             assert(sblen >= term->tempsblines);
-            cline = delpos234(term->scrollback, --sblen);
-            line = decompressline(cline);
-            sfree(cline);
-            line->temporary = false;   /* reconstituted line is now real */
+            line = sb_pop_newest(term);
+            sblen--;
             term->tempsblines -= 1;
-            addpos234(term->screen, line, 0);
+            termscreen_addpos(term->screen, line, 0);
             term->curs.y += 1;
             term->savecurs.y += 1;
             term->alt_y += 1;
@@ -2211,7 +2864,8 @@ void term_size(Terminal *term, int newrows, int newcols, int newsavelines)
         } else {
             /* Add a new blank line at the bottom of the screen. */
             line = newtermline(term, newcols, false);
-            addpos234(term->screen, line, count234(term->screen));
+            termscreen_addpos(term->screen, line,
+                              termscreen_count(term->screen));
         }
         term->rows += 1;
     }
@@ -2219,13 +2873,13 @@ void term_size(Terminal *term, int newrows, int newcols, int newsavelines)
     while (term->rows > newrows) {
         if (term->curs.y < term->rows - 1) {
             /* delete bottom row, unless it contains the cursor */
-            line = delpos234(term->screen, term->rows - 1);
+            line = termscreen_delpos(term->screen, term->rows - 1);
             freetermline(line);
         } else {
             /* push top row to scrollback */
-            line = delpos234(term->screen, 0);
-            addpos234(term->scrollback, compressline(line), sblen++);
-            freetermline(line);
+            line = termscreen_delpos(term->screen, 0);
+            sb_push(term, line);
+            sblen++;
             term->tempsblines += 1;
             term->curs.y -= 1;
             term->savecurs.y -= 1;
@@ -2235,18 +2889,17 @@ void term_size(Terminal *term, int newrows, int newcols, int newsavelines)
         term->rows -= 1;
     }
     assert(term->rows == newrows);
-    assert(count234(term->screen) == newrows);
+    assert(termscreen_count(term->screen) == newrows);
 
     /* Delete any excess lines from the scrollback. */
     while (sblen > newsavelines) {
-        line = delpos234(term->scrollback, 0);
-        sfree(line);
+        sb_drop_oldest(term);
         sblen--;
     }
     if (sblen < term->tempsblines)
         term->tempsblines = sblen;
-    assert(count234(term->scrollback) <= newsavelines);
-    assert(count234(term->scrollback) >= term->tempsblines);
+    assert(sb_count(term) <= newsavelines);
+    assert(sb_count(term) >= term->tempsblines);
     term->disptop = 0;
 
     /* Make a new displayed text buffer. */
@@ -2254,7 +2907,7 @@ void term_size(Terminal *term, int newrows, int newcols, int newsavelines)
     for (i = 0; i < newrows; i++) {
         newdisp[i] = newtermline(term, newcols, false);
         for (j = 0; j < newcols; j++)
-            newdisp[i]->chars[j].attr = ATTR_INVALID;
+            newdisp[i]->chars[j].dattr = DISP_INVALID;
     }
     if (term->disptext) {
         for (i = 0; i < oldrows; i++)
@@ -2263,18 +2916,20 @@ void term_size(Terminal *term, int newrows, int newcols, int newsavelines)
     sfree(term->disptext);
     term->disptext = newdisp;
     term->dispcursx = term->dispcursy = -1;
+    sfree(term->dispsrc);
+    term->dispsrc = snewn(newrows, termline *);
+    for (i = 0; i < newrows; i++)
+        term->dispsrc[i] = NULL;
+    sfree(term->paintchars);
+    term->paintchars = snewn((size_t)newrows * newcols, struct paintchar);
 
     /* Make a new alternate screen. */
-    newalt = newtree234(NULL);
+    newalt = termscreen_new();
     for (i = 0; i < newrows; i++) {
         line = newtermline(term, newcols, true);
-        addpos234(newalt, line, i);
-    }
-    if (term->alt_screen) {
-        while (NULL != (line = delpos234(term->alt_screen, 0)))
-            freetermline(line);
-        freetree234(term->alt_screen);
+        termscreen_addpos(newalt, line, i);
     }
+    termscreen_free(term->alt_screen);
     term->alt_screen = newalt;
     term->alt_sblines = 0;
 
@@ -2347,11 +3002,11 @@ void term_provide_backend(Terminal *term, Backend *backend)
  * If only the top line has content, returns 0.
  * If no lines have content, return -1.
  */
-static int find_last_nonempty_line(Terminal *term, tree234 *screen)
+static int find_last_nonempty_line(Terminal *term, termscreen *screen)
 {
     int i;
-    for (i = count234(screen) - 1; i >= 0; i--) {
-        termline *line = index234(screen, i);
+    for (i = termscreen_count(screen) - 1; i >= 0; i--) {
+        termline *line = termscreen_line(screen, i);
         int j;
         for (j = 0; j < line->cols; j++)
             if (!termchars_equal(&line->chars[j], &term->erase_char))
@@ -2375,7 +3030,7 @@ static void swap_screen(Terminal *term, int which,
     bool bt;
     pos tp;
     truecolour ttc;
-    tree234 *ttr;
+    termscreen *ttr;
 
     if (!which)
         reset = false;                 /* do no weird resetting if which==0 */
@@ -2565,10 +3220,10 @@ static void scroll(Terminal *term, int topline, int botline,
         if (lines > scrollwinsize)
             lines = scrollwinsize;
         while (lines-- > 0) {
-            line = delpos234(term->screen, botline);
+            line = termscreen_delpos(term->screen, botline);
             resizeline(term, line, term->cols);
             clear_line(term, line);
-            addpos234(term->screen, line, topline);
+            termscreen_addpos(term->screen, line, topline);
 
             if (term->selstart.y >= topline && term->selstart.y <= botline) {
                 term->selstart.y++;
@@ -2589,29 +3244,26 @@ static void scroll(Terminal *term, int topline, int botline,
         if (lines > scrollwinsize)
             lines = scrollwinsize;
         while (lines-- > 0) {
-            line = delpos234(term->screen, topline);
+            line = termscreen_delpos(term->screen, topline);
 #ifdef TERM_CC_DIAGS
             cc_check(line);
 #endif
             if (sb && term->savelines > 0) {
-                int sblen = count234(term->scrollback);
+                int sblen = sb_count(term);
                 /*
                  * We must add this line to the scrollback. We'll
                  * remove a line from the top of the scrollback if
                  * the scrollback is full.
                  */
-                if (sblen == term->savelines) {
-                    unsigned char *cline;
-
-                    sblen--;
-                    cline = delpos234(term->scrollback, 0);
-                    sfree(cline);
-                } else
+                if (sblen == term->savelines)
+                    sb_drop_oldest(term);
+                else
                     term->tempsblines += 1;
 
-                addpos234(term->scrollback, compressline(line), sblen);
+                sb_push(term, line);
 
-                /* now `line' itself can be reused as the bottom line */
+                /* so we need a fresh line for the bottom */
+                line = newtermline(term, term->cols, false);
 
                 /*
                  * If the user is currently looking at part of the
@@ -2633,7 +3285,7 @@ static void scroll(Terminal *term, int topline, int botline,
             resizeline(term, line, term->cols);
             clear_line(term, line);
             line->trusted = false;
-            addpos234(term->screen, line, botline);
+            termscreen_addpos(term->screen, line, botline);
 
             /*
              * If the selection endpoints move into the scrollback,
@@ -3225,6 +3877,48 @@ static void term_print_finish(Terminal *term)
     term->printing = term->only_printing = false;
 }
 
+/*
+ * Session logging of terminal output. Bytes are collected in
+ * term->logbuf and written out by term_log_flush, which term_out
+ * calls before it returns.
+ */
+static void term_log_flush(Terminal *term)
+{
+    if (term->logbuf_len) {
+        if (term->logctx)
+            logtraffic_span(term->logctx, make_ptrlen(
+                                term->logbuf, term->logbuf_len),
+                            term->logtype);
+        term->logbuf_len = 0;
+    }
+}
+static inline void term_log_byte(Terminal *term, unsigned char c,
+                                 int logmode)
+{
+    if (term->logtype != logmode || !term->logctx)
+        return;
+    if (term->logbuf_len == sizeof(term->logbuf))
+        term_log_flush(term);
+    term->logbuf[term->logbuf_len++] = c;
+}
+static void term_log_bytes(Terminal *term, const unsigned char *data,
+                           size_t len, int logmode)
+{
+    if (term->logtype != logmode || !term->logctx)
+        return;
+    while (len > 0) {
+        if (term->logbuf_len == sizeof(term->logbuf))
+            term_log_flush(term);
+        size_t chunk = sizeof(term->logbuf) - term->logbuf_len;
+        if (chunk > len)
+            chunk = len;
+        memcpy(term->logbuf + term->logbuf_len, data, chunk);
+        term->logbuf_len += chunk;
+        data += chunk;
+        len -= chunk;
+    }
+}
+
 static void term_display_graphic_char(Terminal *term, unsigned long c)
 {
     struct iso2022_data *iso2022 = TERMINAL_LOAD_ISO2022(term);
@@ -3254,7 +3948,7 @@ static void term_display_graphic_char(Terminal *term, unsigned long c)
         incpos(cursplus);
         check_selection(term, term->curs, cursplus);
     }
-    if (conf_get_int(term->conf, CONF_logtype) == LGTYP_ASCII && iso2022
+    if (term->logtype == LGTYP_ASCII && iso2022
             && term->utf8.chr == (int) c
             && 0x7f < c && c < 0x80000000
             && term->logctx) {
@@ -3266,16 +3960,16 @@ static void term_display_graphic_char(Terminal *term, unsigned long c)
             int shifts = i * 6;
             int mask = (1 << (5 - i + 1)) - 1;
             int prebits = (0xff & ~((1 << (5 - i + 2)) - 1));
-            logtraffic(term->logctx, (unsigned char) (prebits | ((c >> shifts) & mask)), LGTYP_ASCII);
+            term_log_byte(term, (unsigned char) (prebits | ((c >> shifts) & mask)), LGTYP_ASCII);
             do {
                 shifts -= 6;
-                logtraffic(term->logctx, (unsigned char) (0x80 | ((c >> shifts) & 0x3f)), LGTYP_ASCII);
+                term_log_byte(term, (unsigned char) (0x80 | ((c >> shifts) & 0x3f)), LGTYP_ASCII);
             } while (shifts > 0);
         }
     } else
-    if (((c & CSET_MASK) == CSET_ASCII ||
-         (c & CSET_MASK) == 0) && term->logctx)
-        logtraffic(term->logctx, (unsigned char) c, LGTYP_ASCII);
+    if ((c & CSET_MASK) == CSET_ASCII ||
+        (c & CSET_MASK) == 0)
+        term_log_byte(term, (unsigned char) c, LGTYP_ASCII);
 
     check_trust_status(term, cline);
 
@@ -3330,18 +4024,16 @@ static void term_display_graphic_char(Terminal *term, unsigned long c)
         /* FULL-TERMCHAR */
         clear_cc(cline, term->curs.x);
         cline->chars[term->curs.x].chr = c;
-        cline->chars[term->curs.x].attr = term->curr_attr;
-        cline->chars[term->curs.x].truecolour =
-            term->curr_truecolour;
+        set_cellattr(term, &cline->chars[term->curs.x],
+                     term->curr_attr, term->curr_truecolour);
 
         term->curs.x++;
 
         /* FULL-TERMCHAR */
         clear_cc(cline, term->curs.x);
         cline->chars[term->curs.x].chr = UCSWIDE;
-        cline->chars[term->curs.x].attr = term->curr_attr;
-        cline->chars[term->curs.x].truecolour =
-            term->curr_truecolour;
+        set_cellattr(term, &cline->chars[term->curs.x],
+                     term->curr_attr, term->curr_truecolour);
 
         break;
       case 1:
@@ -3351,9 +4043,8 @@ static void term_display_graphic_char(Terminal *term, unsigned long c)
         /* FULL-TERMCHAR */
         clear_cc(cline, term->curs.x);
         cline->chars[term->curs.x].chr = c;
-        cline->chars[term->curs.x].attr = term->curr_attr;
-        cline->chars[term->curs.x].truecolour =
-            term->curr_truecolour;
+        set_cellattr(term, &cline->chars[term->curs.x],
+                     term->curr_attr, term->curr_truecolour);
 
         break;
       case 0:
@@ -3398,6 +4089,91 @@ static void term_display_graphic_char(Terminal *term, unsigned long c)
     seen_disp_event(term);
 }
 
+/*
+ * Fast path for term_out: display a run of plain printable ASCII in
+ * one go, when it's certain that doing so has exactly the same effect
+ * as passing each character through term_translate and
+ * term_display_graphic_char in turn. Returns the number of bytes
+ * consumed from 'data', which is zero if the caller must deal with
+ * the next byte the slow way.
+ *
+ * The run is stopped short of the last column of the line, so that
+ * wrapping (including the pending-wrap state, and its VT52 variant)
+ * is always left to the slow path. The caller must not use this at
+ * all while ISO 2022 decoding is active.
+ */
+static size_t term_out_printable_run(Terminal *term,
+                                     const unsigned char *data, size_t len)
+{
+    if (term->termstate != TOPLEVEL || term->printing ||
+        term->wrapnext || term->insert || term->utf8.state != 0)
+        return 0;
+
+    /*
+     * Check that printable ASCII will be translated to itself in the
+     * ASCII character set.
+     */
+    if (in_utf(term)) {
+        if (term->utf8linedraw &&
+            term->cset_attr[term->cset] == CSET_LINEDRW)
+            return 0;
+    } else {
+        if (term->sco_acs || term->cset_attr[term->cset] != CSET_ASCII)
+            return 0;
+    }
+
+    /* check_trust_status below will make the line's trust match ours */
+    int linecols = term->cols;
+    if (term->trusted)
+        linecols -= TRUST_SIGIL_WIDTH;
+    if (term->curs.x >= linecols - 1)
+        return 0;
+    size_t room = linecols - 1 - term->curs.x;
+    if (len > room)
+        len = room;
+
+    const unsigned char *unitab_ctrl = term->ucsdata->unitab_ctrl;
+    size_t n = 0;
+    while (n < len && data[n] >= 0x20 && data[n] < 0x7F &&
+           unitab_ctrl[data[n]] == 0xFF)
+        n++;
+    if (!n)
+        return 0;
+
+    term_log_bytes(term, data, n, LGTYP_DEBUG);
+    term_log_bytes(term, data, n, LGTYP_ASCII);
+
+    termline *cline = scrlineptr(term->curs.y);
+    check_trust_status(term, cline);
+
+    int x0 = term->curs.x, y = term->curs.y;
+    if (term->selstate != NO_SELECTION) {
+        pos start = { .y = y, .x = x0 }, end = { .y = y, .x = x0 + n };
+        check_selection(term, start, end);
+    }
+
+    /*
+     * Wide characters can only be broken at the two ends of the run:
+     * every cell in between is overwritten anyway.
+     */
+    check_boundary(term, x0, y);
+    check_boundary(term, x0 + n, y);
+
+    unsigned attr = term_intern_attr(term, term->curr_attr,
+                                     term->curr_truecolour);
+    for (size_t i = 0; i < n; i++) {
+        /* FULL-TERMCHAR */
+        clear_cc(cline, x0 + i);
+        cline->chars[x0 + i].chr = data[i] | CSET_ASCII;
+        cline->chars[x0 + i].attr = attr;
+    }
+
+    term->curs.x += n;
+    term->last_graphic_char = data[n - 1] | CSET_ASCII;
+    seen_disp_event(term);
+    return n;
+}
+
 static strbuf *term_input_data_from_unicode(
     Terminal *term, const wchar_t *widebuf, int len)
 {
@@ -3689,6 +4465,8 @@ static void term_out(Terminal *term, bool called_from_term_data)
            unget != -1 ||
            bufchain_size(&term->inbuf) > 0 ||
            (iso2022 && iso2022_buflen(iso2022) > 0)) {
+        term_attr_maybe_gc(term);
+
         if (unget != -1) {
             /*
              * Handle a character we left in 'unget' the last time
@@ -3743,14 +4521,23 @@ static void term_out(Terminal *term, bool called_from_term_data)
                 assert(chars != NULL);
                 assert(nchars_used < nchars_got);
             }
+
+            if (!iso2022) {
+                size_t run = term_out_printable_run(
+                    term, chars + nchars_used, nchars_got - nchars_used);
+                if (run) {
+                    nchars_used += run;
+                    continue;
+                }
+            }
+
             c = chars[nchars_used++];
 
             /*
              * Optionally log the session traffic to a file. Useful for
              * debugging and possibly also useful for actual logging.
              */
-            if (term->logtype == LGTYP_DEBUG && term->logctx)
-                logtraffic(term->logctx, (unsigned char) c, LGTYP_DEBUG);
+            term_log_byte(term, (unsigned char) c, LGTYP_DEBUG);
             if (iso2022) iso2022_put(iso2022, c);
             } /* iso2022: notice no unindent */
             if (iso2022) {
@@ -3984,8 +4771,7 @@ static void term_out(Terminal *term, bool called_from_term_data)
                     else if (term->curs.y < term->rows - 1)
                         term->curs.y++;
                 }
-                if (term->logctx)
-                    logtraffic(term->logctx, (unsigned char) c, LGTYP_ASCII);
+                term_log_byte(term, (unsigned char) c, LGTYP_ASCII);
                 break;
               case '\014':            /* FF: Form feed */
                 if (has_compat(SCOANSI)) {
@@ -4008,8 +4794,7 @@ static void term_out(Terminal *term, bool called_from_term_data)
                     term->curs.x = 0;
                 term->wrapnext = false;
                 seen_disp_event(term);
-                if (term->logctx)
-                    logtraffic(term->logctx, (unsigned char) c, LGTYP_ASCII);
+                term_log_byte(term, (unsigned char) c, LGTYP_ASCII);
                 break;
               case '\t': {              /* HT: Character tabulation */
                 pos old_curs = term->curs;
@@ -4567,7 +5352,8 @@ static void term_out(Terminal *term, bool called_from_term_data)
                           case 0:       /* restore defaults */
                             term->curr_attr = term->default_attr;
                             term->curr_truecolour =
-                                term->basic_erase_char.truecolour;
+                                cellattr(term, &term->basic_erase_char)
+                                ->truecolour;
                             break;
                           case 1:       /* enable bold */
                             compatibility(VT100AVO);
@@ -5676,6 +6462,7 @@ static void term_out(Terminal *term, bool called_from_term_data)
         win_unthrottle(term->win, bufchain_size(&term->inbuf));
 
     term_print_flush(term);
+    term_log_flush(term);
     if (term->logflush && term->logctx)
         logflush(term->logctx);
 }
@@ -5701,81 +6488,148 @@ static void parse_optionalrgb(optionalrgb *out, unsigned *values)
 
 /*
  * To prevent having to run the reasonably tricky bidi algorithm
- * too many times, we maintain a cache of the last lineful of data
- * fed to the algorithm on each line of the display.
+ * too many times, we maintain a cache of lines fed to it, looked up
+ * by their contents. See the comment in terminal.h.
  */
-static bool term_bidi_cache_hit(Terminal *term, int line,
-                                termchar *lbefore, int width, bool trusted)
-{
-    int i;
+#define BIDI_CACHE_MIN 64
 
-    if (!term->pre_bidi_cache)
-        return false;                  /* cache doesn't even exist yet! */
+static void term_bidi_cache_flush(Terminal *term)
+{
+    for (int i = 0; i < term->bidi_cache_used; i++) {
+        struct bidi_cache_entry *e = &term->bidi_cache[i];
+        sfree(e->pre);
+        sfree(e->post);
+        sfree(e->forward);
+        sfree(e->backward);
+    }
+    sfree(term->bidi_cache);
+    sfree(term->bidi_cache_hash);
+    term->bidi_cache = NULL;
+    term->bidi_cache_hash = NULL;
+    term->bidi_cache_size = term->bidi_cache_used = 0;
+    term->bidi_cache_hashmask = 0;
+    term->bidi_lru_head = term->bidi_lru_tail = -1;
+}
 
-    if (line >= term->bidi_cache_size)
-        return false;                  /* cache doesn't have this many lines */
+static unsigned long bidi_line_hash(termchar *chars, int width, bool trusted)
+{
+    uint32_t hash = trusted ? 0x811C9DC5 : 0x050C5D1F;
+    for (int i = 0; i < width; i++) {
+        hash = (hash ^ chars[i].chr) * 0x01000193;
+        hash = (hash ^ chars[i].attr) * 0x01000193;
+    }
+    return hash;
+}
 
-    if (!term->pre_bidi_cache[line].chars)
-        return false;                  /* cache doesn't contain _this_ line */
+static void bidi_lru_unlink(Terminal *term, int i)
+{
+    struct bidi_cache_entry *e = &term->bidi_cache[i];
+    if (e->lru_prev >= 0)
+        term->bidi_cache[e->lru_prev].lru_next = e->lru_next;
+    else
+        term->bidi_lru_head = e->lru_next;
+    if (e->lru_next >= 0)
+        term->bidi_cache[e->lru_next].lru_prev = e->lru_prev;
+    else
+        term->bidi_lru_tail = e->lru_prev;
+}
 
-    if (term->pre_bidi_cache[line].width != width)
-        return false;                  /* line is wrong width */
+static void bidi_lru_push(Terminal *term, int i)
+{
+    struct bidi_cache_entry *e = &term->bidi_cache[i];
+    e->lru_prev = -1;
+    e->lru_next = term->bidi_lru_head;
+    if (term->bidi_lru_head >= 0)
+        term->bidi_cache[term->bidi_lru_head].lru_prev = i;
+    else
+        term->bidi_lru_tail = i;
+    term->bidi_lru_head = i;
+}
 
-    if (term->pre_bidi_cache[line].trusted != trusted)
-        return false;                  /* line has wrong trust state */
+static struct bidi_cache_entry *term_bidi_cache_find(
+    Terminal *term, unsigned long hash, termchar *lbefore, int width,
+    bool trusted)
+{
+    int i, j;
 
-    for (i = 0; i < width; i++)
-        if (!termchars_equal(term->pre_bidi_cache[line].chars+i, lbefore+i))
-            return false;              /* line doesn't match cache */
+    if (!term->bidi_cache)
+        return NULL;                   /* cache doesn't even exist yet! */
 
-    return true;                       /* it didn't match. */
-}
+    for (i = term->bidi_cache_hash[hash & term->bidi_cache_hashmask];
+         i >= 0; i = term->bidi_cache[i].hash_next) {
+        struct bidi_cache_entry *e = &term->bidi_cache[i];
 
-static void term_bidi_cache_store(Terminal *term, int line, termchar *lbefore,
-                                  termchar *lafter, bidi_char *wcTo,
-                                  int width, int size, bool trusted)
-{
-    size_t i, j;
+        if (e->hash != hash || e->width != width || e->trusted != trusted)
+            continue;
+        for (j = 0; j < width; j++)
+            if (!termchars_equal(e->pre + j, lbefore + j))
+                break;
+        if (j < width)
+            continue;                  /* line doesn't match after all */
 
-    if (!term->pre_bidi_cache || term->bidi_cache_size <= line) {
-        j = term->bidi_cache_size;
-        sgrowarray(term->pre_bidi_cache, term->bidi_cache_size, line);
-        term->post_bidi_cache = sresize(term->post_bidi_cache,
-                                        term->bidi_cache_size,
-                                        struct bidi_cache_entry);
-        while (j < term->bidi_cache_size) {
-            term->pre_bidi_cache[j].chars =
-                term->post_bidi_cache[j].chars = NULL;
-            term->pre_bidi_cache[j].width =
-                term->post_bidi_cache[j].width = -1;
-            term->pre_bidi_cache[j].trusted = false;
-            term->post_bidi_cache[j].trusted = false;
-            term->pre_bidi_cache[j].forward =
-                term->post_bidi_cache[j].forward = NULL;
-            term->pre_bidi_cache[j].backward =
-                term->post_bidi_cache[j].backward = NULL;
-            j++;
-        }
+        bidi_lru_unlink(term, i);
+        bidi_lru_push(term, i);
+        return e;
     }
 
-    sfree(term->pre_bidi_cache[line].chars);
-    sfree(term->post_bidi_cache[line].chars);
-    sfree(term->post_bidi_cache[line].forward);
-    sfree(term->post_bidi_cache[line].backward);
+    return NULL;
+}
 
-    term->pre_bidi_cache[line].width = width;
-    term->pre_bidi_cache[line].trusted = trusted;
-    term->pre_bidi_cache[line].chars = snewn(size, termchar);
-    term->post_bidi_cache[line].width = width;
-    term->post_bidi_cache[line].trusted = trusted;
-    term->post_bidi_cache[line].chars = snewn(size, termchar);
-    term->post_bidi_cache[line].forward = snewn(width, int);
-    term->post_bidi_cache[line].backward = snewn(width, int);
+static struct bidi_cache_entry *term_bidi_cache_store(
+    Terminal *term, unsigned long hash, termchar *lbefore, termchar *lafter,
+    bidi_char *wcTo, int width, int size, bool trusted)
+{
+    struct bidi_cache_entry *e;
+    int i, j, *p;
 
-    memcpy(term->pre_bidi_cache[line].chars, lbefore, size * TSIZE);
-    memcpy(term->post_bidi_cache[line].chars, lafter, size * TSIZE);
-    memset(term->post_bidi_cache[line].forward, 0, width * sizeof(int));
-    memset(term->post_bidi_cache[line].backward, 0, width * sizeof(int));
+    /*
+     * Make sure the cache is there, and big enough for the screen
+     * size we've now got. (If it isn't, just start it afresh.)
+     */
+    if (term->bidi_cache_size < 2 * term->rows || !term->bidi_cache) {
+        term_bidi_cache_flush(term);
+        term->bidi_cache_size = max(BIDI_CACHE_MIN, 2 * term->rows);
+        term->bidi_cache = snewn(term->bidi_cache_size,
+                                 struct bidi_cache_entry);
+        term->bidi_cache_hashmask = 1;
+        while (term->bidi_cache_hashmask < 2 * term->bidi_cache_size)
+            term->bidi_cache_hashmask <<= 1;
+        term->bidi_cache_hash = snewn(term->bidi_cache_hashmask, int);
+        for (i = 0; i < term->bidi_cache_hashmask; i++)
+            term->bidi_cache_hash[i] = -1;
+        term->bidi_cache_hashmask--;
+    }
+
+    if (term->bidi_cache_used < term->bidi_cache_size) {
+        i = term->bidi_cache_used++;
+    } else {
+        /* Evict the least recently used entry */
+        i = term->bidi_lru_tail;
+        e = &term->bidi_cache[i];
+        bidi_lru_unlink(term, i);
+        for (p = &term->bidi_cache_hash[e->hash & term->bidi_cache_hashmask];
+             *p != i; p = &term->bidi_cache[*p].hash_next)
+            assert(*p >= 0);
+        *p = e->hash_next;
+        sfree(e->pre);
+        sfree(e->post);
+        sfree(e->forward);
+        sfree(e->backward);
+    }
+
+    e = &term->bidi_cache[i];
+    e->hash = hash;
+    e->width = width;
+    e->trusted = trusted;
+    e->pre = snewn(size, termchar);
+    e->post = snewn(size, termchar);
+    e->forward = snewn(width, int);
+    e->backward = snewn(width, int);
+
+    memcpy(e->pre, lbefore, size * TSIZE);
+    memcpy(e->post, lafter, size * TSIZE);
+    memset(e->forward, 0, width * sizeof(int));
+    memset(e->backward, 0, width * sizeof(int));
 
     for (i = j = 0; j < width; j += wcTo[i].nchars, i++) {
         int p = wcTo[i].index;
@@ -5784,33 +6638,52 @@ static void term_bidi_cache_store(Terminal *term, int line, termchar *lbefore,
             assert(0 <= p && p < width);
 
             for (int x = 0; x < wcTo[i].nchars; x++) {
-                term->post_bidi_cache[line].backward[j+x] = p+x;
-                term->post_bidi_cache[line].forward[p+x] = j+x;
+                e->backward[j+x] = p+x;
+                e->forward[p+x] = j+x;
             }
         }
     }
+
+    i = e - term->bidi_cache;
+    e->hash_next = term->bidi_cache_hash[hash & term->bidi_cache_hashmask];
+    term->bidi_cache_hash[hash & term->bidi_cache_hashmask] = i;
+    bidi_lru_push(term, i);
+
+    return e;
 }
 
 /*
- * Prepare the bidi information for a screen line. Returns the
- * transformed list of termchars, or NULL if no transformation at
- * all took place (because bidi is disabled). If return was
- * non-NULL, auxiliary information such as the forward and reverse
- * mappings of permutation position are available in
- * term->post_bidi_cache[scr_y].*.
+ * Prepare the bidi information for a screen line. Returns the cache
+ * entry holding the transformed list of termchars and the forward
+ * and reverse mappings of permutation position, or NULL if no
+ * transformation at all took place (because bidi is disabled). The
+ * entry is only valid until the next call.
  */
-static termchar *term_bidi_line(Terminal *term, struct termline *ldata,
-                                int scr_y)
+static struct bidi_cache_entry *term_bidi_line(Terminal *term,
+                                               struct termline *ldata)
 {
-    termchar *lchars;
+    struct bidi_cache_entry *entry;
     int it;
 
     /* Do Arabic shaping and bidi. */
     if (!term->no_bidi || !term->no_arabicshaping ||
         (ldata->trusted && term->cols > TRUST_SIGIL_WIDTH)) {
+        unsigned long hash = bidi_line_hash(ldata->chars, term->cols,
+                                            ldata->trusted);
+
+        entry = term_bidi_cache_find(term, hash, ldata->chars, term->cols,
+                                     ldata->trusted);
+#ifdef DEBUG
+        if (entry)
+            term->bidi_cache_hits++;
+        else
+            term->bidi_cache_misses++;
+        if ((term->bidi_cache_hits + term->bidi_cache_misses) % 65536 == 0)
+            debug("bidi cache: %lu hits, %lu misses\n",
+                  term->bidi_cache_hits, term->bidi_cache_misses);
+#endif
 
-        if (!term_bidi_cache_hit(term, scr_y, ldata->chars, term->cols,
-                                 ldata->trusted)) {
+        if (!entry) {
 
             if (term->wcFromTo_size < term->cols) {
                 term->wcFromTo_size = term->cols;
@@ -5916,19 +6789,16 @@ static termchar *term_bidi_line(Terminal *term, struct termline *ldata,
                 }
             }
             assert(opos == term->cols);
-            term_bidi_cache_store(term, scr_y, ldata->chars,
-                                  term->ltemp, term->wcTo,
-                                  term->cols, ldata->size, ldata->trusted);
-
-            lchars = term->ltemp;
-        } else {
-            lchars = term->post_bidi_cache[scr_y].chars;
+            entry = term_bidi_cache_store(term, hash, ldata->chars,
+                                          term->ltemp, term->wcTo,
+                                          term->cols, ldata->size,
+                                          ldata->trusted);
         }
     } else {
-        lchars = NULL;
+        entry = NULL;
     }
 
-    return lchars;
+    return entry;
 }
 
 static void do_paint_draw(Terminal *term, termline *ldata, int x, int y,
@@ -5941,8 +6811,9 @@ static void do_paint_draw(Terminal *term, termline *ldata, int x, int y,
         assert(attr & ATTR_WIDE);
         wchar_t tch[2];
         tch[0] = tch[1] = L' ';
-        win_draw_text(term->win, x, y, tch, 2, term->basic_erase_char.attr,
-                      ldata->lattr, term->basic_erase_char.truecolour);
+        const termattr *ta = cellattr(term, &term->basic_erase_char);
+        win_draw_text(term->win, x, y, tch, 2, ta->attr,
+                      ldata->lattr, ta->truecolour);
         win_draw_trust_sigil(term->win, x, y);
     } else {
         win_draw_text(term->win, x, y, ch, ccount, attr, ldata->lattr, tc);
@@ -5952,6 +6823,138 @@ static void do_paint_draw(Terminal *term, termline *ldata, int x, int y,
     }
 }
 
+static bool paintstate_equal(const struct paintstate *a,
+                             const struct paintstate *b)
+{
+    if (a->disptop != b->disptop || a->rv != b->rv ||
+        a->selected != b->selected ||
+        a->blink_is_real != b->blink_is_real ||
+        a->blinked_off != b->blinked_off ||
+        a->ansi_colour != b->ansi_colour ||
+        a->xterm_256_colour != b->xterm_256_colour ||
+        a->true_colour != b->true_colour ||
+        a->no_bidi != b->no_bidi ||
+        a->no_arabicshaping != b->no_arabicshaping ||
+        a->rawcnp != b->rawcnp)
+        return false;
+    if (a->selected &&
+        (a->seltype != b->seltype || !poseq(a->selstart, b->selstart) ||
+         !poseq(a->selend, b->selend)))
+        return false;
+    return true;
+}
+
+/*
+ * See if the lines on the screen have simply moved up or down since
+ * we last painted, as they do whenever the screen or a scroll region
+ * scrolls. dispsrc[] records which termline each row was drawn from,
+ * so a scroll shows up as a run of rows whose lines were last drawn
+ * a fixed number of rows away. If the front end can move the pixels
+ * itself, we move our record of what's on the screen to match, after
+ * which do_paint will find that most of those rows need no drawing at
+ * all, and only the rows uncovered by the move are redrawn in full.
+ */
+static void do_paint_scroll(Terminal *term)
+{
+    int i, j, k, len, best_start = 0, best_len = 0, best_k = 0;
+    int top, bot, n, m, cols = term->cols;
+    termline **disptext, **dispsrc;
+    struct paintchar *paintchars;
+
+    /* Lines in the scrollback are decompressed afresh each time, so
+     * can't be recognised; only try this on the live screen */
+    if (term->disptop != 0)
+        return;
+
+    /*
+     * Find the longest run of rows [best_start, best_start+best_len)
+     * whose lines were all drawn best_k rows further down last time.
+     */
+    for (i = 0; i < term->rows; i += len) {
+        termline *line = termscreen_line(term->screen, i);
+
+        len = 1;
+        if (term->dispsrc[i] == line)
+            continue;
+        for (j = 0; j < term->rows; j++)
+            if (term->dispsrc[j] == line)
+                break;
+        if (j == term->rows)
+            continue;
+
+        k = j - i;
+        while (i + len < term->rows && i + len + k < term->rows &&
+               term->dispsrc[i + len + k] ==
+               termscreen_line(term->screen, i + len))
+            len++;
+        if (len > best_len) {
+            best_start = i;
+            best_len = len;
+            best_k = k;
+        }
+    }
+
+    /* A single matching row might just be a reused termline pointer */
+    if (best_len < 2)
+        return;
+
+    if (best_k > 0) {
+        top = best_start;
+        bot = best_start + best_len + best_k - 1;
+    } else {
+        top = best_start + best_k;
+        bot = best_start + best_len - 1;
+    }
+    if (!win_scroll(term->win, top, bot, best_k))
+        return;
+
+    /*
+     * Rotate our per-row records of the region to match what the
+     * front end did with the pixels.
+     */
+    n = bot - top + 1;
+    disptext = snewn(n, termline *);
+    dispsrc = snewn(n, termline *);
+    paintchars = snewn((size_t)n * cols, struct paintchar);
+    for (m = 0; m < n; m++) {
+        int from = top + (m + best_k + n) % n;
+        disptext[m] = term->disptext[from];
+        dispsrc[m] = term->dispsrc[from];
+        memcpy(paintchars + (size_t)m * cols,
+               term->paintchars + (size_t)from * cols,
+               cols * sizeof(struct paintchar));
+    }
+    memcpy(term->disptext + top, disptext, n * sizeof(termline *));
+    memcpy(term->dispsrc + top, dispsrc, n * sizeof(termline *));
+    memcpy(term->paintchars + (size_t)top * cols, paintchars,
+           (size_t)n * cols * sizeof(struct paintchar));
+    sfree(disptext);
+    sfree(dispsrc);
+    sfree(paintchars);
+
+    /* The rows outside the run now hold nothing we can rely on */
+    for (i = top; i <= bot; i++) {
+        if (i >= best_start && i < best_start + best_len)
+            continue;
+        term->dispsrc[i] = NULL;
+        for (j = 0; j < cols; j++)
+            term->disptext[i]->chars[j].dattr |= DISP_INVALID;
+    }
+
+    /*
+     * If the cursor was drawn in the run, it's moved with it. If it
+     * was elsewhere in the region, it's been overwritten or will be
+     * redrawn, so there's nothing left to remove.
+     */
+    if (term->dispcursy >= best_start + best_k &&
+        term->dispcursy < best_start + best_len + best_k) {
+        term->dispcursy -= best_k;
+    } else if (term->dispcursy >= top && term->dispcursy <= bot) {
+        term->dispcursx = term->dispcursy = -1;
+        term->curstype = 0;
+    }
+}
+
 /*
  * Given a context, update the window.
  */
@@ -5962,13 +6965,13 @@ static void do_paint(Terminal *term)
     pos scrpos;
     wchar_t *ch;
     size_t chlen;
-    termchar *newline;
+    struct paintchar *newline;
+    struct paintstate ps;
+    int oldcurs_y = -1, oldcurs_x = 0;
 
     chlen = 1024;
     ch = snewn(chlen, wchar_t);
 
-    newline = snewn(term->cols, termchar);
-
     rv = (!term->rvideo ^ !term->in_vbell ? ATTR_REVERSE : 0);
 
     /* Depends on:
@@ -5976,7 +6979,37 @@ static void do_paint(Terminal *term)
      * selection, rv,
      * blinkpc, blink_is_real, tblinker,
      * curs.y, curs.x, cblinker, blink_cur, cursor_on, has_focus, wrapnext
+     *
+     * Of those, everything that isn't either in the screen array or
+     * to do with the cursor goes in the paintstate. If it's changed,
+     * then nothing we drew last time can be relied on.
      */
+    memset(&ps, 0, sizeof(ps));
+    ps.disptop = term->disptop;
+    ps.rv = rv;
+    ps.selected = (term->selstate == DRAGGING ||
+                   term->selstate == SELECTED);
+    if (ps.selected) {
+        ps.seltype = term->seltype;
+        ps.selstart = term->selstart;
+        ps.selend = term->selend;
+    }
+    ps.blink_is_real = term->blink_is_real;
+    ps.blinked_off = (term->blink_is_real && term->has_focus &&
+                      term->tblinker);
+    ps.ansi_colour = term->ansi_colour;
+    ps.xterm_256_colour = term->xterm_256_colour;
+    ps.true_colour = term->true_colour;
+    ps.no_bidi = term->no_bidi;
+    ps.no_arabicshaping = term->no_arabicshaping;
+    ps.rawcnp = term->rawcnp;
+    if (!paintstate_equal(&ps, &term->paintstate)) {
+        for (i = 0; i < term->rows; i++)
+            term->dispsrc[i] = NULL;
+        term->paintstate = ps;
+    }
+
+    do_paint_scroll(term);
 
     /* Has the cursor position or type changed ? */
     if (term->cursor_on) {
@@ -6003,12 +7036,14 @@ static void do_paint(Terminal *term)
          *    one space to the left.
          */
         termline *ldata = lineptr(term->curs.y);
+        struct bidi_cache_entry *bidi;
         termchar *lchars;
 
         our_curs_x = term->curs.x;
 
-        if ( (lchars = term_bidi_line(term, ldata, our_curs_y)) != NULL) {
-            our_curs_x = term->post_bidi_cache[our_curs_y].forward[our_curs_x];
+        if ( (bidi = term_bidi_line(term, ldata)) != NULL) {
+            our_curs_x = bidi->forward[our_curs_x];
+            lchars = bidi->post;
         } else
             lchars = ldata->chars;
 
@@ -6032,10 +7067,14 @@ static void do_paint(Terminal *term)
             term->dispcursx;
 
         if (term->dispcursx > 0 && dispcurs->chr == UCSWIDE)
-            dispcurs[-1].attr |= ATTR_INVALID;
+            dispcurs[-1].dattr |= DISP_INVALID;
         if (term->dispcursx < term->cols-1 && dispcurs[1].chr == UCSWIDE)
-            dispcurs[1].attr |= ATTR_INVALID;
-        dispcurs->attr |= ATTR_INVALID;
+            dispcurs[1].dattr |= DISP_INVALID;
+        dispcurs->dattr |= DISP_INVALID;
+
+        /* Those cells will have to be looked at again */
+        oldcurs_y = term->dispcursy;
+        oldcurs_x = term->dispcursx;
 
         term->curstype = 0;
     }
@@ -6052,16 +7091,66 @@ static void do_paint(Terminal *term)
         bool last_run_dirty = false;
         int laststart;
         bool dirtyrect;
+        struct bidi_cache_entry *bidi;
         int *backward;
         truecolour tc;
+        int damage_start, damage_end;
+
+        /* No temporary lines are in use between rows */
+        term_attr_maybe_gc(term);
 
         scrpos.y = i + term->disptop;
         ldata = lineptr(scrpos.y);
+        newline = term->paintchars + (size_t)i * term->cols;
+
+        /*
+         * Work out which cells might look different from last time.
+         * If this row was last drawn from the same line, then only
+         * the damaged ones, plus the one to the left of those
+         * (which might have become or stopped being a wide
+         * character), plus wherever the cursor is now or was last
+         * time.
+         */
+        if (term->dispsrc[i] == ldata) {
+            damage_start = ldata->damage_start;
+            damage_end = ldata->damage_end;
+            if (damage_start > 0)
+                damage_start--;
+            if (damage_end > term->cols)
+                damage_end = term->cols;
+            if (i == our_curs_y) {
+                if (damage_start > our_curs_x)
+                    damage_start = our_curs_x;
+                if (damage_end < our_curs_x + 1)
+                    damage_end = our_curs_x + 1;
+            }
+            if (i == oldcurs_y) {
+                if (damage_start > oldcurs_x - 1)
+                    damage_start = max(oldcurs_x - 1, 0);
+                if (damage_end < oldcurs_x + 2)
+                    damage_end = min(oldcurs_x + 2, term->cols);
+            }
+            if (damage_start >= damage_end &&
+                ldata->lattr == term->disptext[i]->lattr) {
+                unlineptr(ldata);
+                continue;
+            }
+        } else {
+            damage_start = 0;
+            damage_end = term->cols;
+        }
+        term->dispsrc[i] = ldata;
+        ldata->damage_start = INT_MAX;
+        ldata->damage_end = 0;
 
         /* Do Arabic shaping and bidi. */
-        lchars = term_bidi_line(term, ldata, i);
-        if (lchars) {
-            backward = term->post_bidi_cache[i].backward;
+        bidi = term_bidi_line(term, ldata);
+        if (bidi) {
+            lchars = bidi->post;
+            backward = bidi->backward;
+            /* Cells may have moved, so we can't trust any of them */
+            damage_start = 0;
+            damage_end = term->cols;
         } else {
             lchars = ldata->chars;
             backward = NULL;
@@ -6071,13 +7160,13 @@ static void do_paint(Terminal *term)
          * First loop: work along the line deciding what we want
          * each character cell to look like.
          */
-        for (j = 0; j < term->cols; j++) {
+        for (j = damage_start; j < damage_end; j++) {
             unsigned long tattr, tchar;
             termchar *d = lchars + j;
             scrpos.x = backward ? backward[j] : j;
 
             tchar = d->chr;
-            tattr = d->attr;
+            tattr = cellattr(term, d)->attr;
 
             if (!term->ansi_colour)
                 tattr = (tattr & ~(ATTR_FGMASK | ATTR_BGMASK)) |
@@ -6094,7 +7183,7 @@ static void do_paint(Terminal *term)
             }
 
             if (term->true_colour) {
-                tc = d->truecolour;
+                tc = cellattr(term, d)->truecolour;
             } else {
                 tc.fg = tc.bg = optionalrgb_none;
             }
@@ -6138,13 +7227,13 @@ static void do_paint(Terminal *term)
              * Check the font we'll _probably_ be using to see if
              * the character is wide when we don't want it to be.
              */
+            unsigned long dattr = disp_attr(term, &term->disptext[i]->chars[j]);
             if (tchar != term->disptext[i]->chars[j].chr ||
-                tattr != (term->disptext[i]->chars[j].attr &~
-                          (ATTR_NARROW | DATTR_MASK))) {
+                tattr != (dattr &~ (ATTR_NARROW | DATTR_MASK))) {
                 if ((tattr & ATTR_WIDE) == 0 &&
                     win_char_width(term->win, tchar) == 2)
                     tattr |= ATTR_NARROW;
-            } else if (term->disptext[i]->chars[j].attr & ATTR_NARROW)
+            } else if (dattr & ATTR_NARROW)
                 tattr |= ATTR_NARROW;
 
             if (i == our_curs_y && j == our_curs_x) {
@@ -6159,7 +7248,6 @@ static void do_paint(Terminal *term)
             newline[j].chr = tchar;
             newline[j].truecolour = tc;
             /* Combining characters are still read from lchars */
-            newline[j].cc_next = 0;
         }
 
         /*
@@ -6179,26 +7267,27 @@ static void do_paint(Terminal *term)
         laststart = 0;
         dirtyrect = false;
         for (j = 0; j < term->cols; j++) {
-            if (term->disptext[i]->chars[j].attr & DATTR_STARTRUN) {
+            termchar *dc = &term->disptext[i]->chars[j];
+
+            if (dc->dattr & (DATTR_STARTRUN >> DISP_TDATTR_SHIFT)) {
                 laststart = j;
                 dirtyrect = false;
             }
 
-            if (term->disptext[i]->chars[j].chr != newline[j].chr ||
-                (term->disptext[i]->chars[j].attr &~ DATTR_MASK)
-                != newline[j].attr) {
+            if (dc->chr != newline[j].chr ||
+                (disp_attr(term, dc) &~ DATTR_MASK) != newline[j].attr) {
                 int k;
 
                 if (!dirtyrect) {
                     for (k = laststart; k < j; k++)
-                        term->disptext[i]->chars[k].attr |= ATTR_INVALID;
+                        term->disptext[i]->chars[k].dattr |= DISP_INVALID;
 
                     dirtyrect = true;
                 }
             }
 
             if (dirtyrect)
-                term->disptext[i]->chars[j].attr |= ATTR_INVALID;
+                dc->dattr |= DISP_INVALID;
         }
 
         /*
@@ -6208,16 +7297,18 @@ static void do_paint(Terminal *term)
                                   term->disptext[i]->lattr);
         term->disptext[i]->lattr = ldata->lattr;
 
-        tc = term->erase_char.truecolour;
+        tc = cellattr(term, &term->erase_char)->truecolour;
         for (j = 0; j < term->cols; j++) {
-            unsigned long tattr, tchar;
+            unsigned long tattr, tchar, dattr;
             bool break_run, do_copy;
             termchar *d = lchars + j;
+            termchar *dc = &term->disptext[i]->chars[j];
 
             tattr = newline[j].attr;
             tchar = newline[j].chr;
+            dattr = disp_attr(term, dc);
 
-            if ((term->disptext[i]->chars[j].attr ^ tattr) & ATTR_WIDE)
+            if ((dattr ^ tattr) & ATTR_WIDE)
                 dirty_line = true;
 
             break_run = ((tattr ^ attr) & term->attr_mask) != 0;
@@ -6256,10 +7347,8 @@ static void do_paint(Terminal *term)
                 break_run = true;
 
             if (!term->ucsdata->dbcs_screenfont && !dirty_line) {
-                if (term->disptext[i]->chars[j].chr == tchar &&
-                    (term->disptext[i]->chars[j].attr &~ DATTR_MASK)==tattr &&
-                    truecolour_equal(
-                        term->disptext[i]->chars[j].truecolour, tc))
+                if (dc->chr == tchar && (dattr &~ DATTR_MASK) == tattr &&
+                    truecolour_equal(cellattr(term, dc)->truecolour, tc))
                     break_run = true;
                 else if (!dirty_run && ccount == 1)
                     break_run = true;
@@ -6279,8 +7368,7 @@ static void do_paint(Terminal *term)
             }
 
             do_copy = false;
-            if (!termchars_equal_override(&term->disptext[i]->chars[j],
-                                          d, tchar, tattr)) {
+            if (!termchars_equal_override(term, dc, d, tchar, tattr)) {
                 do_copy = true;
                 dirty_run = true;
             }
@@ -6332,11 +7420,12 @@ static void do_paint(Terminal *term)
 
             if (do_copy) {
                 copy_termchar(term->disptext[i], j, d);
-                term->disptext[i]->chars[j].chr = tchar;
-                term->disptext[i]->chars[j].attr = tattr;
-                term->disptext[i]->chars[j].truecolour = tc;
+                dc = &term->disptext[i]->chars[j];
+                dc->chr = tchar;
+                set_cellattr(term, dc, tattr &~ TDATTR_MASK, tc);
+                dc->dattr = (tattr & TDATTR_MASK) >> DISP_TDATTR_SHIFT;
                 if (start == j)
-                    term->disptext[i]->chars[j].attr |= DATTR_STARTRUN;
+                    dc->dattr |= DATTR_STARTRUN >> DISP_TDATTR_SHIFT;
             }
 
             /* If it's a wide char step along to the next one. */
@@ -6361,7 +7450,6 @@ static void do_paint(Terminal *term)
         unlineptr(ldata);
     }
 
-    sfree(newline);
     sfree(ch);
 }
 
@@ -6372,9 +7460,11 @@ void term_invalidate(Terminal *term)
 {
     int i, j;
 
-    for (i = 0; i < term->rows; i++)
+    for (i = 0; i < term->rows; i++) {
         for (j = 0; j < term->cols; j++)
-            term->disptext[i]->chars[j].attr |= ATTR_INVALID;
+            term->disptext[i]->chars[j].dattr |= DISP_INVALID;
+        term->dispsrc[i] = NULL;
+    }
 
     term_schedule_update(term);
 }
@@ -6392,12 +7482,13 @@ void term_paint(Terminal *term,
     if (bottom >= term->rows) bottom = term->rows-1;
 
     for (i = top; i <= bottom && i < term->rows; i++) {
+        term->dispsrc[i] = NULL;
         if ((term->disptext[i]->lattr & LATTR_MODE) == LATTR_NORM)
             for (j = left; j <= right && j < term->cols; j++)
-                term->disptext[i]->chars[j].attr |= ATTR_INVALID;
+                term->disptext[i]->chars[j].dattr |= DISP_INVALID;
         else
             for (j = left / 2; j <= right / 2 + 1 && j < term->cols; j++)
-                term->disptext[i]->chars[j].attr |= ATTR_INVALID;
+                term->disptext[i]->chars[j].dattr |= DISP_INVALID;
     }
 
     if (immediately) {
@@ -6452,9 +7543,139 @@ void term_scroll_to_selection(Terminal *term, int which_end)
     term_scroll(term, -1, y);
 }
 
+/*
+ * Look for 'text' in one line's linetext, starting at a character
+ * from column x onwards (or from x backwards). Returns the index of
+ * the match in lt->text, or -1.
+ */
+static int linetext_find(const linetext *lt, const wchar_t *text,
+                         size_t len, int x, bool backwards)
+{
+    if (lt->len < len)
+        return -1;
+
+    for (size_t n = 0; n <= lt->len - len; n++) {
+        size_t i = backwards ? lt->len - len - n : n;
+        if (backwards ? lt->xpos[i] > x : lt->xpos[i] < x)
+            continue;
+        if (!memcmp(lt->text + i, text, len * sizeof(wchar_t)))
+            return i;
+    }
+    return -1;
+}
+
+/*
+ * Search the scrollback and the screen for a string, and select the
+ * next occurrence, scrolling to it if it's out of view. Returns false
+ * if there isn't one.
+ *
+ * The search starts from the current selection if there is one, so
+ * that it can be extended a character at a time as the user types,
+ * and 'skip_current' moves on to the next match past the selection;
+ * otherwise it starts from the bottom of the screen (or the top of
+ * the scrollback, if searching forwards). Matches don't extend across
+ * line boundaries. Without 'match_case', ASCII letters are compared
+ * without regard to case.
+ *
+ * Lines that have made it into term->scrollback are only checked if
+ * its search index says they might match, which saves decompressing
+ * most of them.
+ */
+bool term_find(Terminal *term, const wchar_t *text, bool backwards,
+               bool match_case, bool skip_current)
+{
+    size_t len = wcslen(text);
+    if (!len)
+        return false;
+
+    wchar_t *folded = snewn(len, wchar_t);
+    for (size_t i = 0; i < len; i++)
+        folded[i] = (text[i] >= 'A' && text[i] <= 'Z' ?
+                     text[i] + ('a' - 'A') : text[i]);
+    const wchar_t *target = match_case ? text : folded;
+
+    /* Lines from sbtop up to sbend are in the indexed scrollback */
+    int sbtop = -sblines(term);
+    int sbend = sbtop + scrollback_count(term->scrollback);
+
+    pos p;
+    if (term->selstate == SELECTED) {
+        p = term->selstart;
+        if (skip_current)
+            p.x += backwards ? -1 : +1;
+    } else if (backwards) {
+        p.y = term->rows - 1;
+        p.x = term->cols;
+    } else {
+        p.y = sbtop;
+        p.x = 0;
+    }
+
+    linetext lt = { NULL, NULL, 0, 0 };
+    bool found = false;
+
+    while (p.y >= sbtop && p.y < term->rows) {
+        if (p.y < sbend) {
+            size_t i = scrollback_search(term->scrollback, folded, len,
+                                         p.y - sbtop, backwards);
+            if (i == SIZE_MAX) {
+                if (backwards)
+                    break;
+                p.y = sbend;
+                p.x = 0;
+                continue;
+            }
+            if (i != p.y - sbtop) {
+                p.y = sbtop + i;
+                p.x = backwards ? term->cols : 0;
+            }
+        }
+
+        termline *ldata = lineptr(p.y);
+        get_linetext(term, ldata, term->cols, &lt, !match_case);
+        int i = linetext_find(&lt, target, len, p.x, backwards);
+        if (i >= 0) {
+            int endx = lt.xpos[i + len - 1] + 1;
+            while (endx < term->cols && ldata->chars[endx].chr == UCSWIDE)
+                endx++;
+
+            term->selstate = SELECTED;
+            term->seltype = LEXICOGRAPHIC;
+            term->selmode = SM_CHAR;
+            term->selstart.y = term->selend.y = p.y;
+            term->selstart.x = lt.xpos[i];
+            term->selend.x = endx;
+            term->selanchor = term->selstart;
+            found = true;
+        }
+        unlineptr(ldata);
+        if (found)
+            break;
+
+        p.y += backwards ? -1 : +1;
+        p.x = backwards ? term->cols : 0;
+    }
+
+    sfree(lt.text);
+    sfree(lt.xpos);
+    sfree(folded);
+
+    if (found) {
+        if (p.y < term->disptop || p.y >= term->disptop + term->rows)
+            term_scroll_to_selection(term, 0);
+        term_schedule_update(term);
+    }
+    return found;
+}
+
 /*
  * Helper routine for clipme(): growing buffer.
+ *
+ * If 'flush' is set, the buffer is instead handed to it and emptied
+ * whenever it has accumulated CLIP_CHUNK characters, so that
+ * term_export_all() can stream out a selection of any size.
  */
+#define CLIP_CHUNK 16384
 typedef struct {
     size_t bufsize;         /* amount of allocated space in textbuf/attrbuf */
     size_t bufpos;          /* amount of actual data */
@@ -6464,8 +7685,31 @@ typedef struct {
     int *attrptr;           /* = attrbuf + bufpos */
     truecolour *tcbuf;      /* buffer for copied colours */
     truecolour *tcptr;      /* = tcbuf + bufpos */
+    term_export_fn_t flush;
+    void *flushctx;
 } clip_workbuf;
 
+static void clip_workbuf_init(clip_workbuf *b, size_t size)
+{
+    b->bufsize = size;
+    b->bufpos = 0;
+    b->textptr = b->textbuf = snewn(b->bufsize, wchar_t);
+    b->attrptr = b->attrbuf = snewn(b->bufsize, int);
+    b->tcptr = b->tcbuf = snewn(b->bufsize, truecolour);
+    b->flush = NULL;
+    b->flushctx = NULL;
+}
+
+static void clip_flush(clip_workbuf *b)
+{
+    if (b->bufpos)
+        b->flush(b->flushctx, b->textbuf, b->bufpos);
+    b->bufpos = 0;
+    b->textptr = b->textbuf;
+    b->attrptr = b->attrbuf;
+    b->tcptr = b->tcbuf;
+}
+
 static void clip_addchar(clip_workbuf *b, wchar_t chr, int attr, truecolour tc)
 {
     if (b->bufpos >= b->bufsize) {
@@ -6482,20 +7726,17 @@ static void clip_addchar(clip_workbuf *b, wchar_t chr, int attr, truecolour tc)
     b->bufpos++;
 }
 
-static void clipme(Terminal *term, pos top, pos bottom, bool rect, bool desel,
-                   const int *clipboards, int n_clipboards)
+/*
+ * Walk the text between 'top' and 'bottom', translating it into
+ * Unicode and appending it to 'buf'.
+ */
+static void clip_collect(Terminal *term, pos top, pos bottom, bool rect,
+                         clip_workbuf *b)
 {
-    clip_workbuf buf;
     int old_top_x;
     int attr;
     truecolour tc;
 
-    buf.bufsize = 5120;
-    buf.bufpos = 0;
-    buf.textptr = buf.textbuf = snewn(buf.bufsize, wchar_t);
-    buf.attrptr = buf.attrbuf = snewn(buf.bufsize, int);
-    buf.tcptr = buf.tcbuf = snewn(buf.bufsize, truecolour);
-
     old_top_x = top.x;                 /* needed for rect==1 */
 
     while (poslt(top, bottom)) {
@@ -6567,8 +7808,8 @@ static void clipme(Terminal *term, pos top, pos bottom, bool rect, bool desel,
 
             while (1) {
                 int uc = ldata->chars[x].chr;
-                attr = ldata->chars[x].attr;
-                tc = ldata->chars[x].truecolour;
+                attr = cellattr(term, &ldata->chars[x])->attr;
+                tc = cellattr(term, &ldata->chars[x])->truecolour;
 
                 switch (uc & CSET_MASK) {
                   case CSET_LINEDRW:
@@ -6629,7 +7870,7 @@ static void clipme(Terminal *term, pos top, pos bottom, bool rect, bool desel,
 #endif
 
                 for (p = cbuf; *p; p++)
-                    clip_addchar(&buf, *p, attr, tc);
+                    clip_addchar(b, *p, attr, tc);
 
                 if (ldata->chars[x].cc_next)
                     x += ldata->chars[x].cc_next;
@@ -6637,19 +7878,36 @@ static void clipme(Terminal *term, pos top, pos bottom, bool rect, bool desel,
                     break;
             }
             top.x++;
+
+            /* Only flush between cells, so that a chunk never ends in
+             * the middle of a surrogate pair or combining sequence. */
+            if (b->flush && b->bufpos >= CLIP_CHUNK)
+                clip_flush(b);
         }
         if (nl) {
             int i;
             for (i = 0; i < sel_nl_sz; i++)
-                clip_addchar(&buf, sel_nl[i], 0, term->basic_erase_char.truecolour);
+                clip_addchar(b, sel_nl[i], 0,
+                             cellattr(term, &term->basic_erase_char)
+                             ->truecolour);
         }
         top.y++;
         top.x = rect ? old_top_x : 0;
 
         unlineptr(ldata);
     }
+}
+
+static void clipme(Terminal *term, pos top, pos bottom, bool rect, bool desel,
+                   const int *clipboards, int n_clipboards)
+{
+    clip_workbuf buf;
+
+    clip_workbuf_init(&buf, 5120);
+    clip_collect(term, top, bottom, rect, &buf);
 #if SELECTION_NUL_TERMINATED
-    clip_addchar(&buf, 0, 0, term->basic_erase_char.truecolour);
+    clip_addchar(&buf, 0, 0,
+                 cellattr(term, &term->basic_erase_char)->truecolour);
 #endif
     /* Finally, transfer all that to the clipboard(s). */
     {
@@ -6684,7 +7942,7 @@ void term_copyall(Terminal *term, const int *clipboards, int n_clipboards)
 {
     pos top;
     pos bottom;
-    tree234 *screen = term->screen;
+    termscreen *screen = term->screen;
     top.y = -sblines(term);
     top.x = 0;
     bottom.y = find_last_nonempty_line(term, screen);
@@ -6692,6 +7950,34 @@ void term_copyall(Terminal *term, const int *clipboards, int n_clipboards)
     clipme(term, top, bottom, false, true, clipboards, n_clipboards);
 }
 
+/*
+ * Streaming version of term_copyall: rather than building the entire
+ * scrollback in memory and passing it to win_clip_write, hand it to
+ * 'fn' a chunk at a time. Each chunk ends on a character boundary.
+ */
+void term_export_all(Terminal *term, term_export_fn_t fn, void *ctx)
+{
+    pos top;
+    pos bottom;
+    termscreen *screen = term->screen;
+    clip_workbuf buf;
+
+    top.y = -sblines(term);
+    top.x = 0;
+    bottom.y = find_last_nonempty_line(term, screen);
+    bottom.x = term->cols;
+
+    clip_workbuf_init(&buf, CLIP_CHUNK + 256);
+    buf.flush = fn;
+    buf.flushctx = ctx;
+    clip_collect(term, top, bottom, false, &buf);
+    clip_flush(&buf);
+
+    sfree(buf.textbuf);
+    sfree(buf.attrbuf);
+    sfree(buf.tcbuf);
+}
+
 static void paste_from_clip_local(void *vterm)
 {
     Terminal *term = (Terminal *)vterm;
@@ -7148,9 +8434,9 @@ void term_mouse(Terminal *term, Mouse_Button braw, Mouse_Button bcooked,
      * Transform x through the bidi algorithm to find the _logical_
      * click point from the physical one.
      */
-    if (term_bidi_line(term, ldata, y) != NULL) {
-        x = term->post_bidi_cache[y].backward[x];
-    }
+    struct bidi_cache_entry *bidi = term_bidi_line(term, ldata);
+    if (bidi)
+        x = bidi->backward[x];
 
     selpoint.x = x;
     unlineptr(ldata);
@@ -7726,22 +9012,26 @@ void term_lost_clipboard_ownership(Terminal *term, int clipboard)
 static void term_added_data(Terminal *term, bool called_from_term_data)
 {
     if (!term->in_term_out) {
+        unsigned long start = GETTICKCOUNT();
         term->in_term_out = true;
         term_reset_cblink(term);
         term_out(term, called_from_term_data);
         term->in_term_out = false;
+        term->parse_ticks += GETTICKCOUNT() - start;
     }
 }
 
 size_t term_data(Terminal *term, const void *data, size_t len)
 {
     bufchain_add(&term->inbuf, data, len);
+    term->parse_bytes += len;
     term_added_data(term, true);
     return bufchain_size(&term->inbuf);
 }
 
 void term_provide_logctx(Terminal *term, LogContext *logctx)
 {
+    term_log_flush(term);
     term->logctx = logctx;
 }
 
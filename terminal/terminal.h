@@ -24,7 +24,10 @@ typedef struct {
 } pos;
 
 typedef struct termchar termchar;
+typedef struct termattr termattr;
 typedef struct termline termline;
+typedef struct termscreen termscreen;
+typedef struct scrollback scrollback;
 
 struct termchar {
     /*
@@ -32,9 +35,22 @@ struct termchar {
      * when extra fields are added here is labelled with a comment
      * saying FULL-TERMCHAR.
      */
-    unsigned long chr;
-    unsigned long attr;
-    truecolour truecolour;
+    uint32_t chr;
+
+    /*
+     * The attributes and true colour of the cell aren't stored in
+     * the cell itself, since a screenful of cells mostly share a few
+     * combinations of them. Instead, attr is an index into the
+     * terminal's table of the combinations in use (term->attrtab).
+     */
+    uint16_t attr;
+
+    /*
+     * Extra flags used only in term->disptext, recording how the
+     * cell was last drawn: the TDATTR_MASK bits of the attribute
+     * word, shifted down by DISP_TDATTR_SHIFT, and DISP_INVALID.
+     */
+    uint16_t dattr;
 
     /*
      * The cc_next field is used to link multiple termchars
@@ -50,6 +66,14 @@ struct termchar {
     int cc_next;
 };
 
+#define DISP_TDATTR_SHIFT 16
+#define DISP_INVALID 0x0001     /* must be redrawn, as if ATTR_INVALID */
+
+struct termattr {
+    unsigned long attr;
+    truecolour truecolour;
+};
+
 struct termline {
     unsigned short lattr;
     int cols;                          /* number of real columns on the line */
@@ -59,13 +83,93 @@ struct termline {
     int cc_free;                       /* offset to first cc in free list */
     struct termchar *chars;
     bool trusted;
+
+    /*
+     * The range of columns [damage_start,damage_end) which might
+     * have changed since do_paint last drew this line. Anything that
+     * modifies a cell widens it (normally by way of clear_cc), and
+     * do_paint empties it again.
+     */
+    int damage_start, damage_end;
 };
 
+/*
+ * The lines of the primary or alternate screen. They're kept in a
+ * circular array, so that scrolling the whole screen (which takes a
+ * line off the top and adds one at the bottom) only has to move the
+ * start index: line y of the screen is lines[(top + y) % size].
+ */
+struct termscreen {
+    termline **lines;
+    int size;                          /* allocated length of 'lines' */
+    int nlines;                        /* number of lines in use */
+    int top;                           /* index in 'lines' of line 0 */
+};
+
+static inline termline *termscreen_line(termscreen *s, int y)
+{
+    if (y < 0 || y >= s->nlines)
+        return NULL;
+    int i = s->top + y;
+    if (i >= s->size)
+        i -= s->size;
+    return s->lines[i];
+}
+
+static inline int termscreen_count(termscreen *s)
+{
+    return s->nlines;
+}
+
+/*
+ * The scrollback, in terminal/scrollback.c. It stores each line as an
+ * opaque string of bytes (the output of compressline() in
+ * terminal.c), packed in compressed blocks. The ptrlen returned by
+ * scrollback_get is only valid until the next call to any of these
+ * functions.
+ */
+scrollback *scrollback_new(void);
+void scrollback_free(scrollback *sb);
+/* Returns false if it was spilling, and now can't (see below) */
+bool scrollback_clear(scrollback *sb);
+size_t scrollback_count(scrollback *sb);
+size_t scrollback_memory(scrollback *sb);   /* in bytes, for termbench */
+void scrollback_append(scrollback *sb, ptrlen line);
+ptrlen scrollback_get(scrollback *sb, size_t index);
+void scrollback_delete_oldest(scrollback *sb);
+void scrollback_delete_newest(scrollback *sb);
+
+/*
+ * Keep only about 'memlines' of the newest lines of the scrollback in
+ * memory, and move older ones out to a spill file. Returns false if
+ * that can't be done (or memlines is 0), in which case everything
+ * stays in memory.
+ */
+bool scrollback_set_spill(scrollback *sb, size_t memlines);
+
+/*
+ * Search index. scrollback_index_text records the text of the line
+ * most recently appended, for the benefit of later searches.
+ *
+ * scrollback_search returns the nearest line index to 'index' (at or
+ * after it, or at or before it if 'backwards') that might contain
+ * 'text', or SIZE_MAX if none can. Lines it skips definitely don't
+ * contain it; the caller must check the ones it returns. Both
+ * functions see the text exactly as given, so the caller should fold
+ * case before passing it in if it wants case-insensitive matching.
+ */
+void scrollback_index_text(scrollback *sb, const wchar_t *text, size_t len);
+size_t scrollback_search(scrollback *sb, const wchar_t *text, size_t len,
+                         size_t index, bool backwards);
+
 struct bidi_cache_entry {
+    unsigned long hash;                /* of the line's contents */
     int width;
     bool trusted;
-    struct termchar *chars;
+    struct termchar *pre, *post;       /* the line before and after bidi */
     int *forward, *backward;           /* the permutations of line positions */
+    int hash_next;                     /* next entry in the same hash chain */
+    int lru_prev, lru_next;            /* neighbours in order of use */
 };
 
 struct term_utf8_decode {
@@ -78,9 +182,12 @@ struct terminal_tag {
 
     int compatibility_level;
 
-    tree234 *scrollback;               /* lines scrolled off top of screen */
-    tree234 *screen;                   /* lines on primary screen */
-    tree234 *alt_screen;               /* lines on alternate screen */
+    scrollback *scrollback;            /* lines scrolled off top of screen */
+    termscreen *sbstage;               /* newest scrollback lines, not yet
+                                          compressed into .scrollback */
+    bool sbstage_pending;              /* flush callback is queued */
+    termscreen *screen;                /* lines on primary screen */
+    termscreen *alt_screen;            /* lines on alternate screen */
     int disptop;                       /* distance scrolled back (0 or -ve) */
     int tempsblines;                   /* number of lines of .scrollback that
                                           can be retrieved onto the terminal
@@ -90,6 +197,26 @@ struct terminal_tag {
     int dispcursx, dispcursy;          /* location of cursor on real screen */
     int curstype;                      /* type of cursor on real screen */
 
+    /*
+     * What do_paint last drew on each row of disptext: the termline
+     * it came from (or NULL if the row must be redrawn from scratch),
+     * and the cells it computed for it, rows*cols of them. If a row's
+     * termline is the same one and undamaged, do_paint can skip the
+     * row entirely. paintstate records the rest of what the drawing
+     * depended on; if any of that changes, every row is redone.
+     */
+    termline **dispsrc;
+    struct paintchar *paintchars;
+    struct paintstate {
+        int disptop, rv;
+        bool selected;                 /* selstart etc only valid if so */
+        int seltype;
+        pos selstart, selend;
+        bool blink_is_real, blinked_off;
+        bool ansi_colour, xterm_256_colour, true_colour;
+        bool no_bidi, no_arabicshaping, rawcnp;
+    } paintstate;
+
 #define VBELL_TIMEOUT (TICKSPERSEC/10) /* visual bell lasts 1/10 sec */
 
     struct beeptime *beephead, *beeptail;
@@ -104,6 +231,22 @@ struct terminal_tag {
     truecolour curr_truecolour, save_truecolour;
     termchar basic_erase_char, erase_char;
 
+    /*
+     * The table of attribute and colour combinations that
+     * termchar.attr indexes, with a hash table for finding entries
+     * in it (each slot holds an index plus 1, or 0 if empty). Entries
+     * are never removed individually: instead, term_attr_gc()
+     * rebuilds the table from the cells that are still in use, when
+     * attr_gc_countdown reaches zero.
+     */
+    termattr *attrtab;
+    size_t nattrs, attrtabsize;
+    uint32_t *attrhash;
+    size_t attrhashsize;
+    size_t attr_gc_countdown;
+    termattr lastattr;                 /* the last lookup, to save time */
+    unsigned lastattr_index;
+
     bufchain inbuf;                    /* terminal input buffer */
 
     pos curs;                          /* cursor */
@@ -142,6 +285,8 @@ struct terminal_tag {
     int alt_save_sco_acs;
 
     int rows, cols, savelines;
+    int savelines_requested;           /* as passed to term_size */
+    bool spill_applied;                /* spill_scrollback as of term_size */
     bool has_focus;
     bool in_vbell;
     long vbell_end;
@@ -235,6 +380,14 @@ struct terminal_tag {
 
     LogContext *logctx;
 
+    /*
+     * Session log output accumulated during term_out, so that it can
+     * be passed to logtraffic_span in runs instead of byte by byte.
+     * Only bytes of the type we're actually logging are kept here.
+     */
+    unsigned char logbuf[4096];
+    size_t logbuf_len;
+
     struct unicode_data *ucsdata;
 
     unsigned long last_graphic_char;
@@ -271,6 +424,26 @@ struct terminal_tag {
     bool window_update_pending, window_update_cooldown;
     long window_update_cooldown_end;
 
+    /*
+     * The length of that cooldown period, if CONF_update_pacing is
+     * adaptive, stretches while output arrives faster than anyone
+     * could read it, so that less of our time goes on painting and
+     * more on working through the backlog. parse_bytes and
+     * parse_ticks count the data handed to us since the last update
+     * and the time term_out spent on it; paint_cost is a running
+     * average of the time an update takes, in sixteenths of a tick.
+     * flood_updates counts consecutive updates that found the
+     * terminal flooded. A keypress during a flood puts the delay
+     * straight back to normal, and sets key_update_pending so that
+     * the update showing its echo can skip the cooldown.
+     */
+    long update_delay;
+    unsigned long last_update_time;
+    unsigned long paint_cost, parse_ticks;
+    size_t parse_bytes;
+    int flood_updates;
+    bool key_update_pending;
+
     /*
      * Track pending blinks and tblinks.
      */
@@ -284,8 +457,26 @@ struct terminal_tag {
     int ltemp_size;
     bidi_char *wcFrom, *wcTo;
     int wcFromTo_size;
-    struct bidi_cache_entry *pre_bidi_cache, *post_bidi_cache;
-    size_t bidi_cache_size;
+
+    /*
+     * Cache of the results of the bidi algorithm, so that we don't
+     * run it more often than we have to. It's looked up by the
+     * contents of a line, not its position on the screen, so that a
+     * line can scroll without losing its entry. There's room for
+     * twice as many lines as the screen holds; the least recently
+     * used entry is thrown out when it's full. The entries are
+     * chained by index from bidi_cache_hash, which has
+     * bidi_cache_hashmask+1 slots, and kept in order of use from
+     * bidi_lru_head (most recent) to bidi_lru_tail.
+     */
+    struct bidi_cache_entry *bidi_cache;
+    int bidi_cache_size, bidi_cache_used;
+    int *bidi_cache_hash;
+    unsigned bidi_cache_hashmask;
+    int bidi_lru_head, bidi_lru_tail;
+#ifdef DEBUG
+    unsigned long bidi_cache_hits, bidi_cache_misses;
+#endif
 
     /*
      * Current trust state, used to annotate every line of the
@@ -339,6 +530,8 @@ struct terminal_tag {
     bool rxvt_homeend;
     bool scroll_on_disp;
     bool scroll_on_key;
+    bool spill_scrollback;
+    int update_pacing;
     bool xterm_256_colour;
     bool true_colour;
 
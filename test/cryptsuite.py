@@ -768,6 +768,9 @@ class ecc(MyTestBase):
         # Doubling a finite point
         check_point(ecc_weierstrass_add_general(wP, wP), rP + rP)
         check_point(ecc_weierstrass_add_general(wQ, wQ), rQ + rQ)
+        # Doubling a point whose Jacobian Z coordinate isn't 1
+        w2P = ecc_weierstrass_double(wP)
+        check_point(ecc_weierstrass_add_general(w2P, w2P), rP * 4)
         # Adding the identity to a point (both ways round)
         check_point(ecc_weierstrass_add_general(wI, wP), rP)
         check_point(ecc_weierstrass_add_general(wI, wQ), rQ)
@@ -915,6 +918,76 @@ class ecc(MyTestBase):
             rGi = curve25519.G * i
             self.assertEqual(int(x), int(rGi.x))
 
+    def testWeierstrassMultiplyBase(self):
+        wc = ecc_weierstrass_curve(p256.p, int(p256.a), int(p256.b), None)
+        wG = ecc_weierstrass_point_new(wc, int(p256.G.x), int(p256.G.y))
+        bt = ecc_weierstrass_base_table_new(wG, 256)
+
+        ints = set(i % p256.p for i in fibonacci_scattered(10))
+        ints.remove(0) # the zero multiple isn't expected to work
+        ints.add(1)
+        ints.add(0xffffffff00000000ffffffffffffffffbce6faada7179e84f3b9cac2fc632550)
+        for i in sorted(ints):
+            wGi = ecc_weierstrass_multiply_base(bt, i)
+            x, y = ecc_weierstrass_get_affine(wGi)
+            rGi = p256.G * i
+            self.assertEqual(int(x), int(rGi.x))
+            self.assertEqual(int(y), int(rGi.y))
+
+        # Multiplying by the order of G gives the identity
+        wGn = ecc_weierstrass_multiply_base(
+            bt, 0xffffffff00000000ffffffffffffffffbce6faada7179e84f3b9cac2fc632551)
+        self.assertTrue(ecc_weierstrass_is_identity(wGn))
+
+    def testEdwardsMultiplyBase(self):
+        ec = ecc_edwards_curve(ed25519.p, int(ed25519.d), int(ed25519.a), None)
+        eG = ecc_edwards_point_new(ec, int(ed25519.G.x), int(ed25519.G.y))
+        bt = ecc_edwards_base_table_new(eG, 256)
+
+        ints = set(i % ed25519.p for i in fibonacci_scattered(10))
+        ints.add(0)
+        ints.add(1)
+        ints.add((1 << 256) - 1)
+        for i in sorted(ints):
+            eGi = ecc_edwards_multiply_base(bt, i)
+            x, y = ecc_edwards_get_affine(eGi)
+            rGi = ed25519.G * i
+            self.assertEqual(int(x), int(rGi.x))
+            self.assertEqual(int(y), int(rGi.y))
+
+    def testX25519(self):
+        # The specialised Curve25519 code, checked against the
+        # reference implementation. x25519_scalarmult clamps its
+        # scalar, so use scalars that are already in clamped form.
+        def le(n):
+            return b"".join(struct.pack("B", (n >> (8*i)) & 0xFF)
+                            for i in range(32))
+        G = le(int(curve25519.G.x))
+        for i in sorted(set(fibonacci_scattered(10))):
+            k = (1 << 254) | ((i << 3) & ((1 << 254) - 1))
+            rGk = curve25519.G * k
+            self.assertEqualBin(x25519_scalarmult(le(k), G),
+                                le(int(rGk.x)))
+
+            # Non-canonical inputs: the top bit is ignored, and values
+            # at or above p are reduced.
+            self.assertEqualBin(
+                x25519_scalarmult(le(k), le(int(curve25519.G.x) + (1<<255))),
+                le(int(rGk.x)))
+            self.assertEqualBin(
+                x25519_scalarmult(le(k), le(int(curve25519.G.x) +
+                                            curve25519.p)),
+                le(int(rGk.x)))
+
+        # Iterated test from RFC 7748 section 5.2, for the first 1000
+        # iterations.
+        k = u = unhex('0900000000000000000000000000000000000000000000000000000000000000')
+        for i in range(1000):
+            k, u = x25519_scalarmult(k, u), k
+            if i == 0:
+                self.assertEqualBin(k, unhex('422c8e7a6227d7bca1350b3e2bb7279f7897b87bb6854b783c60e80311ae3079'))
+        self.assertEqualBin(k, unhex('684cf59ba83309552800ef566f2f4d3c1c3887c49360e3875f2eb94d99532c51'))
+
     def testEdwardsMultiply(self):
         ec = ecc_edwards_curve(ed25519.p, int(ed25519.d), int(ed25519.a), None)
         eG = ecc_edwards_point_new(ec, int(ed25519.G.x), int(ed25519.G.y))
@@ -1284,6 +1357,31 @@ class ntru(MyTestBase):
             [1,0,1,2,0,0,1,2,0,1,2], [2,0,0,1,0,1,2,2,2,0,2], 11, 3),
                          [1,0,0,0,0,0,0,0,0,0,0])
 
+    def testMultiplyLarge(self):
+        # At the real parameter sizes the multiplication is done
+        # recursively, so check it against a straightforward
+        # reference implementation, including inputs with every
+        # coefficient as large as possible.
+        def reference(a, b, p, q):
+            full = [0] * (2*p)
+            for i, ai in enumerate(a):
+                for j, bj in enumerate(b):
+                    full[i+j] += ai * bj
+            for i in range(2*p-1, p-1, -1):
+                full[i-p] += full[i]
+                full[i-p+1] += full[i]
+            return [c % q for c in full[:p]]
+
+        for p, q in [(761, 4591), (761, 3), (33, 4591), (97, 4591)]:
+            inputs = [
+                ([(i*i*17 + 3*i + 5) % q for i in range(p)],
+                 [(i*31 + 7) % q for i in range(p)]),
+                ([q-1] * p, [q-1] * p),
+            ]
+            for a, b in inputs:
+                self.assertEqual(ntru_ring_multiply(a, b, p, q),
+                                 reference(a, b, p, q))
+
     def testInvert(self):
         # Over GF(3), x^11-x-1 factorises as
         # (x^3+x^2+2) * (x^8+2*x^7+x^6+2*x^4+2*x^3+x^2+x+1)
@@ -1578,9 +1676,9 @@ class crypt(MyTestBase):
                     test(keylen, suffix, ivInteger)
 
     def testAESParallelism(self):
-        # Since at least one of our implementations of AES works in
-        # parallel, here's a test that CBC decryption works the same
-        # way no matter how the input data is divided up.
+        # Since some of our implementations of AES work in parallel,
+        # here's a test that CBC decryption and SDCTR encryption work
+        # the same way no matter how the input data is divided up.
 
         # A pile of conveniently available random-looking test data.
         test_ciphertext = ssh2_mpint(last(fibonacci_scattered(14)))
@@ -1608,6 +1706,31 @@ class crypt(MyTestBase):
             for d in decryptions:
                 self.assertEqualBin(d, decryptions[0])
 
+        # For SDCTR, use IVs that make the counter carry out of its
+        # low 64 bits part way through a multi-block batch.
+        test_ctr_ivs = [b"FOOBARBA" + b"\xff" * 6 + b"\xff\xfe",
+                        b"\xff" * 15 + b"\xfd"]
+
+        for keylen in [128, 192, 256]:
+            for iv in test_ctr_ivs:
+                encryptions = []
+
+                for suffix in get_aes_impls():
+                    c = ssh_cipher_new("aes{:d}_ctr_{}".format(
+                        keylen, suffix))
+                    if c is None: continue
+                    ssh_cipher_setkey(c, test_key[:keylen//8])
+                    for chunklen in range(16, 16*12, 16):
+                        ssh_cipher_setiv(c, iv)
+                        encryption = b""
+                        for pos in range(0, len(test_ciphertext), chunklen):
+                            chunk = test_ciphertext[pos:pos+chunklen]
+                            encryption += ssh_cipher_encrypt(c, chunk)
+                        encryptions.append(encryption)
+
+                for e in encryptions:
+                    self.assertEqualBin(e, encryptions[0])
+
     def testCRC32(self):
         # Check the effect of every possible single-byte input to
         # crc32_update. In the traditional implementation with a
@@ -1853,16 +1976,76 @@ class crypt(MyTestBase):
                       '3b8693642db36f87')
         mac = unhex('09757178642dfc9f2c38ac5999e0fcfd')
         seqno = 3
-        c = ssh_cipher_new('chacha20_poly1305')
-        m = ssh2_mac_new('poly1305', c)
-        c.setkey(key)
-        self.assertEqualBin(c.encrypt_length(len_p, seqno), len_c)
-        self.assertEqualBin(c.encrypt(msg_p), msg_c)
-        m.start()
-        m.update(ssh_uint32(seqno) + len_c + msg_c)
-        self.assertEqualBin(m.genresult(), mac)
-        self.assertEqualBin(c.decrypt_length(len_c, seqno), len_p)
-        self.assertEqualBin(c.decrypt(msg_c), msg_p)
+        for impl in get_implementations('chacha20_poly1305'):
+            c = ssh_cipher_new(impl)
+            if c is None: continue # skip if HW not available
+            m = ssh2_mac_new('poly1305', c)
+            c.setkey(key)
+            self.assertEqualBin(c.encrypt_length(len_p, seqno), len_c)
+            self.assertEqualBin(c.encrypt(msg_p), msg_c)
+            m.start()
+            m.update(ssh_uint32(seqno) + len_c + msg_c)
+            self.assertEqualBin(m.genresult(), mac)
+            self.assertEqualBin(c.decrypt_length(len_c, seqno), len_p)
+            self.assertEqualBin(c.decrypt(msg_c), msg_p)
+
+    def testChaCha20Parallelism(self):
+        # Some implementations of ChaCha20 generate several blocks of
+        # keystream at once, so check that they all agree with each
+        # other however the input is divided up, including chunks
+        # that don't end on a block boundary.
+        key = b"".join(struct.pack("B", i) for i in range(64))
+        data = b"".join(struct.pack("B", (i * 37 + 11) & 0xFF)
+                        for i in range(64 * 19 + 5))
+        seqno = 0x12345678
+
+        encryptions = []
+        for impl in get_implementations('chacha20_poly1305'):
+            c = ssh_cipher_new(impl)
+            if c is None: continue # skip if HW not available
+            c.setkey(key)
+            for chunklen in [1, 7, 16, 64, 100, 64*8, 64*9+3, len(data)]:
+                c.encrypt_length(b"\0\0\0\0", seqno)
+                encryption = b""
+                for pos in range(0, len(data), chunklen):
+                    encryption += c.encrypt(data[pos:pos+chunklen])
+                encryptions.append(encryption)
+
+        for e in encryptions:
+            self.assertEqualBin(e, encryptions[0])
+
+    def testPoly1305Parallelism(self):
+        # Likewise, some implementations absorb several blocks of
+        # Poly1305 input at once. Check their MACs against the
+        # one-block-at-a-time version for a range of message lengths
+        # and ways of dividing the input up, including all-0xFF data
+        # to push the accumulator limbs as high as they can go.
+        key = b"".join(struct.pack("B", (i * 73 + 5) & 0xFF)
+                       for i in range(64))
+        datas = [b"".join(struct.pack("B", (i * 37 + 11) & 0xFF)
+                          for i in range(16 * 41 + 9)),
+                 b"\xFF" * (16 * 41 + 9)]
+        seqno = 0x9abcdef0
+
+        macs = {}
+        for impl in get_implementations('chacha20_poly1305'):
+            c = ssh_cipher_new(impl)
+            if c is None: continue # skip if HW not available
+            m = ssh2_mac_new('poly1305', c)
+            c.setkey(key)
+            for d, data in enumerate(datas):
+                for length in [0, 15, 16, 64, 65, 256, 16*20+3, len(data)]:
+                    for chunklen in [1, 16, 17, 100, 300, length]:
+                        c.encrypt_length(b"\0\0\0\0", seqno)
+                        m.start()
+                        for pos in range(0, length, max(chunklen, 1)):
+                            m.update(data[pos:min(pos+chunklen, length)])
+                        macs.setdefault((d, length), []).append(
+                            m.genresult())
+
+        for results in macs.values():
+            for r in results:
+                self.assertEqualBin(r, results[0])
 
     def testRSAKex(self):
         # Round-trip test of the RSA key exchange functions, plus a
@@ -70,6 +70,8 @@ static void fuzz_draw_trust_sigil(TermWin *tw, int x, int y)
 {
     printf("TRUST@(%d,%d)\n", x, y);
 }
+static bool fuzz_scroll(TermWin *tw, int top, int bot, int lines)
+{ return false; }
 static int fuzz_char_width(TermWin *tw, int uc) { return 1; }
 static void fuzz_free_draw_ctx(TermWin *tw) {}
 static void fuzz_set_cursor_pos(TermWin *tw, int x, int y) {}
@@ -98,6 +100,7 @@ static const TermWinVtable fuzz_termwin_vt = {
     .draw_text = fuzz_draw_text,
     .draw_cursor = fuzz_draw_cursor,
     .draw_trust_sigil = fuzz_draw_trust_sigil,
+    .scroll = fuzz_scroll,
     .char_width = fuzz_char_width,
     .free_draw_ctx = fuzz_free_draw_ctx,
     .set_cursor_pos = fuzz_set_cursor_pos,
@@ -32,6 +32,7 @@ def list_hash_implementations(alg):
     list_implementations(alg, lambda impl: ssh_hash_new(impl) is not None)
 
 list_cipher_implementations("aes256_cbc")
+list_cipher_implementations("chacha20_poly1305")
 list_mac_implementations("aesgcm")
 list_hash_implementations("sha1")
 list_hash_implementations("sha256")
@@ -0,0 +1,657 @@
+/*
+ * termbench: measure the throughput of the terminal emulator.
+ *
+ * This drives the same headless Terminal that fuzzterm does, but
+ * with a TermWin that draws nothing, and it times things instead of
+ * printing them. Each stream of terminal output is fed to term_data
+ * in pty-sized chunks, with a window update forced every so often,
+ * and we report:
+ *
+ *  - how fast the output was parsed, in MB/s of input. This is the
+ *    total time spent minus the time spent painting.
+ *  - how many paints per second the terminal managed. This is timed
+ *    from setup_draw_ctx to free_draw_ctx, so it covers do_paint and
+ *    nothing else.
+ *  - the peak resident memory. Each stream runs in its own forked
+ *    process, so that this figure belongs to that stream alone.
+ *  - the memory used per character cell, at the end of the run: on
+ *    the screen, the termchars and the attribute table; in the
+ *    scrollback, its compressed blocks and search filters. These are
+ *    counted from the terminal's own data structures, so unlike the
+ *    peak figure they don't depend on the allocator.
+ *
+ * The built-in streams are synthetic, generated from a fixed seed so
+ * that runs are comparable: plain ASCII text, text with heavy SGR
+ * colouring, UTF-8 CJK text, full-screen curses-style redraws, and
+ * mixed-direction Hebrew and Arabic text. Any other command-line
+ * argument is taken as a file containing a recorded stream (say, the
+ * output of script(1)). Either way, the stream is replayed as many
+ * times as it takes to feed the terminal the amount of output asked
+ * for.
+ *
+ * The figures are only worth comparing between optimised builds
+ * (CMAKE_BUILD_TYPE=Release or similar) on the same machine.
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <unistd.h>
+#include <sys/resource.h>
+#include <sys/wait.h>
+
+#include "putty.h"
+#include "dialog.h"
+#include "terminal.h"
+
+#define CHUNK_SIZE 4096                /* bytes per call to term_data */
+#define CORPUS_SIZE 1000000            /* bytes of each stream to generate */
+
+typedef struct Bench {
+    Terminal *term;
+    double paint_time, paint_start;
+    unsigned long npaints;
+    TermWin tw;
+} Bench;
+
+static const TermWinVtable bench_termwin_vt;
+
+static double now_seconds(void)
+{
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec + ts.tv_nsec / 1e9;
+}
+
+/*
+ * Deterministic source of randomness for the stream generators.
+ */
+static uint32_t rng_state;
+static uint32_t rng(uint32_t limit)
+{
+    rng_state ^= rng_state << 13;
+    rng_state ^= rng_state >> 17;
+    rng_state ^= rng_state << 5;
+    return rng_state % limit;
+}
+
+static void put_utf8(strbuf *sb, unsigned long ch)
+{
+    char buf[6];
+    put_data(sb, buf, encode_utf8(buf, ch));
+}
+
+static void put_word(strbuf *sb)
+{
+    unsigned len = 1 + rng(10);
+    for (unsigned i = 0; i < len; i++)
+        put_byte(sb, 'a' + rng(26));
+}
+
+static void gen_ascii(strbuf *sb, size_t size, int cols, int rows)
+{
+    while (sb->len < size) {
+        /* Mostly short lines, with the odd one long enough to wrap */
+        unsigned words = rng(8) ? 1 + rng(12) : 20 + rng(30);
+        for (unsigned i = 0; i < words; i++) {
+            if (i)
+                put_byte(sb, ' ');
+            put_word(sb);
+        }
+        put_datalit(sb, "\r\n");
+    }
+}
+
+static void gen_sgr(strbuf *sb, size_t size, int cols, int rows)
+{
+    while (sb->len < size) {
+        unsigned words = 1 + rng(12);
+        for (unsigned i = 0; i < words; i++) {
+            switch (rng(6)) {
+              case 0:
+                put_fmt(sb, "\033[%um", 30 + rng(8));
+                break;
+              case 1:
+                put_fmt(sb, "\033[1;%u;%um", 90 + rng(8), 40 + rng(8));
+                break;
+              case 2:
+                put_fmt(sb, "\033[38;5;%um", rng(256));
+                break;
+              case 3:
+                put_fmt(sb, "\033[38;2;%u;%u;%u;48;2;%u;%u;%um",
+                        rng(256), rng(256), rng(256),
+                        rng(256), rng(256), rng(256));
+                break;
+              case 4:
+                put_fmt(sb, "\033[%um", rng(2) ? 4 : 7);
+                break;
+              case 5:
+                put_datalit(sb, "\033[0m");
+                break;
+            }
+            put_word(sb);
+            put_byte(sb, ' ');
+        }
+        put_datalit(sb, "\033[0m\r\n");
+    }
+}
+
+static void gen_cjk(strbuf *sb, size_t size, int cols, int rows)
+{
+    while (sb->len < size) {
+        unsigned chars = 1 + rng(cols);
+        for (unsigned i = 0; i < chars; i++) {
+            switch (rng(8)) {
+              case 0:
+                put_word(sb);
+                break;
+              case 1:
+                put_utf8(sb, 0x3041 + rng(0x56));  /* hiragana */
+                break;
+              case 2:
+                put_utf8(sb, 0xAC00 + rng(0x2BA4)); /* hangul */
+                break;
+              default:
+                put_utf8(sb, 0x4E00 + rng(0x5200)); /* ideographs */
+                break;
+            }
+        }
+        put_datalit(sb, "\r\n");
+    }
+}
+
+static void gen_curses(strbuf *sb, size_t size, int cols, int rows)
+{
+    unsigned frame = 0;
+
+    put_datalit(sb, "\033[?1049h\033[?25l");
+    while (sb->len < size) {
+        /*
+         * Every so often, clear and redraw a box around the screen,
+         * as a full-screen application does when it starts up or
+         * gets a resize. The rest of the time, just rewrite a table
+         * of changing figures inside it, as top(1) might.
+         */
+        if (frame % 50 == 0) {
+            put_datalit(sb, "\033[0m\033[H\033[2J\033(0");
+            put_byte(sb, 'l');
+            for (int x = 2; x < cols; x++)
+                put_byte(sb, 'q');
+            put_byte(sb, 'k');
+            for (int y = 2; y < rows; y++)
+                put_fmt(sb, "\033[%d;1Hx\033[%d;%dHx", y, y, cols);
+            put_fmt(sb, "\033[%d;1Hm", rows);
+            for (int x = 2; x < cols; x++)
+                put_byte(sb, 'q');
+            put_byte(sb, 'j');
+            put_datalit(sb, "\033(B");
+        }
+        put_fmt(sb, "\033[1;3H\033[7m frame %u \033[0m", frame);
+        for (int y = 3; y < rows - 1; y++) {
+            if (rng(3) == 0)
+                continue;
+            put_fmt(sb, "\033[%d;3H\033[%um%5u %5u.%u ", y,
+                    rng(4) ? 0 : 31 + rng(6), rng(100000),
+                    rng(1000), rng(10));
+            put_word(sb);
+            put_datalit(sb, "\033[K\033[0m");
+            put_fmt(sb, "\033[%d;%dHx", y, cols);
+        }
+        frame++;
+    }
+    put_datalit(sb, "\033[?25h\033[?1049l");
+}
+
+static void gen_bidi(strbuf *sb, size_t size, int cols, int rows)
+{
+    while (sb->len < size) {
+        unsigned words = 1 + rng(10);
+        for (unsigned i = 0; i < words; i++) {
+            unsigned len = 1 + rng(8);
+            if (i)
+                put_byte(sb, ' ');
+            switch (rng(4)) {
+              case 0:
+                put_word(sb);
+                break;
+              case 1:
+                put_fmt(sb, "%u", rng(100000));
+                break;
+              case 2:
+                for (unsigned j = 0; j < len; j++)
+                    put_utf8(sb, 0x05D0 + rng(27)); /* Hebrew */
+                break;
+              case 3:
+                for (unsigned j = 0; j < len; j++)
+                    put_utf8(sb, 0x0627 + rng(36)); /* Arabic */
+                break;
+            }
+        }
+        put_datalit(sb, "\r\n");
+    }
+}
+
+static const struct stream {
+    const char *name;
+    void (*gen)(strbuf *sb, size_t size, int cols, int rows);
+} streams[] = {
+    {"ascii", gen_ascii},
+    {"sgr", gen_sgr},
+    {"cjk", gen_cjk},
+    {"curses", gen_curses},
+    {"bidi", gen_bidi},
+};
+
+/*
+ * Load a stream from a file, or generate one of the built-in ones.
+ */
+static bool load_stream(strbuf *sb, const struct stream *stream,
+                        const char *filename, int cols, int rows)
+{
+    if (stream) {
+        rng_state = 0x9E3779B9;
+        stream->gen(sb, CORPUS_SIZE, cols, rows);
+    } else {
+        FILE *fp = fopen(filename, "rb");
+        char buf[65536];
+        size_t len;
+
+        if (!fp) {
+            fprintf(stderr, "unable to open '%s'\n", filename);
+            return false;
+        }
+        while ((len = fread(buf, 1, sizeof(buf), fp)) > 0)
+            put_data(sb, buf, len);
+        fclose(fp);
+        if (!sb->len) {
+            fprintf(stderr, "'%s' is empty\n", filename);
+            return false;
+        }
+    }
+    return true;
+}
+
+/*
+ * Memory per character cell. A screen cell costs its termchar, plus
+ * its share of the attribute table the termchars index into; a
+ * scrollback cell costs its share of the compressed scrollback,
+ * including any lines still waiting in sbstage to be added to it.
+ */
+static size_t termscreen_memory(termscreen *s)
+{
+    size_t total = s->size * sizeof(termline *);
+    for (int y = 0; y < s->nlines; y++) {
+        termline *line = termscreen_line(s, y);
+        total += sizeof(termline) + line->size * sizeof(termchar);
+    }
+    return total;
+}
+
+static double screen_bytes_per_cell(Terminal *term)
+{
+    size_t total = termscreen_memory(term->screen) +
+        term->attrtabsize * sizeof(termattr) +
+        term->attrhashsize * sizeof(uint32_t);
+    return (double)total / (term->rows * term->cols);
+}
+
+static double scrollback_bytes_per_cell(Terminal *term)
+{
+    size_t lines = scrollback_count(term->scrollback) +
+        termscreen_count(term->sbstage);
+    size_t total = scrollback_memory(term->scrollback) +
+        termscreen_memory(term->sbstage);
+    return lines ? (double)total / (lines * term->cols) : 0;
+}
+
+static bool run_bench(const struct stream *stream, const char *filename,
+                      size_t total, int cols, int rows, size_t paint_every)
+{
+    Bench bench[1];
+    Conf *conf;
+    struct unicode_data ucsdata;
+    struct rusage ru;
+    strbuf *sb = strbuf_new();
+    ptrlen data;
+    size_t done = 0, since_paint = 0;
+    double start, elapsed;
+
+    if (!load_stream(sb, stream, filename, cols, rows)) {
+        strbuf_free(sb);
+        return false;
+    }
+    data = ptrlen_from_strbuf(sb);
+
+    memset(bench, 0, sizeof(bench));
+    bench->tw.vt = &bench_termwin_vt;
+
+    conf = conf_new();
+    do_defaults(NULL, conf);
+    conf_set_str(conf, CONF_line_codepage, "UTF-8");
+    init_ucs(&ucsdata, conf_get_str(conf, CONF_line_codepage),
+             conf_get_bool(conf, CONF_utf8_override),
+             CS_NONE, conf_get_int(conf, CONF_vtmode));
+
+    bench->term = term_init(conf, &ucsdata, &bench->tw);
+    term_size(bench->term, rows, cols, conf_get_int(conf, CONF_savelines));
+    bench->term->ldisc = NULL;
+
+    start = now_seconds();
+    while (done < total) {
+        size_t offset = done % data.len;
+        size_t len = min(CHUNK_SIZE, data.len - offset);
+        len = min(len, total - done);
+        len = min(len, paint_every - since_paint);
+
+        term_data(bench->term, (const char *)data.ptr + offset, len);
+        while (run_toplevel_callbacks());
+        done += len;
+
+        since_paint += len;
+        if (since_paint >= paint_every) {
+            term_update(bench->term);
+            since_paint = 0;
+        }
+    }
+    term_update(bench->term);
+    elapsed = now_seconds() - start;
+
+    getrusage(RUSAGE_SELF, &ru);
+#ifdef __APPLE__
+    ru.ru_maxrss /= 1024;              /* macOS reports bytes, not KB */
+#endif
+
+    printf("%-16s %8.2f %12.2f %10lu %12.1f %10ld %12.2f %12.2f\n",
+           stream ? stream->name : filename, total / 1e6,
+           total / 1e6 / (elapsed - bench->paint_time), bench->npaints,
+           bench->npaints / bench->paint_time, (long)ru.ru_maxrss,
+           screen_bytes_per_cell(bench->term),
+           scrollback_bytes_per_cell(bench->term));
+    fflush(stdout);
+
+    term_free(bench->term);
+    conf_free(conf);
+    strbuf_free(sb);
+    return true;
+}
+
+static void run_bench_in_child(const struct stream *stream,
+                               const char *filename, size_t total,
+                               int cols, int rows, size_t paint_every)
+{
+    pid_t pid;
+
+    fflush(stdout);
+    pid = fork();
+    if (pid < 0) {
+        perror("fork");
+        exit(1);
+    } else if (pid == 0) {
+        exit(run_bench(stream, filename, total, cols, rows,
+                       paint_every) ? 0 : 1);
+    } else {
+        int status;
+        waitpid(pid, &status, 0);
+        if (!WIFEXITED(status) || WEXITSTATUS(status) != 0)
+            printf("%-16s failed\n", stream ? stream->name : filename);
+    }
+}
+
+int main(int argc, char **argv)
+{
+    bool doing_opts = true;
+    const char *pname = argv[0];
+    int cols = 80, rows = 24;
+    double megabytes = 16;
+    int paint_every = 65536;
+    bool stream_names_given = false;
+    bool streams_to_run[lenof(streams)];
+    const char **files = snewn(argc, const char *);
+    size_t nfiles = 0;
+
+    memset(streams_to_run, 0, sizeof(streams_to_run));
+
+    while (--argc > 0) {
+        char *p = *++argv;
+
+        if (p[0] == '-' && doing_opts) {
+            if (!strcmp(p, "-s")) {
+                if (--argc <= 0 || sscanf(*++argv, "%dx%d", &cols, &rows) != 2
+                    || cols < 1 || rows < 1) {
+                    fprintf(stderr, "'-s' expects a size such as 80x24\n");
+                    return 1;
+                }
+            } else if (!strcmp(p, "-n")) {
+                if (--argc <= 0 || (megabytes = atof(*++argv)) <= 0) {
+                    fprintf(stderr, "'-n' expects a number of megabytes\n");
+                    return 1;
+                }
+            } else if (!strcmp(p, "-p")) {
+                if (--argc <= 0 || (paint_every = atoi(*++argv)) <= 0) {
+                    fprintf(stderr, "'-p' expects a number of bytes\n");
+                    return 1;
+                }
+            } else if (!strcmp(p, "--")) {
+                doing_opts = false;
+            } else if (!strcmp(p, "--help")) {
+                printf("  usage: %s [options] [stream|file...]\n", pname);
+                printf("options: -s <cols>x<rows>      "
+                       "terminal size (default 80x24)\n");
+                printf("         -n <megabytes>        "
+                       "amount of output to feed per stream (default 16)\n");
+                printf("         -p <bytes>            "
+                       "output between window updates (default 65536)\n");
+                printf("   also: --help                "
+                       "display this text\n");
+                printf("streams:");
+                for (size_t i = 0; i < lenof(streams); i++)
+                    printf(" %s", streams[i].name);
+                printf(" (default: all)\n");
+                printf("  files: replay a recorded stream from a file\n");
+                return 0;
+            } else {
+                fprintf(stderr, "unknown command line option '%s'\n", p);
+                return 1;
+            }
+        } else {
+            bool found_one = false;
+            for (size_t i = 0; i < lenof(streams); i++) {
+                if (!strcmp(p, streams[i].name)) {
+                    streams_to_run[i] = true;
+                    found_one = true;
+                }
+            }
+            if (!found_one)
+                files[nfiles++] = p;
+            stream_names_given = true;
+        }
+    }
+
+    if (!stream_names_given)
+        memset(streams_to_run, 1, sizeof(streams_to_run));
+
+    size_t total = megabytes * 1e6;
+
+    printf("%-16s %8s %12s %10s %12s %10s %12s %12s\n", "stream", "MB",
+           "MB/s parsed", "paints", "paints/s", "peak KB",
+           "screen B/ch", "sb B/ch");
+
+    for (size_t i = 0; i < lenof(streams); i++)
+        if (streams_to_run[i])
+            run_bench_in_child(&streams[i], NULL, total,
+                               cols, rows, paint_every);
+    for (size_t i = 0; i < nfiles; i++)
+        run_bench_in_child(NULL, files[i], total, cols, rows, paint_every);
+
+    sfree(files);
+    return 0;
+}
+
+/* functions required by terminal.c */
+static bool bench_setup_draw_ctx(TermWin *tw)
+{
+    Bench *bench = container_of(tw, Bench, tw);
+    bench->paint_start = now_seconds();
+    return true;
+}
+static void bench_free_draw_ctx(TermWin *tw)
+{
+    Bench *bench = container_of(tw, Bench, tw);
+    bench->paint_time += now_seconds() - bench->paint_start;
+    bench->npaints++;
+}
+static void bench_draw_text(
+    TermWin *tw, int x, int y, wchar_t *text, int len,
+    unsigned long attr, int lattr, truecolour tc) {}
+static void bench_draw_cursor(
+    TermWin *tw, int x, int y, wchar_t *text, int len,
+    unsigned long attr, int lattr, truecolour tc) {}
+static void bench_draw_trust_sigil(TermWin *tw, int x, int y) {}
+static bool bench_scroll(TermWin *tw, int top, int bot, int lines)
+{ return true; }
+static int bench_char_width(TermWin *tw, int uc) { return 1; }
+static void bench_set_cursor_pos(TermWin *tw, int x, int y) {}
+static void bench_set_raw_mouse_mode(TermWin *tw, bool enable) {}
+static void bench_set_raw_mouse_mode_pointer(TermWin *tw, bool enable) {}
+static void bench_set_scrollbar(TermWin *tw, int total, int start, int page) {}
+static void bench_bell(TermWin *tw, int mode) {}
+static void bench_clip_write(
+    TermWin *tw, int clipboard, wchar_t *text, int *attrs,
+    truecolour *colours, int len, bool must_deselect) {}
+static void bench_clip_request_paste(TermWin *tw, int clipboard) {}
+static void bench_refresh(TermWin *tw) {}
+static void bench_request_resize(TermWin *tw, int w, int h)
+{
+    /* Keep the size we have, but don't leave the terminal waiting */
+    Bench *bench = container_of(tw, Bench, tw);
+    term_resize_request_completed(bench->term);
+}
+static void bench_set_title(TermWin *tw, const char *title, int codepage) {}
+static void bench_set_icon_title(TermWin *tw, const char *icontitle, int cp) {}
+static void bench_set_minimised(TermWin *tw, bool minimised) {}
+static void bench_set_maximised(TermWin *tw, bool maximised) {}
+static void bench_move(TermWin *tw, int x, int y) {}
+static void bench_set_zorder(TermWin *tw, bool top) {}
+static void bench_palette_set(TermWin *tw, unsigned start, unsigned ncolours,
+                              const rgb *colours) {}
+static void bench_palette_get_overrides(TermWin *tw, Terminal *term) {}
+static void bench_unthrottle(TermWin *tw, size_t size) {}
+
+static const TermWinVtable bench_termwin_vt = {
+    .setup_draw_ctx = bench_setup_draw_ctx,
+    .draw_text = bench_draw_text,
+    .draw_cursor = bench_draw_cursor,
+    .draw_trust_sigil = bench_draw_trust_sigil,
+    .scroll = bench_scroll,
+    .char_width = bench_char_width,
+    .free_draw_ctx = bench_free_draw_ctx,
+    .set_cursor_pos = bench_set_cursor_pos,
+    .set_raw_mouse_mode = bench_set_raw_mouse_mode,
+    .set_raw_mouse_mode_pointer = bench_set_raw_mouse_mode_pointer,
+    .set_scrollbar = bench_set_scrollbar,
+    .bell = bench_bell,
+    .clip_write = bench_clip_write,
+    .clip_request_paste = bench_clip_request_paste,
+    .refresh = bench_refresh,
+    .request_resize = bench_request_resize,
+    .set_title = bench_set_title,
+    .set_icon_title = bench_set_icon_title,
+    .set_minimised = bench_set_minimised,
+    .set_maximised = bench_set_maximised,
+    .move = bench_move,
+    .set_zorder = bench_set_zorder,
+    .palette_set = bench_palette_set,
+    .palette_get_overrides = bench_palette_get_overrides,
+    .unthrottle = bench_unthrottle,
+};
+
+void ldisc_send(Ldisc *ldisc, const void *buf, int len, bool interactive) {}
+void ldisc_echoedit_update(Ldisc *ldisc) {}
+bool ldisc_has_input_buffered(Ldisc *ldisc) { return false; }
+LdiscInputToken ldisc_get_input_token(Ldisc *ldisc)
+{ unreachable("This fake ldisc never has any buffered input"); }
+void ldisc_enable_prompt_callback(Ldisc *ldisc, prompts_t *p)
+{ unreachable("This fake ldisc should never be used for user/pass prompts"); }
+void modalfatalbox(const char *fmt, ...) { exit(1); }
+void nonfatal(const char *fmt, ...) { }
+
+/* needed by timing.c */
+void timer_change_notify(unsigned long next) { }
+
+/* needed by config.c */
+
+void dlg_radiobutton_set(dlgcontrol *ctrl, dlgparam *dp, int whichbutton) { }
+int dlg_radiobutton_get(dlgcontrol *ctrl, dlgparam *dp) { return 0; }
+void dlg_checkbox_set(dlgcontrol *ctrl, dlgparam *dp, bool checked) { }
+bool dlg_checkbox_get(dlgcontrol *ctrl, dlgparam *dp) { return false; }
+void dlg_editbox_set(dlgcontrol *ctrl, dlgparam *dp, char const *text) { }
+char *dlg_editbox_get(dlgcontrol *ctrl, dlgparam *dp)
+{ return dupstr("moo"); }
+void dlg_listbox_clear(dlgcontrol *ctrl, dlgparam *dp) { }
+void dlg_listbox_del(dlgcontrol *ctrl, dlgparam *dp, int index) { }
+void dlg_listbox_add(dlgcontrol *ctrl, dlgparam *dp, char const *text) { }
+void dlg_listbox_addwithid(dlgcontrol *ctrl, dlgparam *dp,
+                           char const *text, int id) { }
+int dlg_listbox_getid(dlgcontrol *ctrl, dlgparam *dp, int index)
+{ return 0; }
+int dlg_listbox_index(dlgcontrol *ctrl, dlgparam *dp) { return -1; }
+bool dlg_listbox_issel(dlgcontrol *ctrl, dlgparam *dp, int index)
+{ return false; }
+void dlg_listbox_select(dlgcontrol *ctrl, dlgparam *dp, int index) { }
+void dlg_text_set(dlgcontrol *ctrl, dlgparam *dp, char const *text) { }
+void dlg_filesel_set(dlgcontrol *ctrl, dlgparam *dp, Filename *fn) { }
+Filename *dlg_filesel_get(dlgcontrol *ctrl, dlgparam *dp) { return NULL; }
+void dlg_fontsel_set(dlgcontrol *ctrl, dlgparam *dp, FontSpec *fn) { }
+FontSpec *dlg_fontsel_get(dlgcontrol *ctrl, dlgparam *dp) { return NULL; }
+void dlg_update_start(dlgcontrol *ctrl, dlgparam *dp) { }
+void dlg_update_done(dlgcontrol *ctrl, dlgparam *dp) { }
+void dlg_set_focus(dlgcontrol *ctrl, dlgparam *dp) { }
+void dlg_label_change(dlgcontrol *ctrl, dlgparam *dp, char const *text) { }
+dlgcontrol *dlg_last_focused(dlgcontrol *ctrl, dlgparam *dp)
+{ return NULL; }
+void dlg_beep(dlgparam *dp) { }
+void dlg_error_msg(dlgparam *dp, const char *msg) { }
+void dlg_end(dlgparam *dp, int value) { }
+void dlg_coloursel_start(dlgcontrol *ctrl, dlgparam *dp,
+                         int r, int g, int b) { }
+bool dlg_coloursel_results(dlgcontrol *ctrl, dlgparam *dp,
+                           int *r, int *g, int *b) { return false; }
+void dlg_refresh(dlgcontrol *ctrl, dlgparam *dp) { }
+bool dlg_is_visible(dlgcontrol *ctrl, dlgparam *dp) { return false; }
+
+const int ngsslibs = 0;
+const char *const gsslibnames[0] = { };
+const struct keyvalwhere gsslibkeywords[0] = { };
+
+char *platform_default_s(const char *name)
+{
+    if (!strcmp(name, "TermType"))
+        return dupstr("xterm");
+    return NULL;
+}
+
+bool platform_default_b(const char *name, bool def)
+{
+    return def;
+}
+
+int platform_default_i(const char *name, int def)
+{
+    return def;
+}
+
+FontSpec *platform_default_fontspec(const char *name)
+{
+    return fontspec_new("");
+}
+
+Filename *platform_default_filename(const char *name)
+{
+    return filename_from_str("");
+}
+
+char *x_get_default(const char *key)
+{
+    return NULL;                       /* this is a stub */
+}
@@ -115,6 +115,10 @@ BEGIN_ENUM_TYPE(cipheralg)
     ENUM_VALUE("arcfour256", &ssh_arcfour256_ssh2)
     ENUM_VALUE("arcfour128", &ssh_arcfour128_ssh2)
     ENUM_VALUE("chacha20_poly1305", &ssh2_chacha20_poly1305)
+    ENUM_VALUE("chacha20_poly1305_sw", &ssh2_chacha20_poly1305_sw)
+#if HAVE_CHACHA20_AVX2
+    ENUM_VALUE("chacha20_poly1305_avx2", &ssh2_chacha20_poly1305_avx2)
+#endif
 END_ENUM_TYPE(cipheralg)
 
 BEGIN_ENUM_TYPE(dh_group)
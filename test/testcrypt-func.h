@@ -220,6 +220,10 @@ FUNC(val_wpoint, ecc_weierstrass_add, ARG(val_wpoint, P), ARG(val_wpoint, Q))
 FUNC(val_wpoint, ecc_weierstrass_double, ARG(val_wpoint, P))
 FUNC(val_wpoint, ecc_weierstrass_multiply, ARG(val_wpoint, B),
      ARG(val_mpint, n))
+FUNC(val_wbasetable, ecc_weierstrass_base_table_new, ARG(val_wpoint, B),
+     ARG(uint, nbits))
+FUNC(val_wpoint, ecc_weierstrass_multiply_base, ARG(val_wbasetable, bt),
+     ARG(val_mpint, n))
 FUNC(uint, ecc_weierstrass_is_identity, ARG(val_wpoint, P))
 /* The output pointers in get_affine all become extra output values */
 FUNC(void, ecc_weierstrass_get_affine, ARG(val_wpoint, P),
@@ -235,6 +239,8 @@ FUNC(val_mpoint, ecc_montgomery_double, ARG(val_mpoint, P))
 FUNC(val_mpoint, ecc_montgomery_multiply, ARG(val_mpoint, B), ARG(val_mpint, n))
 FUNC(void, ecc_montgomery_get_affine, ARG(val_mpoint, P), ARG(out_val_mpint, x))
 FUNC(boolean, ecc_montgomery_is_identity, ARG(val_mpoint, P))
+FUNC_WRAPPED(val_string, x25519_scalarmult, ARG(val_string_ptrlen, scalar),
+             ARG(val_string_ptrlen, point))
 FUNC(val_ecurve, ecc_edwards_curve, ARG(val_mpint, p), ARG(val_mpint, d),
      ARG(val_mpint, a), ARG(opt_val_mpint, nonsquare_mod_p))
 FUNC(val_epoint, ecc_edwards_point_new, ARG(val_ecurve, curve),
@@ -244,6 +250,10 @@ FUNC(val_epoint, ecc_edwards_point_new_from_y, ARG(val_ecurve, curve),
 FUNC(val_epoint, ecc_edwards_point_copy, ARG(val_epoint, orig))
 FUNC(val_epoint, ecc_edwards_add, ARG(val_epoint, P), ARG(val_epoint, Q))
 FUNC(val_epoint, ecc_edwards_multiply, ARG(val_epoint, B), ARG(val_mpint, n))
+FUNC(val_ebasetable, ecc_edwards_base_table_new, ARG(val_epoint, B),
+     ARG(uint, nbits))
+FUNC(val_epoint, ecc_edwards_multiply_base, ARG(val_ebasetable, bt),
+     ARG(val_mpint, n))
 FUNC(uint, ecc_edwards_eq, ARG(val_epoint, P), ARG(val_epoint, Q))
 FUNC(void, ecc_edwards_get_affine, ARG(val_epoint, P), ARG(out_val_mpint, x),
      ARG(out_val_mpint, y))
@@ -79,10 +79,13 @@ uint64_t prng_reseed_time_ms(void)
     X(monty, MontyContext *, monty_free(v))                             \
     X(wcurve, WeierstrassCurve *, ecc_weierstrass_curve_free(v))        \
     X(wpoint, WeierstrassPoint *, ecc_weierstrass_point_free(v))        \
+    X(wbasetable, WeierstrassBaseTable *,                               \
+      ecc_weierstrass_base_table_free(v))                               \
     X(mcurve, MontgomeryCurve *, ecc_montgomery_curve_free(v))          \
     X(mpoint, MontgomeryPoint *, ecc_montgomery_point_free(v))          \
     X(ecurve, EdwardsCurve *, ecc_edwards_curve_free(v))                \
     X(epoint, EdwardsPoint *, ecc_edwards_point_free(v))                \
+    X(ebasetable, EdwardsBaseTable *, ecc_edwards_base_table_free(v))   \
     X(hash, ssh_hash *, ssh_hash_free(v))                               \
     X(key, ssh_key *, ssh_key_free(v))                                  \
     X(cipher, ssh_cipher *, ssh_cipher_free(v))                         \
@@ -885,6 +888,15 @@ static RSAKey *rsa_new(void)
     return rsa;
 }
 
+strbuf *x25519_scalarmult_wrapper(ptrlen scalar, ptrlen point)
+{
+    if (scalar.len != 32 || point.len != 32)
+        fatal_error("x25519_scalarmult: needs exactly 32-byte inputs");
+    strbuf *sb = strbuf_new();
+    x25519_scalarmult(strbuf_append(sb, 32), scalar.ptr, point.ptr);
+    return sb;
+}
+
 strbuf *ecdh_key_getkey_wrapper(ecdh_key *ek, ptrlen remoteKey)
 {
     /* Fold the boolean return value in C into the string return value
@@ -1354,6 +1366,11 @@ strbuf *get_implementations_commasep(ptrlen alg)
 #endif
 #if HAVE_NEON_CRYPTO
         put_fmt(out, ",%.*s_neon", PTRLEN_PRINTF(alg));
+#endif
+    } else if (ptrlen_startswith(alg, PTRLEN_LITERAL("chacha20"), NULL)) {
+        put_fmt(out, ",%.*s_sw", PTRLEN_PRINTF(alg));
+#if HAVE_CHACHA20_AVX2
+        put_fmt(out, ",%.*s_avx2", PTRLEN_PRINTF(alg));
 #endif
     } else if (ptrlen_startswith(alg, PTRLEN_LITERAL("sha512"), NULL)) {
         put_fmt(out, ",%.*s_sw", PTRLEN_PRINTF(alg));
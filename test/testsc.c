@@ -265,6 +265,12 @@ VOLATILE_WRAPPED_DEFN(static, size_t, looplimit, (size_t x))
 #define IF_CLMUL(x)
 #endif
 
+#if HAVE_CHACHA20_AVX2
+#define IF_CHACHA20_AVX2(x) x
+#else
+#define IF_CHACHA20_AVX2(x)
+#endif
+
 #if HAVE_NEON_CRYPTO
 #define IF_NEON_CRYPTO(x) x
 #else
@@ -328,6 +334,8 @@ VOLATILE_WRAPPED_DEFN(static, size_t, looplimit, (size_t x))
     IF_NEON_CRYPTO(X(Y, ssh_aes128_gcm_neon))   \
     IF_NEON_CRYPTO(X(Y, ssh_aes128_cbc_neon))   \
     X(Y, ssh2_chacha20_poly1305)                \
+    X(Y, ssh2_chacha20_poly1305_sw)             \
+    IF_CHACHA20_AVX2(X(Y, ssh2_chacha20_poly1305_avx2)) \
     /* end of list */
 
 #define CIPHER_TESTLIST(X, name) X(cipher_ ## name)
@@ -412,6 +420,7 @@ VOLATILE_WRAPPED_DEFN(static, size_t, looplimit, (size_t x))
     X(ecc_weierstrass_double)                   \
     X(ecc_weierstrass_add_general)              \
     X(ecc_weierstrass_multiply)                 \
+    X(ecc_weierstrass_multiply_base)            \
     X(ecc_weierstrass_is_identity)              \
     X(ecc_weierstrass_get_affine)               \
     X(ecc_weierstrass_decompress)               \
@@ -419,8 +428,10 @@ VOLATILE_WRAPPED_DEFN(static, size_t, looplimit, (size_t x))
     X(ecc_montgomery_double)                    \
     X(ecc_montgomery_multiply)                  \
     X(ecc_montgomery_get_affine)                \
+    X(x25519_scalarmult)                        \
     X(ecc_edwards_add)                          \
     X(ecc_edwards_multiply)                     \
+    X(ecc_edwards_multiply_base)                \
     X(ecc_edwards_eq)                           \
     X(ecc_edwards_get_affine)                   \
     X(ecc_edwards_decompress)                   \
@@ -946,6 +957,28 @@ static void test_ecc_weierstrass_multiply(void)
     mp_free(exponent);
 }
 
+static void test_ecc_weierstrass_multiply_base(void)
+{
+    WeierstrassCurve *wc = wcurve();
+    WeierstrassPoint *B = wpoint(wc, 1);
+    mp_int *exponent = mp_new(56);
+    WeierstrassBaseTable *bt = ecc_weierstrass_base_table_new(
+        B, mp_max_bits(exponent));
+    for (size_t i = 0; i < looplimit(5); i++) {
+        mp_random_fill(exponent);
+
+        log_start();
+        WeierstrassPoint *r = ecc_weierstrass_multiply_base(bt, exponent);
+        log_end();
+
+        ecc_weierstrass_point_free(r);
+    }
+    ecc_weierstrass_base_table_free(bt);
+    ecc_weierstrass_point_free(B);
+    ecc_weierstrass_curve_free(wc);
+    mp_free(exponent);
+}
+
 static void test_ecc_weierstrass_is_identity(void)
 {
     WeierstrassCurve *wc = wcurve();
@@ -1175,6 +1208,19 @@ static void test_ecc_montgomery_get_affine(void)
     ecc_montgomery_curve_free(wc);
 }
 
+static void test_x25519_scalarmult(void)
+{
+    unsigned char scalar[32], point[32], out[32];
+    for (size_t i = 0; i < looplimit(5); i++) {
+        random_read(scalar, sizeof(scalar));
+        random_read(point, sizeof(point));
+
+        log_start();
+        x25519_scalarmult(out, scalar, point);
+        log_end();
+    }
+}
+
 static EdwardsCurve *ecurve(void)
 {
     mp_int *p = MP_LITERAL(0xfce2dac1704095de0b5c48876c45063cd475);
@@ -1278,6 +1324,28 @@ static void test_ecc_edwards_multiply(void)
     mp_free(exponent);
 }
 
+static void test_ecc_edwards_multiply_base(void)
+{
+    EdwardsCurve *ec = ecurve();
+    EdwardsPoint *B = epoint(ec, 1);
+    mp_int *exponent = mp_new(56);
+    EdwardsBaseTable *bt = ecc_edwards_base_table_new(
+        B, mp_max_bits(exponent));
+    for (size_t i = 0; i < looplimit(5); i++) {
+        mp_random_fill(exponent);
+
+        log_start();
+        EdwardsPoint *r = ecc_edwards_multiply_base(bt, exponent);
+        log_end();
+
+        ecc_edwards_point_free(r);
+    }
+    ecc_edwards_base_table_free(bt);
+    ecc_edwards_point_free(B);
+    ecc_edwards_curve_free(ec);
+    mp_free(exponent);
+}
+
 static void test_ecc_edwards_eq(void)
 {
     EdwardsCurve *ec = ecurve();
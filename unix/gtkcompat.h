@@ -193,10 +193,12 @@
 #if GTK_CHECK_VERSION(3,0,0)
 #define STANDARD_OK_LABEL "_OK"
 #define STANDARD_OPEN_LABEL "_Open"
+#define STANDARD_SAVE_LABEL "_Save"
 #define STANDARD_CANCEL_LABEL "_Cancel"
 #else
 #define STANDARD_OK_LABEL GTK_STOCK_OK
 #define STANDARD_OPEN_LABEL GTK_STOCK_OPEN
+#define STANDARD_SAVE_LABEL GTK_STOCK_SAVE
 #define STANDARD_CANCEL_LABEL GTK_STOCK_CANCEL
 #endif
 
@@ -22,8 +22,6 @@
 
 #define MAX_STDIN_BACKLOG 4096
 
-static LogContext *logctx;
-
 static struct termios orig_termios;
 
 void cmdline_error(const char *fmt, ...)
@@ -938,7 +936,7 @@ int main(int argc, char **argv)
     /*
      * Start up the connection.
      */
-    logctx = log_init(console_cli_logpolicy, conf);
+    console_logctx = log_init(console_cli_logpolicy, conf);
     {
         char *error, *realhost;
         /* nodelay is only useful if stdin is a terminal device */
@@ -949,7 +947,7 @@ int main(int argc, char **argv)
         __AFL_INIT();
 #endif
 
-        error = backend_init(backvt, plink_seat, &backend, logctx, conf,
+        error = backend_init(backvt, plink_seat, &backend, console_logctx, conf,
                              conf_get_str(conf, CONF_host),
                              conf_get_int(conf, CONF_port),
                              &realhost, nodelay,
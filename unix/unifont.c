@@ -1349,6 +1349,18 @@ struct pangofont {
      */
     int *widthcache;
     unsigned nwidthcache;
+#ifdef DRAW_TEXT_CAIRO
+    /*
+     * Glyph caches for the Cairo drawing path, indexed by [bold][wide]
+     * and created on first use. glyphcache_serial is the serial number
+     * of the Pango context they were made under; no_glyphcache is set
+     * if we've found that under that context, glyphs can't be cached
+     * without losing rendering quality.
+     */
+    struct pangofont_glyphcache *glyphcache[2][2];
+    guint glyphcache_serial;
+    bool no_glyphcache;
+#endif
 
     struct unifont u;
 };
@@ -1484,6 +1496,11 @@ static unifont *pangofont_create_internal(GtkWidget *widget,
     pfont->shadowalways = shadowalways;
     pfont->widthcache = NULL;
     pfont->nwidthcache = 0;
+#ifdef DRAW_TEXT_CAIRO
+    memset(pfont->glyphcache, 0, sizeof(pfont->glyphcache));
+    pfont->glyphcache_serial = 0;
+    pfont->no_glyphcache = false;
+#endif
 
     pango_font_metrics_unref(metrics);
 
@@ -1533,11 +1550,18 @@ static unifont *pangofont_create_fallback(GtkWidget *widget, int height,
                                      shadowoffset, shadowalways);
 }
 
+#ifdef DRAW_TEXT_CAIRO
+static void pangofont_glyphcache_flush(struct pangofont *pfont);
+#endif
+
 static void pangofont_destroy(unifont *font)
 {
     struct pangofont *pfont = container_of(font, struct pangofont, u);
     pango_font_description_free(pfont->desc);
     sfree(pfont->widthcache);
+#ifdef DRAW_TEXT_CAIRO
+    pangofont_glyphcache_flush(pfont);
+#endif
     g_object_unref(pfont->fset);
     sfree(pfont);
 }
@@ -1592,6 +1616,281 @@ static void pango_cairo_draw_layout(unifont_drawctx *ctx,
     cairo_move_to(ctx->u.cairo.cr, x, y);
     pango_cairo_show_layout(ctx->u.cairo.cr, layout);
 }
+
+/*
+ * Glyph cache for the Cairo drawing path.
+ *
+ * Nearly everything a terminal draws is a run of ordinary characters
+ * each centred in its own cell, and laying out and shaping those
+ * through Pango again on every redraw dominates the cost of a
+ * full-screen update. So once we've rendered a character, we keep
+ * the result, much as x11font does with the glyph bitmaps it fetches
+ * from the server: each character is rendered once into its own
+ * small alpha-only Cairo surface (created similar to the draw
+ * target, so that it lives wherever the target does), and drawing it
+ * again is one cairo_mask_surface() through the current source
+ * colour. Each surface has some padding round the character cell,
+ * so that glyphs which overhang their cell slightly are kept intact.
+ *
+ * The cache is indexed by Unicode code point through a two-level
+ * table of 256-entry pages, allocated as characters from each page
+ * turn up, so that a stray character from a high plane costs one
+ * page and not an entry for every code point below it. Since the
+ * other end of the connection chooses which characters we see, the
+ * cache is also limited in how many pages and rendered glyphs it can
+ * hold, and we simply empty it and start again when it fills up.
+ *
+ * Glyphs cached in an alpha-only surface can only be greyscale
+ * antialiased, so if Pango would be doing subpixel antialiasing, we
+ * do without the cache. What's cached, and that decision, depend on
+ * the widget's Pango context, so if that changes (say, the font
+ * options or resolution of the screen), we throw the cache away and
+ * decide again.
+ */
+#define PANGO_GLYPHCACHE_MAX_GLYPHS 2048
+#define PANGO_GLYPHCACHE_MAX_PAGES 256
+
+struct pangofont_glyph {
+    bool rendered;                 /* false if not looked at yet */
+    cairo_surface_t *surface;      /* NULL if the character is blank */
+};
+
+struct pangofont_glyphcache {
+    int cellwidth;                 /* cell width the glyphs were sized for */
+    int padx, pady, slotw, sloth;
+    struct pangofont_glyph **pages;    /* by code point / 256, or NULL */
+    unsigned npages;
+    int npagesused, nglyphs;
+};
+
+static void pangofont_glyphcache_empty(struct pangofont_glyphcache *gc)
+{
+    unsigned i;
+    int j;
+
+    for (i = 0; i < gc->npages; i++) {
+        if (gc->pages[i]) {
+            for (j = 0; j < 256; j++)
+                if (gc->pages[i][j].surface)
+                    cairo_surface_destroy(gc->pages[i][j].surface);
+            sfree(gc->pages[i]);
+            gc->pages[i] = NULL;
+        }
+    }
+    gc->npagesused = gc->nglyphs = 0;
+}
+
+static void pangofont_glyphcache_free(struct pangofont_glyphcache *gc)
+{
+    if (gc) {
+        pangofont_glyphcache_empty(gc);
+        sfree(gc->pages);
+        sfree(gc);
+    }
+}
+
+static void pangofont_glyphcache_flush(struct pangofont *pfont)
+{
+    int bold, wide;
+    for (bold = 0; bold < 2; bold++) {
+        for (wide = 0; wide < 2; wide++) {
+            pangofont_glyphcache_free(pfont->glyphcache[bold][wide]);
+            pfont->glyphcache[bold][wide] = NULL;
+        }
+    }
+}
+
+static bool pangofont_glyphcache_loses_quality(unifont_drawctx *ctx,
+                                               struct pangofont *pfont)
+{
+    /*
+     * The options in effect are the target surface's, with those of
+     * the Pango context overriding them, which is the same way
+     * pangocairo combines them.
+     */
+    PangoContext *pctx = gtk_widget_get_pango_context(pfont->widget);
+    const cairo_font_options_t *ctxopts =
+        pango_cairo_context_get_font_options(pctx);
+    cairo_font_options_t *opts = cairo_font_options_create();
+    bool subpixel;
+
+    cairo_surface_get_font_options(cairo_get_target(ctx->u.cairo.cr), opts);
+    if (ctxopts)
+        cairo_font_options_merge(opts, ctxopts);
+    subpixel = (cairo_font_options_get_antialias(opts) ==
+                CAIRO_ANTIALIAS_SUBPIXEL);
+    cairo_font_options_destroy(opts);
+
+    return subpixel;
+}
+
+static struct pangofont_glyphcache *pangofont_get_glyphcache(
+    unifont_drawctx *ctx, struct pangofont *pfont, bool bold, bool wide,
+    int cellwidth)
+{
+    struct pangofont_glyphcache *gc;
+    cairo_matrix_t matrix;
+
+    /*
+     * The cache holds glyphs at one pixel per unit, so it's only any
+     * use if we're drawing without a scaling transformation. That
+     * rules out text on double-width or double-height lines, and also
+     * drawing on a HiDPI display (where the front end scales its
+     * Cairo context to match); in both cases, leave it to Pango, which
+     * will scale the outlines rather than a bitmap.
+     */
+    cairo_get_matrix(ctx->u.cairo.cr, &matrix);
+    if (matrix.xx != 1 || matrix.yy != 1 || matrix.xy != 0 || matrix.yx != 0)
+        return NULL;
+
+#if PANGO_VERSION_CHECK(1,32,4)
+    {
+        guint serial = pango_context_get_serial(
+            gtk_widget_get_pango_context(pfont->widget));
+        if (serial != pfont->glyphcache_serial) {
+            pangofont_glyphcache_flush(pfont);
+            pfont->glyphcache_serial = serial;
+            pfont->no_glyphcache = false;
+        }
+    }
+#endif
+
+    gc = pfont->glyphcache[bold][wide];
+    if (gc && gc->cellwidth != cellwidth) {
+        /* The character cell has changed size under us, so start again */
+        pangofont_glyphcache_free(gc);
+        gc = pfont->glyphcache[bold][wide] = NULL;
+    }
+
+    if (!gc) {
+        if (pfont->no_glyphcache)
+            return NULL;
+        if (pangofont_glyphcache_loses_quality(ctx, pfont)) {
+            pfont->no_glyphcache = true;
+            return NULL;
+        }
+
+        gc = snew(struct pangofont_glyphcache);
+        gc->cellwidth = cellwidth;
+        gc->padx = cellwidth / 2;
+        gc->pady = pfont->u.height / 4;
+        gc->slotw = cellwidth + 2 * gc->padx;
+        gc->sloth = pfont->u.height + 2 * gc->pady;
+        gc->pages = NULL;
+        gc->npages = 0;
+        gc->npagesused = gc->nglyphs = 0;
+        pfont->glyphcache[bold][wide] = gc;
+    }
+
+    return gc;
+}
+
+static cairo_surface_t *pangofont_glyphcache_lookup(
+    unifont_drawctx *ctx, struct pangofont *pfont,
+    struct pangofont_glyphcache *gc, PangoLayout *layout, wchar_t uchr)
+{
+    unsigned pageno = (unsigned)uchr >> 8;
+    struct pangofont_glyph *g;
+
+    if (pageno >= gc->npages) {
+        unsigned newsize = pageno + 1;
+        gc->pages = sresize(gc->pages, newsize, struct pangofont_glyph *);
+        while (gc->npages < newsize)
+            gc->pages[gc->npages++] = NULL;
+    }
+
+    if (!gc->pages[pageno]) {
+        if (gc->npagesused == PANGO_GLYPHCACHE_MAX_PAGES)
+            pangofont_glyphcache_empty(gc);
+        gc->pages[pageno] = snewn(256, struct pangofont_glyph);
+        memset(gc->pages[pageno], 0, 256 * sizeof(struct pangofont_glyph));
+        gc->npagesused++;
+    }
+
+    g = &gc->pages[pageno][uchr & 0xFF];
+    if (!g->rendered) {
+        PangoRectangle ink, logical;
+        cairo_t *cr;
+        char utfchr[7];
+        int utflen;
+
+        if (gc->nglyphs == PANGO_GLYPHCACHE_MAX_GLYPHS) {
+            pangofont_glyphcache_empty(gc);
+            return pangofont_glyphcache_lookup(ctx, pfont, gc, layout, uchr);
+        }
+
+        /*
+         * Render the character exactly where pangofont_draw_internal
+         * would have put it relative to its cell.
+         */
+        utflen = wc_to_mb(CS_UTF8, 0, &uchr, 1, utfchr, sizeof(utfchr), ".");
+        pango_layout_set_text(layout, utfchr, utflen);
+        pango_layout_get_pixel_extents(layout, &ink, &logical);
+
+        g->rendered = true;
+        g->surface = NULL;
+        gc->nglyphs++;
+        if (ink.width > 0 && ink.height > 0) {
+            g->surface = cairo_surface_create_similar(
+                cairo_get_target(ctx->u.cairo.cr), CAIRO_CONTENT_ALPHA,
+                gc->slotw, gc->sloth);
+            cr = cairo_create(g->surface);
+            cairo_move_to(cr, gc->padx + (gc->cellwidth - logical.width)/2,
+                          gc->pady + (pfont->u.height - logical.height)/2);
+            pango_cairo_show_layout(cr, layout);
+            cairo_destroy(cr);
+        }
+    }
+
+    return g->surface;
+}
+
+/*
+ * Try to draw a run of n ordinary cell-sized characters from the
+ * glyph cache. Returns false if the cache can't be used here, in
+ * which case the caller must draw them through Pango as usual.
+ */
+static bool pangofont_glyphcache_draw(unifont_drawctx *ctx,
+                                      struct pangofont *pfont,
+                                      PangoLayout *layout,
+                                      int x, int y, const wchar_t *string,
+                                      int n, bool bold, bool wide,
+                                      int cellwidth, bool shadowbold)
+{
+    struct pangofont_glyphcache *gc;
+    cairo_t *cr = ctx->u.cairo.cr;
+    int i;
+
+    if (ctx->type != DRAWTYPE_CAIRO)
+        return false;
+    gc = pangofont_get_glyphcache(ctx, pfont, bold, wide, cellwidth);
+    if (!gc)
+        return false;
+
+    for (i = 0; i < n; i++) {
+        cairo_surface_t *surface = pangofont_glyphcache_lookup(
+            ctx, pfont, gc, layout, string[i]);
+        if (surface) {
+            cairo_mask_surface(cr, surface, x - gc->padx, y - gc->pady);
+            if (shadowbold)
+                cairo_mask_surface(cr, surface, x - gc->padx +
+                                   pfont->shadowoffset, y - gc->pady);
+        }
+        x += cellwidth;
+    }
+
+    return true;
+}
+#else
+static bool pangofont_glyphcache_draw(unifont_drawctx *ctx,
+                                      struct pangofont *pfont,
+                                      PangoLayout *layout,
+                                      int x, int y, const wchar_t *string,
+                                      int n, bool bold, bool wide,
+                                      int cellwidth, bool shadowbold)
+{
+    return false;
+}
 #endif
 
 static void pangofont_draw_internal(unifont_drawctx *ctx, unifont *font,
@@ -1649,6 +1948,7 @@ static void pangofont_draw_internal(unifont_drawctx *ctx, unifont *font,
     while (utflen > 0) {
         int clen, n;
         int desired = cellwidth * PANGO_SCALE;
+        bool cellsized = false;
 
         /*
          * We want to display every character from this string in
@@ -1708,6 +2008,7 @@ static void pangofont_draw_internal(unifont_drawctx *ctx, unifont *font,
                  * in which we're using a monospaced font and everything
                  * works as expected.
                  */
+                cellsized = true;
                 while (clen < utflen) {
                     int oldclen = clen;
                     clen++;                    /* skip UTF-8 introducer byte */
@@ -1728,16 +2029,22 @@ static void pangofont_draw_internal(unifont_drawctx *ctx, unifont *font,
             }
         }
 
-        pango_layout_set_text(layout, utfptr, clen);
-        pango_layout_get_pixel_extents(layout, NULL, &rect);
+        if (cellsized &&
+            pangofont_glyphcache_draw(ctx, pfont, layout, x, y, string, n,
+                                      bold, wide, cellwidth, shadowbold)) {
+            /* Drawn from cached glyphs, without asking Pango at all */
+        } else {
+            pango_layout_set_text(layout, utfptr, clen);
+            pango_layout_get_pixel_extents(layout, NULL, &rect);
 
-        draw_layout(ctx,
-                    x + (n*cellwidth - rect.width)/2,
-                    y + (pfont->u.height - rect.height)/2, layout);
-        if (shadowbold)
             draw_layout(ctx,
-                        x + (n*cellwidth - rect.width)/2 + pfont->shadowoffset,
+                        x + (n*cellwidth - rect.width)/2,
                         y + (pfont->u.height - rect.height)/2, layout);
+            if (shadowbold)
+                draw_layout(ctx, x + (n*cellwidth - rect.width)/2 +
+                            pfont->shadowoffset,
+                            y + (pfont->u.height - rect.height)/2, layout);
+        }
 
         utflen -= clen;
         utfptr += clen;
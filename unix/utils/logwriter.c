@@ -0,0 +1,370 @@
+/*
+ * Unix implementation of the background log file writer, using a
+ * POSIX thread to do the stdio calls.
+ */
+
+#include <stdio.h>
+#include <pthread.h>
+
+#include "putty.h"
+
+struct LogWriter {
+    FILE *fp;
+    size_t queue_limit;
+    bool drop_when_full;
+
+    pthread_t thread;
+    pthread_mutex_t mutex;
+    pthread_cond_t data_ready;         /* signalled by the main thread */
+    pthread_cond_t space_ready;        /* signalled by the writer thread */
+
+    /* Everything below is protected by 'mutex' */
+    bufchain queue;
+    bool flush_wanted, stopping, failed;
+    bool dropping;       /* discarding data until the queue drains */
+};
+
+static void *logwriter_thread(void *vctx)
+{
+    LogWriter *lw = (LogWriter *)vctx;
+
+    pthread_mutex_lock(&lw->mutex);
+    while (true) {
+        if (bufchain_size(&lw->queue) > 0) {
+            /*
+             * The main thread only ever appends to the queue, so the
+             * data at the head stays put while we write it without
+             * holding the lock.
+             */
+            ptrlen data = bufchain_prefix(&lw->queue);
+            pthread_mutex_unlock(&lw->mutex);
+            bool ok = (fwrite(data.ptr, 1, data.len, lw->fp) == data.len);
+            pthread_mutex_lock(&lw->mutex);
+
+            bufchain_consume(&lw->queue, data.len);
+            if (!ok) {
+                lw->failed = true;
+                bufchain_clear(&lw->queue);
+            }
+            pthread_cond_signal(&lw->space_ready);
+        } else if (lw->flush_wanted) {
+            lw->flush_wanted = false;
+            pthread_mutex_unlock(&lw->mutex);
+            bool ok = (fflush(lw->fp) == 0);
+            pthread_mutex_lock(&lw->mutex);
+
+            if (!ok)
+                lw->failed = true;
+        } else if (lw->stopping) {
+            break;
+        } else {
+            pthread_cond_wait(&lw->data_ready, &lw->mutex);
+        }
+    }
+    pthread_mutex_unlock(&lw->mutex);
+
+    return NULL;
+}
+
+LogWriter *logwriter_new(FILE *fp, size_t queue_limit, bool drop_when_full)
+{
+    LogWriter *lw = snew(LogWriter);
+    lw->fp = fp;
+    lw->queue_limit = queue_limit;
+    lw->drop_when_full = drop_when_full;
+    bufchain_init(&lw->queue);
+    lw->flush_wanted = lw->stopping = lw->failed = lw->dropping = false;
+
+    pthread_mutex_init(&lw->mutex, NULL);
+    pthread_cond_init(&lw->data_ready, NULL);
+    pthread_cond_init(&lw->space_ready, NULL);
+
+    if (pthread_create(&lw->thread, NULL, logwriter_thread, lw) != 0) {
+        pthread_cond_destroy(&lw->space_ready);
+        pthread_cond_destroy(&lw->data_ready);
+        pthread_mutex_destroy(&lw->mutex);
+        sfree(lw);
+        return NULL;
+    }
+
+    return lw;
+}
+
+LogWriterStatus logwriter_write(LogWriter *lw, ptrlen data)
+{
+    LogWriterStatus status = LW_QUEUED;
+
+    pthread_mutex_lock(&lw->mutex);
+    /*
+     * Once we've started discarding data, carry on until the queue is
+     * down to half the limit, so that a writer which is only just too
+     * slow doesn't make us alternate between the two on every call.
+     */
+    if (lw->dropping && bufchain_size(&lw->queue) <= lw->queue_limit / 2)
+        lw->dropping = false;
+    /*
+     * A chunk bigger than the whole limit is still accepted once the
+     * queue is empty, or else it could never be written at all.
+     */
+    while (!lw->failed && (lw->dropping || (
+               bufchain_size(&lw->queue) > 0 &&
+               bufchain_size(&lw->queue) + data.len > lw->queue_limit))) {
+        if (lw->drop_when_full) {
+            lw->dropping = true;
+            status = LW_DROPPED;
+            break;
+        }
+        pthread_cond_wait(&lw->space_ready, &lw->mutex);
+    }
+    if (lw->failed) {
+        status = LW_FAILED;
+    } else if (status == LW_QUEUED) {
+        bufchain_add(&lw->queue, data.ptr, data.len);
+        pthread_cond_signal(&lw->data_ready);
+    }
+    pthread_mutex_unlock(&lw->mutex);
+
+    return status;
+}
+
+void logwriter_flush(LogWriter *lw)
+{
+    pthread_mutex_lock(&lw->mutex);
+    lw->flush_wanted = true;
+    pthread_cond_signal(&lw->data_ready);
+    pthread_mutex_unlock(&lw->mutex);
+}
+
+void logwriter_free(LogWriter *lw)
+{
+    pthread_mutex_lock(&lw->mutex);
+    lw->stopping = true;
+    pthread_cond_signal(&lw->data_ready);
+    pthread_mutex_unlock(&lw->mutex);
+
+    pthread_join(lw->thread, NULL);
+
+    bufchain_clear(&lw->queue);
+    pthread_cond_destroy(&lw->space_ready);
+    pthread_cond_destroy(&lw->data_ready);
+    pthread_mutex_destroy(&lw->mutex);
+    sfree(lw);
+}
+
+#ifdef TEST
+
+#include <string.h>
+#include <unistd.h>
+
+void out_of_memory(void) { fprintf(stderr, "out of memory\n"); abort(); }
+
+static int fails, passes;
+
+/*
+ * Each chunk of test data says which chunk it is, so that anything
+ * lost, duplicated or reordered on the way through shows up when the
+ * output is compared against what was successfully queued.
+ */
+static ptrlen make_chunk(char *buf, size_t bufsize, unsigned n, size_t len)
+{
+    assert(len <= bufsize && len >= 10);
+    sprintf(buf, "%08x:", n);
+    for (size_t i = 9; i < len - 1; i++)
+        buf[i] = 'a' + (n + i) % 26;
+    buf[len - 1] = '\n';
+    return make_ptrlen(buf, len);
+}
+
+static void check_output(const char *name, strbuf *got, strbuf *expected)
+{
+    if (!ptrlen_eq_ptrlen(ptrlen_from_strbuf(got),
+                          ptrlen_from_strbuf(expected))) {
+        printf("%s: output differs (%zu bytes written, %zu expected)\n",
+               name, got->len, expected->len);
+        fails++;
+    } else {
+        passes++;
+    }
+}
+
+static strbuf *read_all(FILE *fp)
+{
+    strbuf *sb = strbuf_new();
+    char buf[4096];
+    size_t len;
+    while ((len = fread(buf, 1, sizeof(buf), fp)) > 0)
+        put_data(sb, buf, len);
+    return sb;
+}
+
+/*
+ * With a queue limit far smaller than the data, the main thread keeps
+ * waiting for the writer thread to catch up. Nothing may be dropped.
+ */
+static void test_block(void)
+{
+    FILE *fp = tmpfile();
+    if (!fp) {
+        printf("block: tmpfile failed\n");
+        fails++;
+        return;
+    }
+
+    LogWriter *lw = logwriter_new(fp, 64, false);
+    strbuf *expected = strbuf_new();
+    char buf[256];
+    bool all_queued = true;
+
+    for (unsigned n = 0; n < 20000; n++) {
+        /* Include chunks bigger than the limit, which must still go */
+        ptrlen chunk = make_chunk(buf, sizeof(buf), n, 10 + n % 200);
+        if (logwriter_write(lw, chunk) != LW_QUEUED)
+            all_queued = false;
+        put_datapl(expected, chunk);
+        if (n % 1000 == 0)
+            logwriter_flush(lw);
+    }
+    logwriter_free(lw);
+
+    if (!all_queued) {
+        printf("block: a write was not queued\n");
+        fails++;
+    } else {
+        passes++;
+    }
+
+    rewind(fp);
+    strbuf *got = read_all(fp);
+    check_output("block", got, expected);
+    strbuf_free(got);
+    strbuf_free(expected);
+    fclose(fp);
+}
+
+struct pipe_reader {
+    FILE *fp;
+    strbuf *data;
+};
+
+static void *pipe_reader_thread(void *vctx)
+{
+    struct pipe_reader *pr = (struct pipe_reader *)vctx;
+    pr->data = read_all(pr->fp);
+    return NULL;
+}
+
+/*
+ * Stall the writer thread on a pipe nobody is reading yet, so that
+ * the queue fills up and the main thread has to start dropping data.
+ * Once the pipe is drained, the output must be exactly the chunks
+ * that were reported as queued.
+ */
+static void test_drop(void)
+{
+    int fds[2];
+    if (pipe(fds) < 0) {
+        printf("drop: pipe failed\n");
+        fails++;
+        return;
+    }
+    FILE *wfp = fdopen(fds[1], "w");
+    struct pipe_reader pr = { .fp = fdopen(fds[0], "r") };
+    assert(wfp && pr.fp);
+
+    LogWriter *lw = logwriter_new(wfp, 1024, true);
+    strbuf *expected = strbuf_new();
+    char buf[64];
+    unsigned n, ndropped = 0;
+
+    /* Far more than any pipe and stdio buffer can hold */
+    for (n = 0; n < 1000000 && ndropped < 100; n++) {
+        ptrlen chunk = make_chunk(buf, sizeof(buf), n, sizeof(buf));
+        LogWriterStatus status = logwriter_write(lw, chunk);
+        if (status == LW_QUEUED)
+            put_datapl(expected, chunk);
+        else if (status == LW_DROPPED)
+            ndropped++;
+    }
+
+    pthread_t reader;
+    pthread_create(&reader, NULL, pipe_reader_thread, &pr);
+
+    /* Once the reader has caught up, writes are accepted again */
+    unsigned first_after = n;
+    bool all_queued = true;
+    for (unsigned i = 0; i < 1000; i++, n++) {
+        ptrlen chunk = make_chunk(buf, sizeof(buf), n, sizeof(buf));
+        LogWriterStatus status;
+        while ((status = logwriter_write(lw, chunk)) == LW_DROPPED)
+            usleep(1000);
+        if (status == LW_QUEUED)
+            put_datapl(expected, chunk);
+        else
+            all_queued = false;
+    }
+
+    logwriter_free(lw);
+    fclose(wfp);
+    pthread_join(reader, NULL);
+
+    if (ndropped == 0) {
+        printf("drop: nothing was dropped after %u writes\n", first_after);
+        fails++;
+    } else if (!all_queued) {
+        printf("drop: write failed after the pipe was drained\n");
+        fails++;
+    } else {
+        passes++;
+    }
+
+    check_output("drop", pr.data, expected);
+    strbuf_free(pr.data);
+    strbuf_free(expected);
+    fclose(pr.fp);
+}
+
+/*
+ * A write error on the writer thread is reported back from later
+ * calls on the main thread.
+ */
+static void test_failure(void)
+{
+    FILE *fp = fopen("/dev/full", "w");
+    if (!fp) {
+        printf("failure: /dev/full not available, skipping\n");
+        return;
+    }
+
+    LogWriter *lw = logwriter_new(fp, 4096, false);
+    char buf[256];
+    bool failed = false;
+
+    for (unsigned n = 0; n < 100000 && !failed; n++) {
+        ptrlen chunk = make_chunk(buf, sizeof(buf), n, sizeof(buf));
+        if (logwriter_write(lw, chunk) == LW_FAILED)
+            failed = true;
+        else if (n % 16 == 0)
+            logwriter_flush(lw);
+    }
+    logwriter_free(lw);
+    fclose(fp);
+
+    if (!failed) {
+        printf("failure: write error was never reported\n");
+        fails++;
+    } else {
+        passes++;
+    }
+}
+
+int main(void)
+{
+    test_block();
+    test_drop();
+    test_failure();
+
+    printf("passed %d, failed %d\n", passes, fails);
+    return fails != 0;
+}
+
+#endif /* TEST */
@@ -0,0 +1,107 @@
+/*
+ * Unix implementation of the terminal's scrollback spill file: an
+ * unlinked temporary file, appended to with write() and read back
+ * through an mmap of whichever part of it was last asked for.
+ */
+
+#include <stdlib.h>
+#include <unistd.h>
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+
+#include "putty.h"
+
+/* Minimum size of the region we map at once */
+#define SPILL_MAP_SIZE (1 << 20)
+
+struct SpillFile {
+    int fd;
+    uint64_t size;                     /* amount written so far */
+
+    void *map;                         /* current mapping, or NULL */
+    uint64_t mapstart, maplen;
+};
+
+SpillFile *spillfile_new(void)
+{
+    const char *tmpdir = getenv("TMPDIR");
+    if (!tmpdir || !*tmpdir)
+        tmpdir = "/tmp";
+
+    char *filename = dupcat(tmpdir, "/putty-scrollback-XXXXXX");
+    int oldumask = umask(077);
+    int fd = mkstemp(filename);
+    umask(oldumask);
+    if (fd >= 0)
+        unlink(filename);
+    sfree(filename);
+    if (fd < 0)
+        return NULL;
+    cloexec(fd);
+
+    SpillFile *sf = snew(SpillFile);
+    sf->fd = fd;
+    sf->size = 0;
+    sf->map = NULL;
+    sf->mapstart = sf->maplen = 0;
+    return sf;
+}
+
+uint64_t spillfile_append(SpillFile *sf, ptrlen data)
+{
+    uint64_t offset = sf->size;
+    const char *p = data.ptr;
+    size_t len = data.len;
+
+    while (len > 0) {
+        ssize_t ret = pwrite(sf->fd, p, len, sf->size);
+        if (ret <= 0) {
+            /* Anything half-written will be overwritten next time */
+            sf->size = offset;
+            return SPILLFILE_FAILED;
+        }
+        p += ret;
+        len -= ret;
+        sf->size += ret;
+    }
+
+    return offset;
+}
+
+ptrlen spillfile_read(SpillFile *sf, uint64_t offset, size_t len)
+{
+    assert(offset + len <= sf->size);
+
+    if (!sf->map || offset < sf->mapstart ||
+        offset + len > sf->mapstart + sf->maplen) {
+        if (sf->map)
+            munmap(sf->map, sf->maplen);
+
+        uint64_t pagesize = sysconf(_SC_PAGESIZE);
+        uint64_t start = offset - offset % pagesize;
+        uint64_t maplen = offset + len - start;
+        if (maplen < SPILL_MAP_SIZE)
+            maplen = SPILL_MAP_SIZE;
+        if (maplen > sf->size - start)
+            maplen = sf->size - start;
+
+        sf->map = mmap(NULL, maplen, PROT_READ, MAP_SHARED, sf->fd, start);
+        if (sf->map == MAP_FAILED) {
+            sf->map = NULL;
+            return make_ptrlen(NULL, 0);
+        }
+        sf->mapstart = start;
+        sf->maplen = maplen;
+    }
+
+    return make_ptrlen((const char *)sf->map + (offset - sf->mapstart), len);
+}
+
+void spillfile_free(SpillFile *sf)
+{
+    if (sf->map)
+        munmap(sf->map, sf->maplen);
+    close(sf->fd);
+    sfree(sf);
+}
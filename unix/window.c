@@ -51,6 +51,22 @@ static GdkAtom clipboard_atom
 #endif
     ;
 
+/*
+ * Text offered on a clipboard, in each format we can provide it in.
+ * Copy All can put the whole scrollback on more than one clipboard at
+ * once, so this is reference-counted, and the clipboards share one
+ * copy of it rather than each having their own.
+ */
+struct clipdata {
+    int refcount;
+    char *utf8;
+    int utf8_len;
+#ifndef JUST_USE_GTK_CLIPBOARD_UTF8
+    char *ctext, *mb;
+    int ctext_len, mb_len;
+#endif
+};
+
 #ifdef JUST_USE_GTK_CLIPBOARD_UTF8
 /*
  * Because calling gtk_clipboard_set_with_data triggers a call to the
@@ -62,8 +78,7 @@ static GdkAtom clipboard_atom
  * to 'inst', to one of these.
  */
 struct clipboard_data_instance {
-    char *pasteout_data_utf8;
-    int pasteout_data_utf8_len;
+    struct clipdata *cd;
     struct clipboard_state *state;
     struct clipboard_data_instance *next, *prev;
 };
@@ -77,8 +92,7 @@ struct clipboard_state {
     GtkClipboard *gtkclipboard;
     struct clipboard_data_instance *current_cdi;
 #else
-    char *pasteout_data, *pasteout_data_ctext, *pasteout_data_utf8;
-    int pasteout_data_len, pasteout_data_ctext_len, pasteout_data_utf8_len;
+    struct clipdata *pasteout;         /* NULL if we have nothing to offer */
 #endif
 };
 
@@ -2785,6 +2799,24 @@ static struct clipboard_state *clipboard_from_atom(
     return NULL;
 }
 
+static struct clipdata *clipdata_ref(struct clipdata *cd)
+{
+    cd->refcount++;
+    return cd;
+}
+
+static void clipdata_unref(struct clipdata *cd)
+{
+    if (cd && --cd->refcount == 0) {
+        sfree(cd->utf8);
+#ifndef JUST_USE_GTK_CLIPBOARD_UTF8
+        sfree(cd->ctext);
+        sfree(cd->mb);
+#endif
+        sfree(cd);
+    }
+}
+
 #ifdef JUST_USE_GTK_CLIPBOARD_UTF8
 
 /* ----------------------------------------------------------------------
@@ -2826,8 +2858,8 @@ static void clipboard_provide_data(GtkClipboard *clipboard,
         (struct clipboard_data_instance *)data;
 
     if (cdi->state && cdi->state->current_cdi == cdi) {
-        gtk_selection_data_set_text(selection_data, cdi->pasteout_data_utf8,
-                                    cdi->pasteout_data_utf8_len);
+        gtk_selection_data_set_text(selection_data, cdi->cd->utf8,
+                                    cdi->cd->utf8_len);
     }
 }
 
@@ -2843,47 +2875,47 @@ static void clipboard_clear(GtkClipboard *clipboard, gpointer data)
         }
         cdi->state->current_cdi = NULL;
     }
-    sfree(cdi->pasteout_data_utf8);
+    clipdata_unref(cdi->cd);
     cdi->next->prev = cdi->prev;
     cdi->prev->next = cdi->next;
     sfree(cdi);
 }
 
-static void gtkwin_clip_write(
-    TermWin *tw, int clipboard, wchar_t *data, int *attr,
-    truecolour *truecolour, int len, bool must_deselect)
+/*
+ * Make a clipdata offering the given UTF-8 text. The text buffer
+ * becomes its property.
+ */
+static struct clipdata *clipdata_new(char *utf8, int utf8_len)
+{
+    struct clipdata *cd = snew(struct clipdata);
+    cd->refcount = 1;
+    cd->utf8 = utf8;
+    cd->utf8_len = utf8_len;
+    return cd;
+}
+
+/*
+ * Take ownership of a clipboard, offering it the text in a clipdata.
+ * The clipboard keeps its own reference to it.
+ */
+static void clip_write_converted(
+    GtkFrontend *inst, int clipboard, struct clipdata *cd,
+    bool must_deselect)
 {
-    GtkFrontend *inst = container_of(tw, GtkFrontend, termwin);
     struct clipboard_state *state = &inst->clipstates[clipboard];
     struct clipboard_data_instance *cdi;
 
-    if (inst->direct_to_font) {
-        /* In this clipboard mode, we just can't paste if we're in
-         * direct-to-font mode. Fortunately, that shouldn't be
-         * important, because we'll only use this clipboard handling
-         * code on systems where that kind of font doesn't exist
-         * anyway. */
-        return;
-    }
-
     if (!state->gtkclipboard)
         return;
 
     cdi = snew(struct clipboard_data_instance);
     cdi->state = state;
     state->current_cdi = cdi;
-    cdi->pasteout_data_utf8 = snewn(len*6, char);
+    cdi->cd = clipdata_ref(cd);
     cdi->prev = inst->cdi_headtail.prev;
     cdi->next = &inst->cdi_headtail;
     cdi->next->prev = cdi;
     cdi->prev->next = cdi;
-    {
-        const wchar_t *tmp = data;
-        int tmplen = len;
-        cdi->pasteout_data_utf8_len =
-            charset_from_unicode(&tmp, &tmplen, cdi->pasteout_data_utf8,
-                                 len*6, CS_UTF8, NULL, NULL, 0);
-    }
 
     /*
      * It would be nice to just call gtk_clipboard_set_text() in place
@@ -2907,6 +2939,39 @@ static void gtkwin_clip_write(
     }
 }
 
+static void gtkwin_clip_write(
+    TermWin *tw, int clipboard, wchar_t *data, int *attr,
+    truecolour *truecolour, int len, bool must_deselect)
+{
+    GtkFrontend *inst = container_of(tw, GtkFrontend, termwin);
+    struct clipdata *cd;
+    char *utf8;
+    int utf8_len;
+
+    if (inst->direct_to_font) {
+        /* In this clipboard mode, we just can't paste if we're in
+         * direct-to-font mode. Fortunately, that shouldn't be
+         * important, because we'll only use this clipboard handling
+         * code on systems where that kind of font doesn't exist
+         * anyway. */
+        return;
+    }
+
+    if (!inst->clipstates[clipboard].gtkclipboard)
+        return;
+
+    utf8 = snewn(len*6, char);
+    {
+        const wchar_t *tmp = data;
+        int tmplen = len;
+        utf8_len = charset_from_unicode(&tmp, &tmplen, utf8, len*6,
+                                        CS_UTF8, NULL, NULL, 0);
+    }
+    cd = clipdata_new(utf8, utf8_len);
+    clip_write_converted(inst, clipboard, cd, must_deselect);
+    clipdata_unref(cd);
+}
+
 static void clipboard_text_received(GtkClipboard *clipboard,
                                     const gchar *text, gpointer data)
 {
@@ -2994,89 +3059,90 @@ static char *retrieve_cutbuffer(GtkFrontend *inst, int *nbytes)
 
 #endif /* NOT_X_WINDOWS */
 
-static void gtkwin_clip_write(
-    TermWin *tw, int clipboard, wchar_t *data, int *attr,
-    truecolour *truecolour, int len, bool must_deselect)
+/*
+ * Make a clipdata offering the given text in UTF-8 (if utf8 is
+ * non-NULL) and in the line codepage. Both buffers become its
+ * property. A non-NULL utf8 buffer must have room for a terminating
+ * NUL after utf8_len bytes.
+ */
+static struct clipdata *clipdata_new(
+    GtkFrontend *inst, char *utf8, int utf8_len, char *mb, int mb_len)
 {
-    GtkFrontend *inst = container_of(tw, GtkFrontend, termwin);
-    struct clipboard_state *state = &inst->clipstates[clipboard];
-
-    if (state->pasteout_data)
-        sfree(state->pasteout_data);
-    if (state->pasteout_data_ctext)
-        sfree(state->pasteout_data_ctext);
-    if (state->pasteout_data_utf8)
-        sfree(state->pasteout_data_utf8);
+    struct clipdata *cd = snew(struct clipdata);
+    cd->refcount = 1;
 
     /*
      * Set up UTF-8 and compound text paste data. This only happens
      * if we aren't in direct-to-font mode using the D800 hack.
      */
-    if (!inst->direct_to_font) {
-        const wchar_t *tmp = data;
-        int tmplen = len;
+    if (utf8) {
 #ifndef NOT_X_WINDOWS
         XTextProperty tp;
         char *list[1];
 #endif
 
-        state->pasteout_data_utf8 = snewn(len*6, char);
-        state->pasteout_data_utf8_len = len*6;
-        state->pasteout_data_utf8_len =
-            charset_from_unicode(&tmp, &tmplen, state->pasteout_data_utf8,
-                                 state->pasteout_data_utf8_len,
-                                 CS_UTF8, NULL, NULL, 0);
-        if (state->pasteout_data_utf8_len == 0) {
-            sfree(state->pasteout_data_utf8);
-            state->pasteout_data_utf8 = NULL;
+        if (utf8_len == 0) {
+            sfree(utf8);
+            cd->utf8 = NULL;
         } else {
-            state->pasteout_data_utf8 =
-                sresize(state->pasteout_data_utf8,
-                        state->pasteout_data_utf8_len + 1, char);
-            state->pasteout_data_utf8[state->pasteout_data_utf8_len] = '\0';
+            cd->utf8 = utf8;
+            cd->utf8[utf8_len] = '\0';
         }
+        cd->utf8_len = utf8_len;
 
         /*
          * Now let Xlib convert our UTF-8 data into compound text.
          */
 #ifndef NOT_X_WINDOWS
-        list[0] = state->pasteout_data_utf8;
+        list[0] = cd->utf8;
         if (inst->disp && Xutf8TextListToTextProperty(
                 inst->disp, list, 1, XCompoundTextStyle, &tp) == 0) {
-            state->pasteout_data_ctext = snewn(tp.nitems+1, char);
-            memcpy(state->pasteout_data_ctext, tp.value, tp.nitems);
-            state->pasteout_data_ctext_len = tp.nitems;
+            cd->ctext = snewn(tp.nitems+1, char);
+            memcpy(cd->ctext, tp.value, tp.nitems);
+            cd->ctext_len = tp.nitems;
             XFree(tp.value);
         } else
 #endif
         {
-            state->pasteout_data_ctext = NULL;
-            state->pasteout_data_ctext_len = 0;
+            cd->ctext = NULL;
+            cd->ctext_len = 0;
         }
     } else {
-        state->pasteout_data_utf8 = NULL;
-        state->pasteout_data_utf8_len = 0;
-        state->pasteout_data_ctext = NULL;
-        state->pasteout_data_ctext_len = 0;
-    }
-
-    state->pasteout_data = snewn(len*6, char);
-    state->pasteout_data_len = len*6;
-    state->pasteout_data_len = wc_to_mb(inst->ucsdata.line_codepage, 0,
-                                        data, len, state->pasteout_data,
-                                        state->pasteout_data_len, NULL);
-    if (state->pasteout_data_len == 0) {
-        sfree(state->pasteout_data);
-        state->pasteout_data = NULL;
+        cd->utf8 = NULL;
+        cd->utf8_len = 0;
+        cd->ctext = NULL;
+        cd->ctext_len = 0;
+    }
+
+    if (mb_len == 0) {
+        sfree(mb);
+        cd->mb = NULL;
     } else {
-        state->pasteout_data =
-            sresize(state->pasteout_data, state->pasteout_data_len, char);
+        cd->mb = mb;
     }
+    cd->mb_len = mb_len;
+
+    return cd;
+}
+
+/*
+ * Take ownership of a clipboard, offering it the text in a clipdata.
+ * The clipboard keeps its own reference to it.
+ */
+static void clip_write_converted(
+    GtkFrontend *inst, int clipboard, struct clipdata *cd,
+    bool must_deselect)
+{
+    struct clipboard_state *state = &inst->clipstates[clipboard];
+    struct clipdata *old = state->pasteout;
+
+    state->pasteout = clipdata_ref(cd);
+    clipdata_unref(old);
 
 #ifndef NOT_X_WINDOWS
     /* The legacy X cut buffers go with PRIMARY, not any other clipboard */
     if (state->atom == GDK_SELECTION_PRIMARY)
-        store_cutbuffer(inst, state->pasteout_data, state->pasteout_data_len);
+        store_cutbuffer(inst, cd->mb, cd->mb_len);
 #endif
 
     if (gtk_selection_owner_set(inst->area, state->atom,
@@ -3086,10 +3152,10 @@ static void gtkwin_clip_write(
 #endif
         gtk_selection_add_target(inst->area, state->atom,
                                  GDK_SELECTION_TYPE_STRING, 1);
-        if (state->pasteout_data_ctext)
+        if (cd->ctext)
             gtk_selection_add_target(inst->area, state->atom,
                                      compound_text_atom, 1);
-        if (state->pasteout_data_utf8)
+        if (cd->utf8)
             gtk_selection_add_target(inst->area, state->atom,
                                      utf8_string_atom, 1);
     }
@@ -3098,6 +3164,36 @@ static void gtkwin_clip_write(
         term_lost_clipboard_ownership(inst->term, clipboard);
 }
 
+static void gtkwin_clip_write(
+    TermWin *tw, int clipboard, wchar_t *data, int *attr,
+    truecolour *truecolour, int len, bool must_deselect)
+{
+    GtkFrontend *inst = container_of(tw, GtkFrontend, termwin);
+    struct clipdata *cd;
+    char *utf8 = NULL, *mb;
+    int utf8_len = 0, mb_len;
+
+    if (!inst->direct_to_font) {
+        const wchar_t *tmp = data;
+        int tmplen = len;
+
+        utf8 = snewn(len*6 + 1, char);
+        utf8_len = charset_from_unicode(&tmp, &tmplen, utf8, len*6,
+                                        CS_UTF8, NULL, NULL, 0);
+        utf8 = sresize(utf8, utf8_len + 1, char);
+    }
+
+    mb = snewn(len*6, char);
+    mb_len = wc_to_mb(inst->ucsdata.line_codepage, 0, data, len,
+                      mb, len*6, NULL);
+    if (mb_len)
+        mb = sresize(mb, mb_len, char);
+
+    cd = clipdata_new(inst, utf8, utf8_len, mb, mb_len);
+    clip_write_converted(inst, clipboard, cd, must_deselect);
+    clipdata_unref(cd);
+}
+
 static void selection_get(GtkWidget *widget, GtkSelectionData *seldata,
                           guint info, guint time_stamp, gpointer data)
 {
@@ -3105,22 +3201,20 @@ static void selection_get(GtkWidget *widget, GtkSelectionData *seldata,
     GdkAtom target = gtk_selection_data_get_target(seldata);
     struct clipboard_state *state = clipboard_from_atom(
         inst, gtk_selection_data_get_selection(seldata));
+    struct clipdata *cd;
 
-    if (!state)
+    if (!state || !(cd = state->pasteout))
         return;
 
     if (target == utf8_string_atom)
         gtk_selection_data_set(seldata, target, 8,
-                               (unsigned char *)state->pasteout_data_utf8,
-                               state->pasteout_data_utf8_len);
+                               (unsigned char *)cd->utf8, cd->utf8_len);
     else if (target == compound_text_atom)
         gtk_selection_data_set(seldata, target, 8,
-                               (unsigned char *)state->pasteout_data_ctext,
-                               state->pasteout_data_ctext_len);
+                               (unsigned char *)cd->ctext, cd->ctext_len);
     else
         gtk_selection_data_set(seldata, target, 8,
-                               (unsigned char *)state->pasteout_data,
-                               state->pasteout_data_len);
+                               (unsigned char *)cd->mb, cd->mb_len);
 }
 
 static gint selection_clear(GtkWidget *widget, GdkEventSelection *seldata,
@@ -3134,18 +3228,8 @@ static gint selection_clear(GtkWidget *widget, GdkEventSelection *seldata,
         return true;
 
     term_lost_clipboard_ownership(inst->term, state->clipboard);
-    if (state->pasteout_data)
-        sfree(state->pasteout_data);
-    if (state->pasteout_data_ctext)
-        sfree(state->pasteout_data_ctext);
-    if (state->pasteout_data_utf8)
-        sfree(state->pasteout_data_utf8);
-    state->pasteout_data = NULL;
-    state->pasteout_data_len = 0;
-    state->pasteout_data_ctext = NULL;
-    state->pasteout_data_ctext_len = 0;
-    state->pasteout_data_utf8 = NULL;
-    state->pasteout_data_utf8_len = 0;
+    clipdata_unref(state->pasteout);
+    state->pasteout = NULL;
     return true;
 }
 
@@ -4275,6 +4359,57 @@ static void gtkwin_draw_trust_sigil(TermWin *tw, int cx, int cy)
     draw_update(inst, x, y, w, h);
 }
 
+static bool gtkwin_scroll(TermWin *tw, int topline, int botline, int lines)
+{
+    GtkFrontend *inst = container_of(tw, GtkFrontend, termwin);
+
+    /*
+     * Move the surviving rows of the region within the backing store,
+     * so that the terminal only has to redraw the rows uncovered.
+     */
+    int nrows = botline - topline + 1 - abs(lines);
+    int ysrc = (lines > 0 ? topline + lines : topline) * inst->font_height +
+        inst->window_border;
+    int ydst = (lines > 0 ? topline : topline - lines) * inst->font_height +
+        inst->window_border;
+    int w = inst->backing_w / inst->scale, h = nrows * inst->font_height;
+
+    if (nrows <= 0 || (max(ysrc, ydst) + h) * inst->scale > inst->backing_h)
+        return false;
+
+#ifdef DRAW_TEXT_GDK
+    if (inst->uctx.type == DRAWTYPE_GDK) {
+        /* The X server copes with overlapping source and destination */
+        gdk_draw_pixmap(inst->uctx.u.gdk.target, inst->uctx.u.gdk.gc,
+                        inst->uctx.u.gdk.target, 0, ysrc, 0, ydst, w, h);
+    }
+#endif
+#ifdef DRAW_TEXT_CAIRO
+    if (inst->uctx.type == DRAWTYPE_CAIRO) {
+        /*
+         * inst->surface is an image surface spanning the full width
+         * of the window, so whole rows of pixels are contiguous in
+         * memory and we can just move them directly, which avoids
+         * Cairo having to make an intermediate copy of a surface
+         * being used as its own source.
+         */
+        unsigned char *data;
+        size_t stride;
+
+        cairo_surface_flush(inst->surface);
+        data = cairo_image_surface_get_data(inst->surface);
+        stride = cairo_image_surface_get_stride(inst->surface);
+        memmove(data + (size_t)ydst * inst->scale * stride,
+                data + (size_t)ysrc * inst->scale * stride,
+                (size_t)h * inst->scale * stride);
+        cairo_surface_mark_dirty(inst->surface);
+    }
+#endif
+
+    draw_update(inst, 0, ydst, w, h);
+    return true;
+}
+
 GdkCursor *make_mouse_ptr(GtkFrontend *inst, int cursor_val)
 {
     if (cursor_val == -1) {
@@ -4625,11 +4760,201 @@ void paste_clipboard_menuitem(GtkMenuItem *item, gpointer data)
     term_request_paste(inst->term, MENU_CLIPBOARD);
 }
 
+/*
+ * Accumulate text streamed out of the terminal by term_export_all,
+ * converting each chunk as it arrives so that the whole scrollback is
+ * never held as wide characters plus attributes. If 'fp' is set, the
+ * line-codepage text is written straight to it instead of kept.
+ */
+typedef struct export_ctx {
+    GtkFrontend *inst;
+    strbuf *utf8;                      /* UTF-8 text, if wanted */
+    strbuf *mb;                        /* line-codepage text, if wanted */
+    FILE *fp;
+    int write_error;                   /* errno from a failed write to fp */
+} export_ctx;
+
+static void export_chunk(void *vctx, const wchar_t *text, size_t len)
+{
+    export_ctx *ctx = (export_ctx *)vctx;
+
+    if (ctx->fp && ctx->write_error)
+        return;                        /* nothing more can be saved */
+
+    if (ctx->utf8) {
+        const wchar_t *tmp = text;
+        int tmplen = len;
+        char *out = strbuf_append(ctx->utf8, len*6);
+        int outlen = charset_from_unicode(&tmp, &tmplen, out, len*6,
+                                          CS_UTF8, NULL, NULL, 0);
+        strbuf_shrink_by(ctx->utf8, len*6 - outlen);
+    }
+
+    if (ctx->mb) {
+        char *out = strbuf_append(ctx->mb, len*6);
+        int outlen = wc_to_mb(ctx->inst->ucsdata.line_codepage, 0,
+                              text, len, out, len*6, NULL);
+        strbuf_shrink_by(ctx->mb, len*6 - outlen);
+
+        if (ctx->fp) {
+            errno = 0;
+            if (fwrite(ctx->mb->u, 1, ctx->mb->len, ctx->fp) < ctx->mb->len)
+                ctx->write_error = errno ? errno : EIO;
+            strbuf_clear(ctx->mb);
+        }
+    }
+}
+
 void copy_all_menuitem(GtkMenuItem *item, gpointer data)
 {
     GtkFrontend *inst = (GtkFrontend *)data;
     static const int clips[] = { COPYALL_CLIPBOARDS };
-    term_copyall(inst->term, clips, lenof(clips));
+    export_ctx ctx[1];
+    struct clipdata *cd;
+    char *utf8 = NULL;
+    int utf8_len = 0;
+    size_t i;
+
+#ifdef JUST_USE_GTK_CLIPBOARD_UTF8
+    /* No way to paste in direct-to-font mode: see gtkwin_clip_write */
+    if (inst->direct_to_font)
+        return;
+#endif
+
+    ctx->inst = inst;
+    ctx->utf8 = inst->direct_to_font ? NULL : strbuf_new();
+#ifdef JUST_USE_GTK_CLIPBOARD_UTF8
+    ctx->mb = NULL;
+#else
+    ctx->mb = strbuf_new();
+#endif
+    ctx->fp = NULL;
+    ctx->write_error = 0;
+    term_export_all(inst->term, export_chunk, ctx);
+
+    /*
+     * Every clipboard gets a reference to the same clipdata, so the
+     * text is only held once however many clipboards it's on.
+     */
+    if (ctx->utf8) {
+        utf8_len = ctx->utf8->len;
+        utf8 = strbuf_to_str(ctx->utf8);
+    }
+#ifdef JUST_USE_GTK_CLIPBOARD_UTF8
+    cd = clipdata_new(utf8, utf8_len);
+#else
+    {
+        int mb_len = ctx->mb->len;
+        cd = clipdata_new(inst, utf8, utf8_len,
+                          strbuf_to_str(ctx->mb), mb_len);
+    }
+#endif
+
+    for (i = 0; i < lenof(clips); i++)
+        clip_write_converted(inst, clips[i], cd, true);
+    clipdata_unref(cd);
+}
+
+static void save_scrollback(GtkFrontend *inst, const char *filename)
+{
+    export_ctx ctx[1];
+    FILE *fp;
+    int err;
+    char *msg = NULL;
+
+    fp = fopen(filename, "w");
+    if (!fp) {
+        msg = dupprintf("Unable to open '%s': %s", filename, strerror(errno));
+    } else {
+        ctx->inst = inst;
+        ctx->utf8 = NULL;
+        ctx->mb = strbuf_new();
+        ctx->fp = fp;
+        ctx->write_error = 0;
+        term_export_all(inst->term, export_chunk, ctx);
+        strbuf_free(ctx->mb);
+
+        /*
+         * Report the first thing that went wrong, whether a write
+         * during the export or the final flush in fclose, keeping
+         * its errno before any other library call can change it.
+         */
+        err = ctx->write_error;
+        errno = 0;
+        if (fclose(fp) != 0 && !err)
+            err = errno ? errno : EIO;
+        if (err)
+            msg = dupprintf("Error writing '%s': %s",
+                            filename, strerror(err));
+    }
+
+    if (msg) {
+        create_message_box(
+            inst->window, "Save scrollback error", msg,
+            string_width("LINE OF TEXT SUITABLE FOR FILE NAME ERRORS"),
+            false, &buttons_ok, trivial_post_dialog_fn, NULL);
+        sfree(msg);
+    }
+}
+
+#if GTK_CHECK_VERSION(2,0,0)
+static void save_scrollback_response(GtkDialog *dialog, gint response,
+                                     gpointer data)
+{
+    GtkFrontend *inst = (GtkFrontend *)data;
+    if (response == GTK_RESPONSE_ACCEPT) {
+        gchar *name = gtk_file_chooser_get_filename(GTK_FILE_CHOOSER(dialog));
+        save_scrollback(inst, name);
+        g_free(name);
+    }
+    gtk_widget_destroy(GTK_WIDGET(dialog));
+}
+#else
+static void save_scrollback_ok(GtkButton *button, gpointer data)
+{
+    GtkFrontend *inst = (GtkFrontend *)data;
+    gpointer filesel = g_object_get_data(G_OBJECT(button), "user-data");
+    save_scrollback(inst, gtk_file_selection_get_filename(
+                        GTK_FILE_SELECTION(filesel)));
+}
+#endif
+
+void save_scrollback_menuitem(GtkMenuItem *item, gpointer data)
+{
+    GtkFrontend *inst = (GtkFrontend *)data;
+    const char *title = "Save scrollback to file";
+
+#if GTK_CHECK_VERSION(2,0,0)
+    GtkWidget *filechoose = gtk_file_chooser_dialog_new(
+        title, GTK_WINDOW(inst->window), GTK_FILE_CHOOSER_ACTION_SAVE,
+        STANDARD_CANCEL_LABEL, GTK_RESPONSE_CANCEL,
+        STANDARD_SAVE_LABEL, GTK_RESPONSE_ACCEPT,
+        (const gchar *)NULL);
+#if GTK_CHECK_VERSION(2,8,0)
+    gtk_file_chooser_set_do_overwrite_confirmation(
+        GTK_FILE_CHOOSER(filechoose), true);
+#endif
+    gtk_window_set_modal(GTK_WINDOW(filechoose), true);
+    g_signal_connect(G_OBJECT(filechoose), "response",
+                     G_CALLBACK(save_scrollback_response), inst);
+    gtk_widget_show(filechoose);
+#else
+    GtkWidget *filesel = gtk_file_selection_new(title);
+    gtk_window_set_modal(GTK_WINDOW(filesel), true);
+    g_object_set_data(
+        G_OBJECT(GTK_FILE_SELECTION(filesel)->ok_button), "user-data",
+        (gpointer)filesel);
+    g_signal_connect(
+        G_OBJECT(GTK_FILE_SELECTION(filesel)->ok_button), "clicked",
+        G_CALLBACK(save_scrollback_ok), inst);
+    g_signal_connect_swapped(
+        G_OBJECT(GTK_FILE_SELECTION(filesel)->ok_button), "clicked",
+        G_CALLBACK(gtk_widget_destroy), (gpointer)filesel);
+    g_signal_connect_swapped(
+        G_OBJECT(GTK_FILE_SELECTION(filesel)->cancel_button), "clicked",
+        G_CALLBACK(gtk_widget_destroy), (gpointer)filesel);
+    gtk_widget_show(filesel);
+#endif
 }
 
 void special_menuitem(GtkMenuItem *item, gpointer data)
@@ -5229,6 +5554,7 @@ static const TermWinVtable gtk_termwin_vt = {
     .draw_text = gtkwin_draw_text,
     .draw_cursor = gtkwin_draw_cursor,
     .draw_trust_sigil = gtkwin_draw_trust_sigil,
+    .scroll = gtkwin_scroll,
     .char_width = gtkwin_char_width,
     .free_draw_ctx = gtkwin_free_draw_ctx,
     .set_cursor_pos = gtkwin_set_cursor_pos,
@@ -5577,6 +5903,7 @@ void new_session_window(Conf *conf, const char *geometry_string)
         MKMENUITEM("Paste from " CLIPNAME_EXPLICIT_OBJECT,
                    paste_clipboard_menuitem);
         MKMENUITEM("Copy All", copy_all_menuitem);
+        MKMENUITEM("Save Scrollback...", save_scrollback_menuitem);
         MKSEP();
         s = dupcat("About ", appname);
         MKMENUITEM(s, about_menuitem);
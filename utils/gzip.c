@@ -0,0 +1,87 @@
+/*
+ * Streaming gzip (RFC1952) encoder, wrapping the Deflate compressor
+ * from ssh/zlib.c. Used for writing compressed session logs.
+ */
+
+#include "putty.h"
+#include "ssh.h"
+
+struct GzipEncoder {
+    ssh_compressor *deflate;
+    bool started;
+    uint32_t crc;                      /* running CRC, before final XOR */
+    uint32_t isize;                    /* input size mod 2^32 */
+};
+
+GzipEncoder *gzip_encoder_new(void)
+{
+    GzipEncoder *gz = snew(GzipEncoder);
+    gz->deflate = deflate_compressor_new();
+    gz->started = false;
+    gz->crc = 0xFFFFFFFF;
+    gz->isize = 0;
+    return gz;
+}
+
+static void gzip_put_header(GzipEncoder *gz, BinarySink *bs)
+{
+    /*
+     * ID1, ID2, CM = Deflate, then no flags, no modification time,
+     * no extra flags, and OS = 255 ('unknown').
+     */
+    static const unsigned char header[10] = {
+        0x1F, 0x8B, 8, 0, 0, 0, 0, 0, 0, 255,
+    };
+
+    if (!gz->started) {
+        put_data(bs, header, sizeof(header));
+        gz->started = true;
+    }
+}
+
+void gzip_encode(GzipEncoder *gz, ptrlen data, BinarySink *bs)
+{
+    gzip_put_header(gz, bs);
+
+    const unsigned char *p = (const unsigned char *)data.ptr;
+    size_t len = data.len;
+    while (len > 0) {
+        /* ssh_compressor_compress takes an int length */
+        int chunk = len < 0x10000 ? len : 0x10000;
+        unsigned char *out;
+        int outlen;
+
+        ssh_compressor_compress(gz->deflate, p, chunk, &out, &outlen, 0);
+        put_data(bs, out, outlen);
+        sfree(out);
+
+        gz->crc = crc32_update(gz->crc, make_ptrlen(p, chunk));
+        gz->isize += chunk;
+        p += chunk;
+        len -= chunk;
+    }
+}
+
+void gzip_encoder_finish(GzipEncoder *gz, BinarySink *bs)
+{
+    unsigned char *out;
+    int outlen;
+    unsigned char trailer[8];
+
+    gzip_put_header(gz, bs);
+    deflate_compress_finish(gz->deflate, &out, &outlen);
+    put_data(bs, out, outlen);
+    sfree(out);
+
+    PUT_32BIT_LSB_FIRST(trailer, gz->crc ^ 0xFFFFFFFF);
+    PUT_32BIT_LSB_FIRST(trailer + 4, gz->isize);
+    put_data(bs, trailer, sizeof(trailer));
+
+    gzip_encoder_free(gz);
+}
+
+void gzip_encoder_free(GzipEncoder *gz)
+{
+    ssh_compressor_free(gz->deflate);
+    sfree(gz);
+}
@@ -0,0 +1,656 @@
+/*
+ * Formatting of SSH packet log entries: both the traditional text
+ * hex dump, and a compact binary record format which can be turned
+ * back into the text one later by pktlogconv.
+ *
+ * The binary log is a sequence of records, each of the form
+ *
+ *   uint32   length of everything after this field
+ *   byte     record type (PKTLOG_REC_*)
+ *   uint64   time the record was written, in seconds since the epoch
+ *   ...      type-specific payload
+ *
+ * PKTLOG_REC_START comes first in every file (and again wherever a
+ * later session appended to it), holding the string PKTLOG_MAGIC
+ * and a uint32 format version. PKTLOG_REC_TEXT holds a string to be
+ * copied verbatim into the text log, such as the header line or an
+ * Event Log entry. PKTLOG_REC_PACKET holds one call to log_packet:
+ *
+ *   byte     direction (PKT_INCOMING or PKT_OUTGOING)
+ *   uint32   packet type (0xFFFFFFFF for raw data)
+ *   byte     flags (PKTLOG_F_*) saying which optional fields follow
+ *   uint64   sequence number, if PKTLOG_F_SEQ
+ *   string   packet type name, if PKTLOG_F_TEXTTYPE
+ *   uint32   downstream id
+ *   string   additional log text, if PKTLOG_F_ADDITIONAL
+ *   uint32   number of blanking regions, followed by that many of
+ *              uint32 offset, uint32 length, byte PKTLOG_* type
+ *   uint32   total length of the packet
+ *   string   the bytes of the packet that are actually shown, i.e.
+ *            everything except the PKTLOG_BLANK and PKTLOG_OMIT
+ *            regions, which never reach the file at all.
+ */
+
+#include <time.h>
+
+#include "putty.h"
+
+#define PKTLOG_MAGIC "PuTTY binary packet log"
+#define PKTLOG_VERSION 1
+
+enum { PKTLOG_REC_START, PKTLOG_REC_TEXT, PKTLOG_REC_PACKET };
+
+/*
+ * Upper limit on the length of a packet when reading a binary log
+ * back in. Far larger than anything PuTTY sends or receives in one
+ * go; it only exists so that a damaged record can't make us allocate
+ * and walk gigabytes of nothing.
+ */
+#define PKTLOG_MAX_PACKET 0x1000000
+
+#define PKTLOG_F_SEQ 1
+#define PKTLOG_F_TEXTTYPE 2
+#define PKTLOG_F_ADDITIONAL 4
+
+/*
+ * Work out which of PKTLOG_EMIT, PKTLOG_BLANK or PKTLOG_OMIT applies
+ * to byte 'p' of the packet. Must be called for increasing p, with
+ * *b starting at zero; this is the logic log_packet has always used,
+ * so that an odd set of blanks is still treated the same way.
+ */
+static int pktlog_blktype(const PacketLogEntry *pe, size_t p, size_t *b)
+{
+    /* Move to a current entry in the blanking array. */
+    while ((*b < pe->n_blanks) &&
+           (p >= pe->blanks[*b].offset + pe->blanks[*b].len))
+        (*b)++;
+    /* Work out what type of blanking to apply to this byte. */
+    if ((*b < pe->n_blanks) &&
+        (p >= pe->blanks[*b].offset) &&
+        (p < pe->blanks[*b].offset + pe->blanks[*b].len))
+        return pe->blanks[*b].type;
+    return PKTLOG_EMIT;
+}
+
+void pktlog_format_text(BinarySink *bs, const PacketLogEntry *pe,
+                        const struct tm *tm)
+{
+    char dumpdata[128], smalldata[5];
+    size_t p = 0, b = 0, omitted = 0;
+    int output_pos = 0; /* NZ if pending output in dumpdata */
+    const unsigned char *data = (const unsigned char *)pe->data.ptr;
+    size_t len = pe->data.len;
+
+    /* Packet header. */
+    if (pe->texttype) {
+        put_fmt(bs, "%s packet ",
+                pe->direction == PKT_INCOMING ? "Incoming" : "Outgoing");
+
+        if (pe->seq)
+            put_fmt(bs, "#0x%lx, ", *pe->seq);
+
+        put_fmt(bs, "type %d / 0x%02x (%s)",
+                pe->type, pe->type, pe->texttype);
+
+        if (pe->downstream_id) {
+            put_fmt(bs, " on behalf of downstream #%u", pe->downstream_id);
+            if (pe->additional_log_text)
+                put_fmt(bs, " (%s)", pe->additional_log_text);
+        }
+
+        put_datalit(bs, "\r\n");
+    } else {
+        /*
+         * Raw data is logged with a timestamp, so that it's possible
+         * to determine whether a mysterious delay occurred at the
+         * client or server end. (Timestamping the raw data avoids
+         * cluttering the normal case of only logging decrypted SSH
+         * messages, and also adds conceptual rigour in the case where
+         * an SSH message arrives in several pieces.)
+         */
+        char buf[256];
+        strftime(buf, 24, "%Y-%m-%d %H:%M:%S", tm);
+        put_fmt(bs, "%s raw data at %s\r\n",
+                pe->direction == PKT_INCOMING ? "Incoming" : "Outgoing",
+                buf);
+    }
+
+    /*
+     * Output a hex/ASCII dump of the packet body, blanking/omitting
+     * parts as specified.
+     */
+    while (p < len) {
+        int blktype = pktlog_blktype(pe, p, &b);
+
+        /* If we're about to stop omitting, it's time to say how
+         * much we omitted. */
+        if ((blktype != PKTLOG_OMIT) && omitted) {
+            put_fmt(bs, "  (%"SIZEu" byte%s omitted)\r\n",
+                    omitted, (omitted==1?"":"s"));
+            omitted = 0;
+        }
+
+        /* (Re-)initialise dumpdata as necessary
+         * (start of row, or if we've just stopped omitting) */
+        if (!output_pos && !omitted)
+            sprintf(dumpdata, "  %08"SIZEx"%*s\r\n",
+                    p-(p%16), 1+3*16+2+16, "");
+
+        /* Deal with the current byte. */
+        if (blktype == PKTLOG_OMIT) {
+            omitted++;
+        } else {
+            int c;
+            if (blktype == PKTLOG_BLANK) {
+                c = 'X';
+                sprintf(smalldata, "XX");
+            } else {  /* PKTLOG_EMIT */
+                c = data[p];
+                sprintf(smalldata, "%02x", c);
+            }
+            dumpdata[10+2+3*(p%16)] = smalldata[0];
+            dumpdata[10+2+3*(p%16)+1] = smalldata[1];
+            dumpdata[10+1+3*16+2+(p%16)] = (c >= 0x20 && c < 0x7F ? c : '.');
+            output_pos = (p%16) + 1;
+        }
+
+        p++;
+
+        /* Flush row if necessary */
+        if (((p % 16) == 0) || (p == len) || omitted) {
+            if (output_pos) {
+                strcpy(dumpdata + 10+1+3*16+2+output_pos, "\r\n");
+                put_dataz(bs, dumpdata);
+                output_pos = 0;
+            }
+        }
+
+    }
+
+    /* Tidy up */
+    if (omitted)
+        put_fmt(bs, "  (%"SIZEu" byte%s omitted)\r\n",
+                omitted, (omitted==1?"":"s"));
+}
+
+/*
+ * Write out a whole binary record, given its type-specific payload.
+ */
+static void pktlog_binary_record(BinarySink *bs, int rectype, time_t when,
+                                 ptrlen payload)
+{
+    put_uint32(bs, 1 + 8 + payload.len);
+    put_byte(bs, rectype);
+    put_uint64(bs, (uint64_t)when);
+    put_datapl(bs, payload);
+}
+
+void pktlog_binary_start(BinarySink *bs, time_t when)
+{
+    strbuf *sb = strbuf_new();
+    put_stringz(sb, PKTLOG_MAGIC);
+    put_uint32(sb, PKTLOG_VERSION);
+    pktlog_binary_record(bs, PKTLOG_REC_START, when, ptrlen_from_strbuf(sb));
+    strbuf_free(sb);
+}
+
+void pktlog_binary_text(BinarySink *bs, ptrlen text, time_t when)
+{
+    strbuf *sb = strbuf_new();
+    put_stringpl(sb, text);
+    pktlog_binary_record(bs, PKTLOG_REC_TEXT, when, ptrlen_from_strbuf(sb));
+    strbuf_free(sb);
+}
+
+void pktlog_binary_packet(BinarySink *bs, const PacketLogEntry *pe,
+                          time_t when)
+{
+    strbuf *sb = strbuf_new();
+    const unsigned char *data = (const unsigned char *)pe->data.ptr;
+
+    put_byte(sb, pe->direction);
+    put_uint32(sb, (uint32_t)pe->type);
+    put_byte(sb, ((pe->seq ? PKTLOG_F_SEQ : 0) |
+                  (pe->texttype ? PKTLOG_F_TEXTTYPE : 0) |
+                  (pe->additional_log_text ? PKTLOG_F_ADDITIONAL : 0)));
+    if (pe->seq)
+        put_uint64(sb, *pe->seq);
+    if (pe->texttype)
+        put_stringz(sb, pe->texttype);
+    put_uint32(sb, pe->downstream_id);
+    if (pe->additional_log_text)
+        put_stringz(sb, pe->additional_log_text);
+
+    put_uint32(sb, pe->n_blanks);
+    for (size_t i = 0; i < pe->n_blanks; i++) {
+        put_uint32(sb, pe->blanks[i].offset);
+        put_uint32(sb, pe->blanks[i].len);
+        put_byte(sb, pe->blanks[i].type);
+    }
+
+    put_uint32(sb, pe->data.len);
+
+    /*
+     * Only the bytes that the text dump would show in full go into
+     * the file, as runs of consecutive PKTLOG_EMIT bytes. Write a
+     * placeholder for the string length and fill it in afterwards.
+     */
+    size_t lenpos = sb->len;
+    put_uint32(sb, 0);
+    size_t b = 0, run_start = 0;
+    bool in_run = false;
+    for (size_t p = 0; p < pe->data.len; p++) {
+        bool emit = (pktlog_blktype(pe, p, &b) == PKTLOG_EMIT);
+        if (emit && !in_run) {
+            run_start = p;
+            in_run = true;
+        } else if (!emit && in_run) {
+            put_data(sb, data + run_start, p - run_start);
+            in_run = false;
+        }
+    }
+    if (in_run)
+        put_data(sb, data + run_start, pe->data.len - run_start);
+    PUT_32BIT_MSB_FIRST(sb->u + lenpos, sb->len - lenpos - 4);
+
+    pktlog_binary_record(bs, PKTLOG_REC_PACKET, when, ptrlen_from_strbuf(sb));
+    strbuf_free(sb);
+}
+
+/*
+ * Decode a PKTLOG_REC_PACKET payload and write it out in text form.
+ */
+static const char *pktlog_packet_to_text(BinarySource *src, time_t when,
+                                         BinarySink *bs)
+{
+    PacketLogEntry pe;
+    unsigned long seq;
+    char *texttype = NULL, *additional = NULL;
+    struct logblank_t *blanks = NULL;
+    unsigned char *data = NULL;
+    const char *err = NULL;
+
+    pe.direction = get_byte(src);
+    pe.type = (int)(int32_t)get_uint32(src);
+    unsigned flags = get_byte(src);
+    pe.seq = NULL;
+    if (flags & PKTLOG_F_SEQ) {
+        seq = get_uint64(src);
+        pe.seq = &seq;
+    }
+    if (flags & PKTLOG_F_TEXTTYPE)
+        texttype = mkstr(get_string(src));
+    pe.texttype = texttype;
+    pe.downstream_id = get_uint32(src);
+    if (flags & PKTLOG_F_ADDITIONAL)
+        additional = mkstr(get_string(src));
+    pe.additional_log_text = additional;
+
+    size_t n_blanks = get_uint32(src);
+    if (get_err(src) || n_blanks > get_avail(src) / 9) {
+        err = "malformed packet record";
+        goto out;
+    }
+    blanks = snewn(n_blanks, struct logblank_t);
+    for (size_t i = 0; i < n_blanks; i++) {
+        blanks[i].offset = get_uint32(src);
+        blanks[i].len = get_uint32(src);
+        blanks[i].type = get_byte(src);
+    }
+    pe.n_blanks = n_blanks;
+    pe.blanks = blanks;
+
+    size_t len = get_uint32(src);
+    ptrlen shown = get_string(src);
+    if (get_err(src)) {
+        err = "malformed packet record";
+        goto out;
+    }
+
+    /*
+     * Every byte of the packet is either in 'shown' or in a blanked
+     * or omitted region, so a length beyond those is a damaged record.
+     */
+    uint64_t hidden = 0;
+    for (size_t i = 0; i < n_blanks; i++)
+        if (blanks[i].type != PKTLOG_EMIT)
+            hidden += blanks[i].len;
+    if (len > PKTLOG_MAX_PACKET || len > shown.len + hidden) {
+        err = "malformed packet record";
+        goto out;
+    }
+
+    /*
+     * Put the bytes we have back in their places. The blanked and
+     * omitted ones are never looked at, so they can stay zero.
+     */
+    data = snewn(len ? len : 1, unsigned char);
+    memset(data, 0, len);
+    BinarySource shown_src[1];
+    BinarySource_BARE_INIT_PL(shown_src, shown);
+    size_t b = 0;
+    for (size_t p = 0; p < len; p++)
+        if (pktlog_blktype(&pe, p, &b) == PKTLOG_EMIT)
+            data[p] = get_byte(shown_src);
+    if (get_err(shown_src) || get_avail(shown_src)) {
+        err = "packet record data does not match its blanking regions";
+        goto out;
+    }
+    pe.data = make_ptrlen(data, len);
+
+    /* The timestamp is from the file too, and may be out of range */
+    struct tm *tmp = localtime(&when);
+    if (!tmp) {
+        err = "malformed packet record";
+        goto out;
+    }
+    struct tm tm = *tmp;
+    pktlog_format_text(bs, &pe, &tm);
+
+  out:
+    sfree(texttype);
+    sfree(additional);
+    sfree(blanks);
+    sfree(data);
+    return err;
+}
+
+const char *pktlog_binary_to_text(BinarySource *src, BinarySink *bs)
+{
+    bool seen_start = false;
+
+    while (get_avail(src)) {
+        ptrlen record = get_string(src);
+        if (get_err(src))
+            return "truncated record at end of file";
+
+        BinarySource rsrc[1];
+        BinarySource_BARE_INIT_PL(rsrc, record);
+        int rectype = get_byte(rsrc);
+        time_t when = (time_t)get_uint64(rsrc);
+        if (get_err(rsrc))
+            return "malformed record header";
+
+        if (!seen_start && rectype != PKTLOG_REC_START)
+            return "not a binary packet log";
+
+        switch (rectype) {
+          case PKTLOG_REC_START:
+            if (!ptrlen_eq_string(get_string(rsrc), PKTLOG_MAGIC))
+                return "not a binary packet log";
+            if (get_uint32(rsrc) != PKTLOG_VERSION)
+                return "unsupported binary packet log version";
+            seen_start = true;
+            break;
+          case PKTLOG_REC_TEXT: {
+            ptrlen text = get_string(rsrc);
+            if (get_err(rsrc))
+                return "malformed text record";
+            put_datapl(bs, text);
+            break;
+          }
+          case PKTLOG_REC_PACKET: {
+            const char *err = pktlog_packet_to_text(rsrc, when, bs);
+            if (err)
+                return err;
+            break;
+          }
+          default:
+            /* Ignore record types from a later version of the format */
+            break;
+        }
+    }
+
+    return NULL;
+}
+
+#ifdef TEST
+
+#include <stdio.h>
+
+void out_of_memory(void) { fprintf(stderr, "out of memory\n"); abort(); }
+
+static int fails, passes;
+
+static bool contains(strbuf *sb, const void *needle, size_t len)
+{
+    for (size_t i = 0; i + len <= sb->len; i++)
+        if (!memcmp(sb->u + i, needle, len))
+            return true;
+    return false;
+}
+
+/*
+ * Check that a packet comes out of the binary format exactly as it
+ * would have been written in text form, and that none of the bytes
+ * it blanks or omits find their way into the binary version.
+ */
+static void test_packet(const char *name, const PacketLogEntry *pe)
+{
+    time_t when = 1700000000;
+    struct tm *tmp = localtime(&when);
+    if (!tmp) {
+        printf("%s: localtime failed\n", name);
+        fails++;
+        return;
+    }
+    struct tm tm = *tmp;
+
+    strbuf *text = strbuf_new();
+    pktlog_format_text(BinarySink_UPCAST(text), pe, &tm);
+
+    strbuf *bin = strbuf_new();
+    pktlog_binary_start(BinarySink_UPCAST(bin), when);
+    pktlog_binary_packet(BinarySink_UPCAST(bin), pe, when);
+
+    strbuf *conv = strbuf_new();
+    BinarySource src[1];
+    BinarySource_BARE_INIT_PL(src, ptrlen_from_strbuf(bin));
+    const char *err = pktlog_binary_to_text(src, BinarySink_UPCAST(conv));
+
+    if (err) {
+        printf("%s: conversion failed: %s\n", name, err);
+        fails++;
+    } else if (!ptrlen_eq_ptrlen(ptrlen_from_strbuf(text),
+                                 ptrlen_from_strbuf(conv))) {
+        printf("%s: converted text differs:\n%s---\n%s", name,
+               text->s, conv->s);
+        fails++;
+    } else if (contains(bin, "SECRET", 6) || contains(bin, "\xA5", 1)) {
+        printf("%s: censored data present in binary log\n", name);
+        fails++;
+    } else {
+        passes++;
+    }
+
+    strbuf_free(text);
+    strbuf_free(bin);
+    strbuf_free(conv);
+}
+
+/*
+ * Fill the test packet with ordinary bytes, apart from the regions
+ * the test is going to censor, which get recognisable ones.
+ */
+static void fill(unsigned char *buf, size_t len,
+                 const struct logblank_t *blanks, size_t n_blanks)
+{
+    for (size_t i = 0; i < len; i++)
+        buf[i] = (unsigned char)(0x20 + i);
+    for (size_t i = 0; i < n_blanks; i++)
+        if (blanks[i].type != PKTLOG_EMIT)
+            memset(buf + blanks[i].offset, 0xA5, blanks[i].len);
+}
+
+int main(void)
+{
+    unsigned char buf[100];
+
+    unsigned long seq = 0x1234;
+    struct logblank_t blanks[] = {
+        { 20, 6, PKTLOG_BLANK },
+        { 40, 5, PKTLOG_EMIT },
+        { 60, 10, PKTLOG_OMIT },
+    };
+    struct logblank_t tail_omit[] = { { 90, 10, PKTLOG_OMIT } };
+    struct logblank_t single[] = { { 20, 6, PKTLOG_OMIT },
+                                   { 60, 1, PKTLOG_OMIT } };
+
+    PacketLogEntry pe = {
+        .direction = PKT_INCOMING, .type = 94,
+        .texttype = "SSH2_MSG_CHANNEL_DATA", .data = make_ptrlen(buf, 100),
+        .seq = &seq,
+    };
+
+    fill(buf, 100, NULL, 0);
+    pe.n_blanks = 0;
+    pe.blanks = NULL;
+    pe.data = make_ptrlen(buf, 20);
+    test_packet("plain", &pe);
+
+    pe.data = make_ptrlen(buf, 0);
+    test_packet("empty", &pe);
+
+    fill(buf, 100, blanks, lenof(blanks));
+    memcpy(buf + 20, "SECRET", 6);
+    pe.data = make_ptrlen(buf, 100);
+    pe.n_blanks = lenof(blanks);
+    pe.blanks = blanks;
+    test_packet("blanked", &pe);
+
+    fill(buf, 100, tail_omit, lenof(tail_omit));
+    pe.seq = NULL;
+    pe.direction = PKT_OUTGOING;
+    pe.n_blanks = lenof(tail_omit);
+    pe.blanks = tail_omit;
+    test_packet("omitted at end", &pe);
+
+    fill(buf, 100, single, lenof(single));
+    pe.n_blanks = lenof(single);
+    pe.blanks = single;
+    test_packet("one byte omitted", &pe);
+
+    fill(buf, 100, NULL, 0);
+    pe.n_blanks = 0;
+    pe.blanks = NULL;
+    pe.data = make_ptrlen(buf, 10);
+    pe.downstream_id = 3;
+    test_packet("downstream", &pe);
+    pe.additional_log_text = "session channel";
+    test_packet("downstream with text", &pe);
+
+    PacketLogEntry raw = {
+        .direction = PKT_OUTGOING, .type = -1,
+        .data = make_ptrlen(buf, 33),
+    };
+    test_packet("raw", &raw);
+
+    /*
+     * Text records, appended logs and damaged files.
+     */
+    {
+        strbuf *bin = strbuf_new();
+        pktlog_binary_start(BinarySink_UPCAST(bin), 0);
+        pktlog_binary_text(BinarySink_UPCAST(bin),
+                           PTRLEN_LITERAL("Event Log: one\r\n"), 0);
+        pktlog_binary_start(BinarySink_UPCAST(bin), 0);
+        pktlog_binary_text(BinarySink_UPCAST(bin),
+                           PTRLEN_LITERAL("Event Log: two\r\n"), 0);
+
+        strbuf *conv = strbuf_new();
+        BinarySource src[1];
+        BinarySource_BARE_INIT_PL(src, ptrlen_from_strbuf(bin));
+        const char *err = pktlog_binary_to_text(src, BinarySink_UPCAST(conv));
+        if (err || strcmp(conv->s, "Event Log: one\r\nEvent Log: two\r\n")) {
+            printf("text records: got '%s' (%s)\n", conv->s,
+                   err ? err : "no error");
+            fails++;
+        } else {
+            passes++;
+        }
+
+        strbuf_clear(conv);
+        BinarySource_BARE_INIT(src, bin->u, bin->len - 1);
+        err = pktlog_binary_to_text(src, BinarySink_UPCAST(conv));
+        if (!err || strcmp(conv->s, "Event Log: one\r\n")) {
+            printf("truncated file: got '%s' (%s)\n", conv->s,
+                   err ? err : "no error");
+            fails++;
+        } else {
+            passes++;
+        }
+
+        strbuf_clear(conv);
+        BinarySource_BARE_INIT(src, "Incoming packet", 15);
+        err = pktlog_binary_to_text(src, BinarySink_UPCAST(conv));
+        if (!err) {
+            printf("text log accepted as binary\n");
+            fails++;
+        } else {
+            passes++;
+        }
+
+        strbuf_free(bin);
+        strbuf_free(conv);
+    }
+
+    /*
+     * Packet records whose length, or timestamp, can't be right.
+     */
+    {
+        static const struct {
+            const char *name;
+            uint64_t when;
+            uint32_t blank_len, len;
+        } bad[] = {
+            { "huge length", 0, 0, 0xFFFFFFF0 },
+            { "huge length under huge omit", 0, 0xFFFFFFFF, 0xFFFFFFF0 },
+            { "length beyond blanks", 0, 4, 9 },
+            { "timestamp out of range", 0x7FFFFFFFFFFFFFFF, 0, 0 },
+        };
+
+        for (size_t i = 0; i < lenof(bad); i++) {
+            strbuf *payload = strbuf_new();
+            put_byte(payload, PKT_INCOMING);
+            put_uint32(payload, 94);
+            put_byte(payload, 0);      /* flags */
+            put_uint32(payload, 0);    /* downstream id */
+            put_uint32(payload, bad[i].blank_len ? 1 : 0);
+            if (bad[i].blank_len) {
+                put_uint32(payload, 0);
+                put_uint32(payload, bad[i].blank_len);
+                put_byte(payload, PKTLOG_OMIT);
+            }
+            put_uint32(payload, bad[i].len);
+            put_stringz(payload, "");
+
+            strbuf *bin = strbuf_new();
+            pktlog_binary_start(BinarySink_UPCAST(bin), 0);
+            put_uint32(bin, 1 + 8 + payload->len);
+            put_byte(bin, PKTLOG_REC_PACKET);
+            put_uint64(bin, bad[i].when);
+            put_datapl(bin, ptrlen_from_strbuf(payload));
+
+            strbuf *conv = strbuf_new();
+            BinarySource src[1];
+            BinarySource_BARE_INIT_PL(src, ptrlen_from_strbuf(bin));
+            const char *err = pktlog_binary_to_text(
+                src, BinarySink_UPCAST(conv));
+            if (!err) {
+                printf("%s: record accepted\n", bad[i].name);
+                fails++;
+            } else {
+                passes++;
+            }
+
+            strbuf_free(payload);
+            strbuf_free(bin);
+            strbuf_free(conv);
+        }
+    }
+
+    printf("passed %d, failed %d\n", passes, fails);
+    return fails != 0;
+}
+
+#endif /* TEST */
@@ -16,6 +16,7 @@ void cleanup_exit(int code)
     /*
      * Clean up.
      */
+    console_free_log();
     sk_cleanup();
 
     random_save_seed();
@@ -23,8 +23,11 @@ typedef const char *HelpCtx;
 #define WINHELP_CTX_logging_exists "config-logfileexists"
 #define WINHELP_CTX_logging_flush "config-logflush"
 #define WINHELP_CTX_logging_header "config-logheader"
+#define WINHELP_CTX_logging_writer "config-logwriter"
+#define WINHELP_CTX_logging_compress "config-logcompress"
 #define WINHELP_CTX_logging_ssh_omit_password "config-logssh"
 #define WINHELP_CTX_logging_ssh_omit_data "config-logssh"
+#define WINHELP_CTX_logging_ssh_binary "config-logssh-binary"
 #define WINHELP_CTX_keyboard_backspace "config-backspace"
 #define WINHELP_CTX_keyboard_homeend "config-homeend"
 #define WINHELP_CTX_keyboard_funkeys "config-funkeys"
@@ -68,6 +71,8 @@ typedef const char *HelpCtx;
 #define WINHELP_CTX_window_resize "config-winsizelock"
 #define WINHELP_CTX_window_scrollback "config-scrollback"
 #define WINHELP_CTX_window_erased "config-erasetoscrollback"
+#define WINHELP_CTX_window_spill "config-spillscrollback"
+#define WINHELP_CTX_window_pacing "config-updatepacing"
 #define WINHELP_CTX_behaviour_closewarn "config-warnonclose"
 #define WINHELP_CTX_behaviour_altf4 "config-altf4"
 #define WINHELP_CTX_behaviour_altspace "config-altspace"
@@ -31,7 +31,6 @@ static BinarySink *stdout_bs, *stderr_bs;
 static DWORD orig_console_mode;
 
 static Backend *backend;
-static LogContext *logctx;
 static Conf *conf;
 
 static void plink_echoedit_update(Seat *seat, bool echo, bool edit)
@@ -447,7 +446,7 @@ int main(int argc, char **argv)
         !conf_get_str_nthstrkey(conf, CONF_portfwd, 0))
         conf_set_bool(conf, CONF_ssh_simple, true);
 
-    logctx = log_init(console_cli_logpolicy, conf);
+    console_logctx = log_init(console_cli_logpolicy, conf);
 
     if (just_test_share_exists) {
         if (!vt->test_for_upstream) {
@@ -528,7 +527,7 @@ int main(int argc, char **argv)
         bool nodelay = conf_get_bool(conf, CONF_tcp_nodelay) &&
             (GetFileType(GetStdHandle(STD_INPUT_HANDLE)) == FILE_TYPE_CHAR);
 
-        error = backend_init(vt, plink_seat, &backend, logctx, conf,
+        error = backend_init(vt, plink_seat, &backend, console_logctx, conf,
                              conf_get_str(conf, CONF_host),
                              conf_get_int(conf, CONF_port),
                              &realhost, nodelay,
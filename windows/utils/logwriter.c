@@ -0,0 +1,164 @@
+/*
+ * Windows implementation of the background log file writer, using a
+ * subthread to do the stdio calls.
+ *
+ * There's only ever one thread on each side of the queue, so a pair
+ * of auto-reset events is enough to wake each one up when the other
+ * has changed something: whoever wakes up rechecks the state under
+ * the critical section, and an event set while nobody is waiting
+ * just stays set until the next wait.
+ */
+
+#include <stdio.h>
+
+#include "putty.h"
+
+struct LogWriter {
+    FILE *fp;
+    size_t queue_limit;
+    bool drop_when_full;
+
+    HANDLE thread;
+    CRITICAL_SECTION critsec;
+    HANDLE data_ready;                 /* set by the main thread */
+    HANDLE space_ready;                /* set by the writer thread */
+
+    /* Everything below is protected by 'critsec' */
+    bufchain queue;
+    bool flush_wanted, stopping, failed;
+    bool dropping;       /* discarding data until the queue drains */
+};
+
+static DWORD WINAPI logwriter_thread(void *vctx)
+{
+    LogWriter *lw = (LogWriter *)vctx;
+
+    EnterCriticalSection(&lw->critsec);
+    while (true) {
+        if (bufchain_size(&lw->queue) > 0) {
+            /*
+             * The main thread only ever appends to the queue, so the
+             * data at the head stays put while we write it outside
+             * the critical section.
+             */
+            ptrlen data = bufchain_prefix(&lw->queue);
+            LeaveCriticalSection(&lw->critsec);
+            bool ok = (fwrite(data.ptr, 1, data.len, lw->fp) == data.len);
+            EnterCriticalSection(&lw->critsec);
+
+            bufchain_consume(&lw->queue, data.len);
+            if (!ok) {
+                lw->failed = true;
+                bufchain_clear(&lw->queue);
+            }
+            SetEvent(lw->space_ready);
+        } else if (lw->flush_wanted) {
+            lw->flush_wanted = false;
+            LeaveCriticalSection(&lw->critsec);
+            bool ok = (fflush(lw->fp) == 0);
+            EnterCriticalSection(&lw->critsec);
+
+            if (!ok)
+                lw->failed = true;
+        } else if (lw->stopping) {
+            break;
+        } else {
+            LeaveCriticalSection(&lw->critsec);
+            WaitForSingleObject(lw->data_ready, INFINITE);
+            EnterCriticalSection(&lw->critsec);
+        }
+    }
+    LeaveCriticalSection(&lw->critsec);
+
+    return 0;
+}
+
+LogWriter *logwriter_new(FILE *fp, size_t queue_limit, bool drop_when_full)
+{
+    LogWriter *lw = snew(LogWriter);
+    lw->fp = fp;
+    lw->queue_limit = queue_limit;
+    lw->drop_when_full = drop_when_full;
+    bufchain_init(&lw->queue);
+    lw->flush_wanted = lw->stopping = lw->failed = lw->dropping = false;
+
+    InitializeCriticalSection(&lw->critsec);
+    lw->data_ready = CreateEvent(NULL, false, false, NULL);
+    lw->space_ready = CreateEvent(NULL, false, false, NULL);
+
+    DWORD tid;
+    lw->thread = CreateThread(NULL, 0, logwriter_thread, lw, 0, &tid);
+    if (!lw->thread) {
+        CloseHandle(lw->space_ready);
+        CloseHandle(lw->data_ready);
+        DeleteCriticalSection(&lw->critsec);
+        sfree(lw);
+        return NULL;
+    }
+
+    return lw;
+}
+
+LogWriterStatus logwriter_write(LogWriter *lw, ptrlen data)
+{
+    LogWriterStatus status = LW_QUEUED;
+
+    EnterCriticalSection(&lw->critsec);
+    /*
+     * Once we've started discarding data, carry on until the queue is
+     * down to half the limit, so that a writer which is only just too
+     * slow doesn't make us alternate between the two on every call.
+     */
+    if (lw->dropping && bufchain_size(&lw->queue) <= lw->queue_limit / 2)
+        lw->dropping = false;
+    /*
+     * A chunk bigger than the whole limit is still accepted once the
+     * queue is empty, or else it could never be written at all.
+     */
+    while (!lw->failed && (lw->dropping || (
+               bufchain_size(&lw->queue) > 0 &&
+               bufchain_size(&lw->queue) + data.len > lw->queue_limit))) {
+        if (lw->drop_when_full) {
+            lw->dropping = true;
+            status = LW_DROPPED;
+            break;
+        }
+        LeaveCriticalSection(&lw->critsec);
+        WaitForSingleObject(lw->space_ready, INFINITE);
+        EnterCriticalSection(&lw->critsec);
+    }
+    if (lw->failed) {
+        status = LW_FAILED;
+    } else if (status == LW_QUEUED) {
+        bufchain_add(&lw->queue, data.ptr, data.len);
+        SetEvent(lw->data_ready);
+    }
+    LeaveCriticalSection(&lw->critsec);
+
+    return status;
+}
+
+void logwriter_flush(LogWriter *lw)
+{
+    EnterCriticalSection(&lw->critsec);
+    lw->flush_wanted = true;
+    SetEvent(lw->data_ready);
+    LeaveCriticalSection(&lw->critsec);
+}
+
+void logwriter_free(LogWriter *lw)
+{
+    EnterCriticalSection(&lw->critsec);
+    lw->stopping = true;
+    SetEvent(lw->data_ready);
+    LeaveCriticalSection(&lw->critsec);
+
+    WaitForSingleObject(lw->thread, INFINITE);
+    CloseHandle(lw->thread);
+
+    bufchain_clear(&lw->queue);
+    CloseHandle(lw->space_ready);
+    CloseHandle(lw->data_ready);
+    DeleteCriticalSection(&lw->critsec);
+    sfree(lw);
+}
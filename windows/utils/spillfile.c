@@ -0,0 +1,143 @@
+/*
+ * Windows implementation of the terminal's scrollback spill file: a
+ * temporary file that is deleted when we close it, appended to with
+ * WriteFile and read back through a view of whichever part of it was
+ * last asked for.
+ */
+
+#include "putty.h"
+
+/* Minimum size of the region we map at once */
+#define SPILL_MAP_SIZE (1 << 20)
+
+struct SpillFile {
+    HANDLE file;
+    uint64_t size;                     /* amount written so far */
+
+    HANDLE mapping;                    /* covers the file as of 'mapsize' */
+    uint64_t mapsize;
+    void *view;                        /* current view, or NULL */
+    uint64_t viewstart, viewlen;
+};
+
+SpillFile *spillfile_new(void)
+{
+    /* GetTempPath is documented as returning a size of up to
+     * MAX_PATH+1 which does not count the NUL */
+    char tempdir[MAX_PATH + 2];
+    if (GetTempPath(sizeof(tempdir), tempdir) == 0)
+        return NULL;
+
+    unsigned long pid = GetCurrentProcessId();
+    HANDLE file;
+
+    for (uint64_t counter = 0;; counter++) {
+        char *filename = dupprintf(
+            "%s\\putty_%lu_%"PRIu64".scrollback", tempdir, pid, counter);
+        file = CreateFile(
+            filename, GENERIC_READ | GENERIC_WRITE, 0, NULL, CREATE_NEW,
+            FILE_ATTRIBUTE_TEMPORARY | FILE_FLAG_DELETE_ON_CLOSE, NULL);
+        sfree(filename);
+
+        if (file != INVALID_HANDLE_VALUE)
+            break;                     /* success! */
+
+        if (GetLastError() != ERROR_FILE_EXISTS)
+            return NULL;               /* failed for some other reason */
+    }
+
+    SpillFile *sf = snew(SpillFile);
+    sf->file = file;
+    sf->size = 0;
+    sf->mapping = NULL;
+    sf->mapsize = 0;
+    sf->view = NULL;
+    sf->viewstart = sf->viewlen = 0;
+    return sf;
+}
+
+uint64_t spillfile_append(SpillFile *sf, ptrlen data)
+{
+    uint64_t offset = sf->size;
+    const char *p = data.ptr;
+    size_t len = data.len;
+
+    while (len > 0) {
+        OVERLAPPED ov;
+        DWORD towrite = len < 0x40000000 ? len : 0x40000000, written;
+
+        memset(&ov, 0, sizeof(ov));
+        ov.Offset = (DWORD)sf->size;
+        ov.OffsetHigh = (DWORD)(sf->size >> 32);
+        if (!WriteFile(sf->file, p, towrite, &written, &ov) || !written) {
+            sf->size = offset;
+            return SPILLFILE_FAILED;
+        }
+        p += written;
+        len -= written;
+        sf->size += written;
+    }
+
+    return offset;
+}
+
+static void spillfile_unmap(SpillFile *sf)
+{
+    if (sf->view) {
+        UnmapViewOfFile(sf->view);
+        sf->view = NULL;
+    }
+}
+
+ptrlen spillfile_read(SpillFile *sf, uint64_t offset, size_t len)
+{
+    assert(offset + len <= sf->size);
+
+    if (sf->view && offset >= sf->viewstart &&
+        offset + len <= sf->viewstart + sf->viewlen)
+        return make_ptrlen((const char *)sf->view +
+                           (offset - sf->viewstart), len);
+
+    spillfile_unmap(sf);
+
+    /*
+     * A file mapping object can't see past the size the file had
+     * when it was made, so make a new one if we need to.
+     */
+    if (offset + len > sf->mapsize) {
+        if (sf->mapping)
+            CloseHandle(sf->mapping);
+        sf->mapping = CreateFileMapping(sf->file, NULL, PAGE_READONLY,
+                                        0, 0, NULL);
+        sf->mapsize = sf->mapping ? sf->size : 0;
+        if (!sf->mapping)
+            return make_ptrlen(NULL, 0);
+    }
+
+    SYSTEM_INFO si;
+    GetSystemInfo(&si);
+    uint64_t start = offset - offset % si.dwAllocationGranularity;
+    uint64_t viewlen = offset + len - start;
+    if (viewlen < SPILL_MAP_SIZE)
+        viewlen = SPILL_MAP_SIZE;
+    if (viewlen > sf->mapsize - start)
+        viewlen = sf->mapsize - start;
+
+    sf->view = MapViewOfFile(sf->mapping, FILE_MAP_READ,
+                             (DWORD)(start >> 32), (DWORD)start, viewlen);
+    if (!sf->view)
+        return make_ptrlen(NULL, 0);
+    sf->viewstart = start;
+    sf->viewlen = viewlen;
+
+    return make_ptrlen((const char *)sf->view + (offset - start), len);
+}
+
+void spillfile_free(SpillFile *sf)
+{
+    spillfile_unmap(sf);
+    if (sf->mapping)
+        CloseHandle(sf->mapping);
+    CloseHandle(sf->file);
+    sfree(sf);
+}
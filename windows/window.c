@@ -273,6 +273,7 @@ static void wintw_draw_text(TermWin *, int x, int y, wchar_t *text, int len,
 static void wintw_draw_cursor(TermWin *, int x, int y, wchar_t *text, int len,
                               unsigned long attrs, int lattrs, truecolour tc);
 static void wintw_draw_trust_sigil(TermWin *, int x, int y);
+static bool wintw_scroll(TermWin *, int topline, int botline, int lines);
 static int wintw_char_width(TermWin *, int uc);
 static void wintw_free_draw_ctx(TermWin *);
 static void wintw_set_cursor_pos(TermWin *, int x, int y);
@@ -302,6 +303,7 @@ static const TermWinVtable windows_termwin_vt = {
     .draw_text = wintw_draw_text,
     .draw_cursor = wintw_draw_cursor,
     .draw_trust_sigil = wintw_draw_trust_sigil,
+    .scroll = wintw_scroll,
     .char_width = wintw_char_width,
     .free_draw_ctx = wintw_free_draw_ctx,
     .set_cursor_pos = wintw_set_cursor_pos,
@@ -1434,9 +1436,11 @@ void cleanup_exit(int code)
     /* Clean up COM. */
     CoUninitialize();
 
-#ifdef DEBUG
+    /* Always free the log context, to finish off a compressed log */
     if (logctx)
         log_free(logctx), logctx = NULL;
+
+#ifdef DEBUG
     if (term)
         term_free(term), term = NULL;
     if (conf)
@@ -4093,7 +4097,7 @@ static int get_terminal_text(const pos *start, const pos *end, WCHAR *str, int s
     int len = 0;
     int x = start->x, y = start->y;
     while (y < end->y || (y == end->y && x <= end->x)) {
-        const termline *ldata = index234(term->screen, y);
+        const termline *ldata = termscreen_line(term->screen, y);
         int x_end = ldata->cols - 1;
         if (!(ldata->lattr & LATTR_WRAPPED)) {
             while (x_end) {
@@ -4804,6 +4808,16 @@ static void wintw_draw_trust_sigil(TermWin *tw, int x, int y)
                0, NULL, DI_NORMAL);
 }
 
+static bool wintw_scroll(TermWin *tw, int topline, int botline, int lines)
+{
+    /*
+     * We draw straight into the window rather than into a backing
+     * bitmap, so there's nothing reliable to move: parts of the
+     * window might be covered. Let the terminal repaint instead.
+     */
+    return false;
+}
+
 /* This function gets the actual width of a character in the normal font.
  */
 static int wintw_char_width(TermWin *tw, int uc)